@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Benchmark.cpp
+ */
+
+#include <algorithm>
+#include <iostream>
+
+#include "benchmark/Benchmark.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+//! Time [ns] per operation of \c run (0 if no operation has been performed)
+double ns_per_operation(
+        const BenchmarkRun& run) noexcept
+{
+    return run.operations > 0 ? run.seconds * 1e9 / static_cast<double>(run.operations) : 0;
+}
+
+} /* namespace */
+
+double BenchmarkResult::ns_per_operation() const noexcept
+{
+    return benchmarks::ns_per_operation(median);
+}
+
+double BenchmarkResult::operations_per_second() const noexcept
+{
+    return median.seconds > 0 ? static_cast<double>(median.operations) / median.seconds : 0;
+}
+
+BenchmarkRunner::BenchmarkRunner(
+        const BenchmarkOptions& options)
+    : options_(options)
+{
+    // Do nothing
+}
+
+void BenchmarkRunner::run(
+        const std::string& name,
+        const std::map<std::string, std::string>& parameters,
+        const std::function<BenchmarkRun()>& benchmark)
+{
+    if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos)
+    {
+        return;
+    }
+
+    std::cerr << "Running " << name;
+    for (const auto& parameter : parameters)
+    {
+        std::cerr << " " << parameter.first << "=" << parameter.second;
+    }
+    std::cerr << " ..." << std::flush;
+
+    std::vector<BenchmarkRun> runs;
+    for (unsigned int i = 0; i < std::max(options_.repetitions, 1u); ++i)
+    {
+        runs.push_back(benchmark());
+    }
+
+    std::sort(runs.begin(), runs.end(), [](const BenchmarkRun& lhs, const BenchmarkRun& rhs)
+            {
+                return benchmarks::ns_per_operation(lhs) < benchmarks::ns_per_operation(rhs);
+            });
+
+    BenchmarkResult result;
+    result.name = name;
+    result.parameters = parameters;
+    result.median = runs[runs.size() / 2];
+    result.min_ns_per_operation = benchmarks::ns_per_operation(runs.front());
+    result.max_ns_per_operation = benchmarks::ns_per_operation(runs.back());
+    result.repetitions = static_cast<unsigned int>(runs.size());
+
+    std::cerr << " " << result.ns_per_operation() << " ns/op" << std::endl;
+
+    results_.push_back(std::move(result));
+}
+
+std::uint64_t BenchmarkRunner::scaled(
+        const std::uint64_t operations) const noexcept
+{
+    return std::max<std::uint64_t>(static_cast<std::uint64_t>(static_cast<double>(operations) * options_.scale), 1);
+}
+
+const BenchmarkOptions& BenchmarkRunner::options() const noexcept
+{
+    return options_;
+}
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::results() const noexcept
+{
+    return results_;
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
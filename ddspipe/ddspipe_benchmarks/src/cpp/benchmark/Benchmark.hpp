@@ -0,0 +1,139 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Benchmark.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+//! Options shared by every benchmark
+struct BenchmarkOptions
+{
+    //! Times each benchmark is run (the median run is reported)
+    unsigned int repetitions {5};
+
+    //! Factor applied to the size of every benchmark (e.g. 0.1 for a quick run)
+    double scale {1.0};
+
+    //! Only the benchmarks whose name contains this string are run (every one if empty)
+    std::string filter {};
+};
+
+//! Measurement of a single run of a benchmark
+struct BenchmarkRun
+{
+    //! Operations performed
+    std::uint64_t operations {0};
+
+    //! Time [s] taken by the operations
+    double seconds {0};
+
+    //! Additional measurements of the run (e.g. latency percentiles), by name
+    std::map<std::string, double> metrics {};
+};
+
+//! Result of a benchmark run several times
+struct BenchmarkResult
+{
+    //! Time [ns] per operation of the median run
+    double ns_per_operation() const noexcept;
+
+    //! Operations per second of the median run
+    double operations_per_second() const noexcept;
+
+    //! Name of the benchmark, with the component measured as prefix (e.g. "payload_pool/reserve_release")
+    std::string name {};
+
+    //! Parameters of the benchmark (e.g. number of threads), by name
+    std::map<std::string, std::string> parameters {};
+
+    //! Run with the median time per operation
+    BenchmarkRun median {};
+
+    //! Minimum time [ns] per operation of every run
+    double min_ns_per_operation {0};
+
+    //! Maximum time [ns] per operation of every run
+    double max_ns_per_operation {0};
+
+    //! Times the benchmark has been run
+    unsigned int repetitions {0};
+};
+
+/**
+ * Runs the benchmarks selected by the options and collects their results.
+ *
+ * Every benchmark is run \c repetitions times and the run with the median time per operation is kept, so a single
+ * run disturbed by the system does not move the result reported.
+ */
+class BenchmarkRunner
+{
+public:
+
+    BenchmarkRunner(
+            const BenchmarkOptions& options);
+
+    /**
+     * @brief Run \c benchmark if its name passes the filter, and store its result.
+     *
+     * @param name : name of the benchmark.
+     * @param parameters : parameters of the benchmark, to tell apart the results of the same benchmark.
+     * @param benchmark : function that performs a run of the benchmark and returns its measurement.
+     */
+    void run(
+            const std::string& name,
+            const std::map<std::string, std::string>& parameters,
+            const std::function<BenchmarkRun()>& benchmark);
+
+    //! Number of operations \c operations scaled by the options (at least 1)
+    std::uint64_t scaled(
+            const std::uint64_t operations) const noexcept;
+
+    //! Options of the runner
+    const BenchmarkOptions& options() const noexcept;
+
+    //! Results of every benchmark run, in order of execution
+    const std::vector<BenchmarkResult>& results() const noexcept;
+
+protected:
+
+    //! Options of the runner
+    const BenchmarkOptions options_;
+
+    //! Results of every benchmark run
+    std::vector<BenchmarkResult> results_;
+};
+
+//! Seconds elapsed since \c start
+inline double seconds_since(
+        const std::chrono::steady_clock::time_point& start) noexcept
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,180 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file JsonReport.cpp
+ */
+
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "benchmark/JsonReport.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+//! Write \c value as a JSON string
+void write_string(
+        std::ostream& os,
+        const std::string& value)
+{
+    os << '"';
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '"':
+                os << "\\\"";
+                break;
+
+            case '\\':
+                os << "\\\\";
+                break;
+
+            case '\n':
+                os << "\\n";
+                break;
+
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                }
+                else
+                {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+//! Write \c value as a JSON number (JSON has neither infinite nor NaN values, so they are written as null)
+void write_number(
+        std::ostream& os,
+        const double value)
+{
+    if (std::isfinite(value))
+    {
+        os << value;
+    }
+    else
+    {
+        os << "null";
+    }
+}
+
+//! Current UTC date in ISO 8601 format
+std::string current_date()
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm utc {};
+    gmtime_r(&now, &utc);
+
+    std::ostringstream os;
+    os << std::put_time(&utc, "%Y-%m-%dT%H:%M:%SZ");
+    return os.str();
+}
+
+} /* namespace */
+
+std::string json_report(
+        const std::vector<BenchmarkResult>& results,
+        const BenchmarkOptions& options)
+{
+    std::ostringstream os;
+    os << std::setprecision(10);
+
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": ";
+    write_string(os, current_date());
+    os << ",\n";
+    os << "    \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"repetitions\": " << options.repetitions << ",\n";
+    os << "    \"scale\": ";
+    write_number(os, options.scale);
+    os << "\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchmarkResult& result = results[i];
+
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"name\": ";
+        write_string(os, result.name);
+        os << ",\n";
+
+        os << "      \"parameters\": {";
+        bool first = true;
+        for (const auto& parameter : result.parameters)
+        {
+            os << (first ? "" : ", ");
+            write_string(os, parameter.first);
+            os << ": ";
+            write_string(os, parameter.second);
+            first = false;
+        }
+        os << "},\n";
+
+        os << "      \"repetitions\": " << result.repetitions << ",\n";
+        os << "      \"operations\": " << result.median.operations << ",\n";
+        os << "      \"seconds\": ";
+        write_number(os, result.median.seconds);
+        os << ",\n";
+        os << "      \"ns_per_operation\": ";
+        write_number(os, result.ns_per_operation());
+        os << ",\n";
+        os << "      \"min_ns_per_operation\": ";
+        write_number(os, result.min_ns_per_operation);
+        os << ",\n";
+        os << "      \"max_ns_per_operation\": ";
+        write_number(os, result.max_ns_per_operation);
+        os << ",\n";
+        os << "      \"operations_per_second\": ";
+        write_number(os, result.operations_per_second());
+        os << ",\n";
+
+        os << "      \"metrics\": {";
+        first = true;
+        for (const auto& metric : result.median.metrics)
+        {
+            os << (first ? "" : ", ");
+            write_string(os, metric.first);
+            os << ": ";
+            write_number(os, metric.second);
+            first = false;
+        }
+        os << "}\n";
+        os << "    }";
+    }
+
+    os << (results.empty() ? "]\n" : "\n  ]\n");
+    os << "}\n";
+
+    return os.str();
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
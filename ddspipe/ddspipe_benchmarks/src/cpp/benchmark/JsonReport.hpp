@@ -0,0 +1,43 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file JsonReport.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "benchmark/Benchmark.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+/**
+ * @brief JSON document with the context of the execution and the result of every benchmark.
+ *
+ * The document has a \c context object (date, hardware concurrency, repetitions and scale) and a \c benchmarks
+ * array, with the name, parameters, operations, time, time per operation and additional metrics of each one.
+ * Benchmarks keep their order of execution, so the reports of two releases can be diffed line by line.
+ */
+std::string json_report(
+        const std::vector<BenchmarkResult>& results,
+        const BenchmarkOptions& options);
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
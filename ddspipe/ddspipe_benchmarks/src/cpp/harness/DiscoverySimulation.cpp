@@ -0,0 +1,319 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoverySimulation.cpp
+ */
+
+#include <fstream>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+
+#include "harness/DiscoverySimulation.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+using namespace eprosima::ddspipe::core::types;
+
+namespace {
+
+//! Threads of the pipe (the tracks never receive data, so they are barely used)
+constexpr const unsigned int THREADS = 2;
+
+//! Write \c value in little endian in \c bytes
+void write_little_endian(
+        std::uint8_t* bytes,
+        const std::uint32_t value) noexcept
+{
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        bytes[i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+}
+
+} /* namespace */
+
+DiscoverySimulation::DiscoverySimulation(
+        const DiscoveryScenario& scenario)
+    : scenario_(scenario)
+    , discovery_database_(std::make_shared<core::DiscoveryDatabase>())
+    , payload_pool_(std::make_shared<core::FastPayloadPool>())
+    , participants_database_(std::make_shared<core::ParticipantsDatabase>())
+    , thread_pool_(std::make_shared<utils::SlotThreadPool>(THREADS))
+    , remote_endpoints_(scenario.remote_participants)
+    , generations_(scenario.remote_participants, 0)
+    , injected_(0)
+    , processed_(0)
+{
+    if (scenario_.remote_participants == 0 || scenario_.topics == 0 || scenario_.local_participants == 0 ||
+            scenario_.endpoints < 2 * scenario_.remote_participants)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Invalid discovery scenario: " << scenario_.endpoints << " endpoints, " <<
+                      scenario_.remote_participants << " remote participants, " << scenario_.topics <<
+                      " topics and " << scenario_.local_participants << " local participants.");
+    }
+
+    for (unsigned int i = 0; i < scenario_.local_participants; ++i)
+    {
+        auto participant = std::make_shared<ObservedParticipant>("local_" + std::to_string(i));
+        participants_database_->add_participant(participant->id(), participant);
+        local_participants_.push_back(participant);
+    }
+
+    core::DdsPipeConfiguration configuration;
+    configuration.init_enabled = true;
+
+    pipe_.reset(new core::DdsPipe(
+                configuration,
+                discovery_database_,
+                payload_pool_,
+                participants_database_,
+                thread_pool_));
+
+    // Registered after the pipe, so it is called once the pipe has processed each batch
+    discovery_database_->add_batch_processed_callback([this](const std::vector<core::DatabaseEvent>& batch)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    processed_ += batch.size();
+                }
+                cv_.notify_all();
+            });
+}
+
+DiscoverySimulation::~DiscoverySimulation()
+{
+    pipe_.reset();
+}
+
+bool DiscoverySimulation::join_all()
+{
+    for (unsigned int participant = 0; participant < scenario_.remote_participants; ++participant)
+    {
+        remote_endpoints_[participant] = create_endpoints_(participant, generations_[participant]);
+        for (const auto& endpoint : remote_endpoints_[participant])
+        {
+            inject_(core::DatabaseOperation::add, endpoint);
+        }
+    }
+
+    wait_processed_();
+
+    // Every local participant takes part in every bridge, so any of them tells when the bridges are created
+    return local_participants_.front()->wait_topics(first_reader_injected_.size(), scenario_.timeout);
+}
+
+void DiscoverySimulation::flap(
+        const double fraction,
+        const unsigned int rounds)
+{
+    const unsigned int flapping = static_cast<unsigned int>(fraction * scenario_.remote_participants);
+
+    for (unsigned int round = 0; round < rounds; ++round)
+    {
+        // Change the participants flapping in every round
+        for (unsigned int i = 0; i < flapping; ++i)
+        {
+            const unsigned int participant = (round * flapping + i) % scenario_.remote_participants;
+
+            for (auto& endpoint : remote_endpoints_[participant])
+            {
+                endpoint.active = false;
+                inject_(core::DatabaseOperation::update, endpoint);
+            }
+            for (auto& endpoint : remote_endpoints_[participant])
+            {
+                endpoint.active = true;
+                inject_(core::DatabaseOperation::update, endpoint);
+            }
+        }
+    }
+
+    wait_processed_();
+}
+
+void DiscoverySimulation::restart_all()
+{
+    for (unsigned int participant = 0; participant < scenario_.remote_participants; ++participant)
+    {
+        for (const auto& endpoint : remote_endpoints_[participant])
+        {
+            inject_(core::DatabaseOperation::erase, endpoint);
+        }
+
+        remote_endpoints_[participant] = create_endpoints_(participant, ++generations_[participant]);
+        for (const auto& endpoint : remote_endpoints_[participant])
+        {
+            inject_(core::DatabaseOperation::add, endpoint);
+        }
+    }
+
+    wait_processed_();
+}
+
+void DiscoverySimulation::leave_all()
+{
+    for (auto& endpoints : remote_endpoints_)
+    {
+        for (const auto& endpoint : endpoints)
+        {
+            inject_(core::DatabaseOperation::erase, endpoint);
+        }
+        endpoints.clear();
+    }
+
+    wait_processed_();
+}
+
+core::LatencyDistributionSnapshot DiscoverySimulation::time_to_bridge_creation() const
+{
+    core::LatencyHistogram histogram;
+
+    const auto created = local_participants_.front()->topics_created();
+    for (const auto& injected : first_reader_injected_)
+    {
+        auto it = created.find(injected.first);
+        if (it == created.end())
+        {
+            continue;
+        }
+
+        histogram.record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(it->second - injected.second).count()));
+    }
+
+    return histogram.snapshot();
+}
+
+std::size_t DiscoverySimulation::bridges_created() const
+{
+    return local_participants_.front()->topics_created().size();
+}
+
+std::uint64_t DiscoverySimulation::operations_injected() const noexcept
+{
+    return injected_;
+}
+
+const core::DdsPipe& DiscoverySimulation::pipe() const noexcept
+{
+    return *pipe_;
+}
+
+std::uint64_t DiscoverySimulation::resident_memory() noexcept
+{
+#if defined(__linux__)
+    // Second field of statm: resident pages
+    std::ifstream statm("/proc/self/statm");
+    std::uint64_t size = 0;
+    std::uint64_t resident = 0;
+    if (statm >> size >> resident)
+    {
+        return resident * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif // defined(__linux__)
+
+    return 0;
+}
+
+std::vector<Endpoint> DiscoverySimulation::create_endpoints_(
+        const unsigned int participant,
+        const std::uint32_t generation) const
+{
+    // Spread the endpoints evenly, the first participants taking the remainder
+    const std::uint64_t count = scenario_.endpoints / scenario_.remote_participants +
+            (participant < scenario_.endpoints % scenario_.remote_participants ? 1 : 0);
+
+    std::vector<Endpoint> endpoints(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        Endpoint& endpoint = endpoints[i];
+
+        // Writers and readers in pairs of the same topic, each participant starting in a different topic
+        const std::uint64_t topic = (static_cast<std::uint64_t>(participant) * 31 + i / 2) % scenario_.topics;
+        endpoint.kind = (i % 2 == 0) ? EndpointKind::writer : EndpointKind::reader;
+        endpoint.topic.m_topic_name = "storm_topic_" + std::to_string(topic);
+        endpoint.topic.type_name = "StormType";
+
+        // The guid prefix identifies the remote participant and its generation, and the entity id the endpoint
+        endpoint.guid.guidPrefix.value[0] = 0x01;
+        endpoint.guid.guidPrefix.value[1] = 0x0f;
+        write_little_endian(endpoint.guid.guidPrefix.value + 4, generation);
+        write_little_endian(endpoint.guid.guidPrefix.value + 8, participant);
+        write_little_endian(endpoint.guid.entityId.value, static_cast<std::uint32_t>(i << 8));
+        endpoint.guid.entityId.value[3] = endpoint.is_writer() ? 0x03 : 0x04;
+
+        endpoint.discoverer_participant_id = local_participants_[participant % local_participants_.size()]->id();
+    }
+
+    return endpoints;
+}
+
+void DiscoverySimulation::inject_(
+        const core::DatabaseOperation operation,
+        const Endpoint& endpoint)
+{
+    if (operation == core::DatabaseOperation::add && endpoint.is_reader())
+    {
+        first_reader_injected_.emplace(endpoint.topic.topic_unique_name(), std::chrono::steady_clock::now());
+    }
+
+    switch (operation)
+    {
+        case core::DatabaseOperation::add:
+            discovery_database_->add_endpoint(endpoint);
+            break;
+
+        case core::DatabaseOperation::update:
+            discovery_database_->update_endpoint(endpoint);
+            break;
+
+        case core::DatabaseOperation::erase:
+            discovery_database_->erase_endpoint(endpoint);
+            break;
+    }
+
+    injected_++;
+}
+
+void DiscoverySimulation::wait_processed_()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!cv_.wait_for(lock, scenario_.timeout, [this]()
+            {
+                return processed_ >= injected_;
+            }))
+    {
+        throw utils::TimeoutException(
+                  utils::Formatter() << "Discovery simulation timed out: " << processed_ << " of " << injected_ <<
+                      " operations processed.");
+    }
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
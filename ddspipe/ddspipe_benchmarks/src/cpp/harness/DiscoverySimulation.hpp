@@ -0,0 +1,179 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoverySimulation.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+
+#include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+
+#include "harness/ObservedParticipant.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+//! Size of the discovery simulated
+struct DiscoveryScenario
+{
+    //! Endpoints of all the remote participants together (half writers, half readers)
+    std::uint64_t endpoints {10000};
+
+    //! Remote participants that own the endpoints
+    unsigned int remote_participants {100};
+
+    //! Topics the endpoints are spread over
+    unsigned int topics {1000};
+
+    //! Participants of the pipe, that discover the remote endpoints in turns
+    unsigned int local_participants {2};
+
+    //! Maximum time to wait for the pipe to process the operations injected
+    std::chrono::milliseconds timeout {std::chrono::seconds(120)};
+};
+
+/**
+ * Harness that injects synthetic discovery into a DDS Pipe, as if its participants discovered a fleet of remote
+ * participants, without any network.
+ *
+ * The pipe runs with \c ObservedParticipant participants, so the bridges are created as in a real pipe but their
+ * entities cost nothing, and the time spent is the one of the discovery path (database, pipe and bridges).
+ *
+ * The endpoints are injected in the Discovery Database as fast as possible, as in a discovery storm, with the
+ * churn patterns of a real fleet: remote participants joining, losing and recovering liveliness, restarting with a
+ * new guid prefix, and leaving. Every method returns once the pipe has processed every operation injected, and
+ * throws \c utils::TimeoutException if it has not after the timeout of the scenario.
+ */
+class DiscoverySimulation
+{
+public:
+
+    DiscoverySimulation(
+            const DiscoveryScenario& scenario);
+
+    //! Destroy the pipe before the participants and databases
+    ~DiscoverySimulation();
+
+    /**
+     * @brief Add the endpoints of every remote participant, and wait until the bridges of every topic are created.
+     *
+     * @return whether every bridge has been created before the timeout
+     */
+    bool join_all();
+
+    /**
+     * @brief Make \c fraction of the remote participants lose and recover liveliness \c rounds times.
+     *
+     * Every endpoint of those participants is updated as inactive and then as active again.
+     */
+    void flap(
+            const double fraction,
+            const unsigned int rounds);
+
+    //! Restart every remote participant in turn: erase its endpoints and add them again with a new guid prefix
+    void restart_all();
+
+    //! Erase the endpoints of every remote participant
+    void leave_all();
+
+    /**
+     * @brief Time from the injection of the first reader of each topic until its bridge is created.
+     *
+     * Only the topics whose bridge has been created are counted.
+     */
+    core::LatencyDistributionSnapshot time_to_bridge_creation() const;
+
+    //! Number of topics whose bridge has been created
+    std::size_t bridges_created() const;
+
+    //! Operations (add, update and erase) injected in the Discovery Database so far
+    std::uint64_t operations_injected() const noexcept;
+
+    //! Pipe simulated
+    const core::DdsPipe& pipe() const noexcept;
+
+    //! Resident memory [bytes] of this process (0 if it can not be read in this platform)
+    static std::uint64_t resident_memory() noexcept;
+
+protected:
+
+    //! Endpoints of remote participant \c participant , with guid prefix \c generation
+    std::vector<core::types::Endpoint> create_endpoints_(
+            const unsigned int participant,
+            const std::uint32_t generation) const;
+
+    //! Inject \c operation of \c endpoint in the Discovery Database
+    void inject_(
+            const core::DatabaseOperation operation,
+            const core::types::Endpoint& endpoint);
+
+    //! Wait until the Discovery Database (and the pipe) have processed every operation injected
+    void wait_processed_();
+
+    //! Size of the discovery simulated
+    const DiscoveryScenario scenario_;
+
+    std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
+    std::shared_ptr<core::PayloadPool> payload_pool_;
+    std::shared_ptr<core::ParticipantsDatabase> participants_database_;
+    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+
+    //! Participants of the pipe
+    std::vector<std::shared_ptr<ObservedParticipant>> local_participants_;
+
+    //! Pipe simulated
+    std::unique_ptr<core::DdsPipe> pipe_;
+
+    //! Current endpoints of each remote participant
+    std::vector<std::vector<core::types::Endpoint>> remote_endpoints_;
+
+    //! Guid prefix generation of each remote participant (increased when it restarts)
+    std::vector<std::uint32_t> generations_;
+
+    //! Time when the first reader of each topic was injected, indexed by topic unique name
+    std::map<std::string, std::chrono::steady_clock::time_point> first_reader_injected_;
+
+    //! Operations injected
+    std::uint64_t injected_;
+
+    //! Operations processed by the Discovery Database (and the pipe)
+    std::uint64_t processed_;
+
+    //! Mutex to protect \c processed_
+    std::mutex mutex_;
+
+    //! Notified every time a batch of operations is processed
+    std::condition_variable cv_;
+};
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
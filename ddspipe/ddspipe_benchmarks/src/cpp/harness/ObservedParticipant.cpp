@@ -0,0 +1,81 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ObservedParticipant.cpp
+ */
+
+#include "harness/ObservedParticipant.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+ObservedParticipant::ObservedParticipant(
+        const core::types::ParticipantId& id)
+    : participants::BlankParticipant(id)
+{
+}
+
+std::shared_ptr<core::IWriter> ObservedParticipant::create_writer(
+        const core::ITopic& topic)
+{
+    entity_created_(topic);
+    return participants::BlankParticipant::create_writer(topic);
+}
+
+std::shared_ptr<core::IReader> ObservedParticipant::create_reader(
+        const core::ITopic& topic)
+{
+    entity_created_(topic);
+    return participants::BlankParticipant::create_reader(topic);
+}
+
+bool ObservedParticipant::wait_topics(
+        const std::size_t topics,
+        const std::chrono::milliseconds& timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, timeout, [this, topics]()
+                   {
+                       return topics_created_.size() >= topics;
+                   });
+}
+
+std::map<std::string, std::chrono::steady_clock::time_point> ObservedParticipant::topics_created() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return topics_created_;
+}
+
+void ObservedParticipant::entity_created_(
+        const core::ITopic& topic)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!topics_created_.emplace(topic.topic_unique_name(), now).second)
+        {
+            // Not the first entity of the topic
+            return;
+        }
+    }
+
+    cv_.notify_all();
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
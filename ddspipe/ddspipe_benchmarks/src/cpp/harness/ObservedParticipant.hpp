@@ -0,0 +1,84 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ObservedParticipant.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <ddspipe_participants/participant/auxiliar/BlankParticipant.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+/**
+ * Blank Participant that records when the first entity of each topic is created in it.
+ *
+ * The bridge of a topic creates the entities of every participant, so this is the time when the bridge of the topic
+ * is created, without the cost of real RTPS entities.
+ */
+class ObservedParticipant : public participants::BlankParticipant
+{
+public:
+
+    ObservedParticipant(
+            const core::types::ParticipantId& id);
+
+    //! Override create_writer() IParticipant method
+    std::shared_ptr<core::IWriter> create_writer(
+            const core::ITopic& topic) override;
+
+    //! Override create_reader() IParticipant method
+    std::shared_ptr<core::IReader> create_reader(
+            const core::ITopic& topic) override;
+
+    /**
+     * @brief Wait until entities of \c topics different topics have been created, or \c timeout elapses.
+     *
+     * @return whether the entities of \c topics topics have been created
+     */
+    bool wait_topics(
+            const std::size_t topics,
+            const std::chrono::milliseconds& timeout);
+
+    //! Time when the first entity of each topic was created, indexed by topic name
+    std::map<std::string, std::chrono::steady_clock::time_point> topics_created() const;
+
+protected:
+
+    //! Record the creation of an entity of \c topic
+    void entity_created_(
+            const core::ITopic& topic);
+
+    //! Time when the first entity of each topic was created
+    std::map<std::string, std::chrono::steady_clock::time_point> topics_created_;
+
+    //! Mutex to protect \c topics_created_
+    mutable std::mutex mutex_;
+
+    //! Notified every time a new topic is created
+    std::condition_variable cv_;
+};
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
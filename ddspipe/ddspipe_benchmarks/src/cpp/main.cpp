@@ -0,0 +1,126 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main.cpp
+ *
+ * Benchmarks of the DDS Pipe components, whose results are written in a JSON file.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "benchmark/Benchmark.hpp"
+#include "benchmark/JsonReport.hpp"
+#include "suites/suites.hpp"
+
+using namespace eprosima::ddspipe::benchmarks;
+
+namespace {
+
+void print_help(
+        const char* program)
+{
+    std::cout <<
+        "Usage: " << program << " [options]\n"
+        "\n"
+        "Options:\n"
+        "  -o, --output <file>      File where the JSON results are written [ddspipe_benchmarks.json]\n"
+        "  -f, --filter <text>      Only run the benchmarks whose name contains <text>\n"
+        "  -r, --repetitions <n>    Times each benchmark is run, the median run is reported [5]\n"
+        "  -s, --scale <factor>     Factor applied to the size of every benchmark [1.0]\n"
+        "  -h, --help               Print this help and exit\n";
+}
+
+} /* namespace */
+
+int main(
+        int argc,
+        char** argv)
+{
+    BenchmarkOptions options;
+    std::string output = "ddspipe_benchmarks.json";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+
+        if (argument == "-h" || argument == "--help")
+        {
+            print_help(argv[0]);
+            return EXIT_SUCCESS;
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Unknown argument or missing value: " << argument << std::endl;
+            print_help(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        const std::string value = argv[++i];
+
+        if (argument == "-o" || argument == "--output")
+        {
+            output = value;
+        }
+        else if (argument == "-f" || argument == "--filter")
+        {
+            options.filter = value;
+        }
+        else if (argument == "-r" || argument == "--repetitions")
+        {
+            options.repetitions = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        else if (argument == "-s" || argument == "--scale")
+        {
+            options.scale = std::strtod(value.c_str(), nullptr);
+        }
+        else
+        {
+            std::cerr << "Unknown argument: " << argument << std::endl;
+            print_help(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.repetitions == 0 || !(options.scale > 0))
+    {
+        std::cerr << "Repetitions and scale must be positive." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    BenchmarkRunner runner(options);
+
+    payload_pool_benchmarks(runner);
+    thread_pool_benchmarks(runner);
+    allowed_topics_benchmarks(runner);
+    discovery_database_benchmarks(runner);
+    pipe_benchmarks(runner);
+    discovery_storm_benchmarks(runner);
+
+    std::ofstream file(output);
+    if (!file)
+    {
+        std::cerr << "Could not open output file " << output << "." << std::endl;
+        return EXIT_FAILURE;
+    }
+    file << json_report(runner.results(), options);
+
+    std::cerr << "Results of " << runner.results().size() << " benchmarks written in " << output << "." << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file allowed_topics.cpp
+ */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/memory/Heritable.hpp>
+
+#include <ddspipe_core/dynamic/AllowedTopicList.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include "suites/suites.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+using namespace eprosima::ddspipe::core::types;
+
+//! Filters in the allowlist
+constexpr const unsigned int FILTERS = 1000;
+
+//! Different topics queried when the decisions are not cached yet
+constexpr const std::uint64_t DISTINCT_TOPICS = 50000;
+
+//! Different topics queried over and over once their decisions are cached
+constexpr const std::uint64_t CACHED_TOPICS = 1000;
+
+//! Queries over the cached topics
+constexpr const std::uint64_t CACHED_OPERATIONS = 1000000;
+
+std::unique_ptr<core::AllowedTopicList> create_allowed_topics()
+{
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    for (unsigned int i = 0; i < FILTERS; ++i)
+    {
+        auto filter = utils::Heritable<WildcardDdsFilterTopic>::make_heritable();
+        filter->topic_name.set_value("bench/" + std::to_string(i) + "/*");
+        allowlist.insert(filter);
+    }
+
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+    auto blocked = utils::Heritable<WildcardDdsFilterTopic>::make_heritable();
+    blocked->topic_name.set_value("*/blocked");
+    blocklist.insert(blocked);
+
+    return std::unique_ptr<core::AllowedTopicList>(new core::AllowedTopicList(allowlist, blocklist));
+}
+
+/**
+ * Topics to query: most of them match a filter at any position of the allowlist,
+ * and one of every ten does not match any.
+ */
+std::vector<DdsTopic> create_topics(
+        const std::uint64_t count)
+{
+    std::vector<DdsTopic> topics(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        if (i % 10 == 9)
+        {
+            topics[i].m_topic_name = "unknown/" + std::to_string(i);
+        }
+        else
+        {
+            topics[i].m_topic_name = "bench/" + std::to_string(i % FILTERS) + "/topic_" + std::to_string(i);
+        }
+        topics[i].type_name = "BenchmarkType";
+    }
+    return topics;
+}
+
+BenchmarkRun query(
+        const core::AllowedTopicList& allowed_topics,
+        const std::vector<DdsTopic>& topics,
+        const std::uint64_t operations)
+{
+    std::uint64_t allowed = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < operations; ++i)
+    {
+        if (allowed_topics.is_topic_allowed(topics[i % topics.size()]))
+        {
+            allowed++;
+        }
+    }
+
+    BenchmarkRun run;
+    run.seconds = seconds_since(start);
+    run.operations = operations;
+    run.metrics["allowed_ratio"] = static_cast<double>(allowed) / static_cast<double>(operations);
+    return run;
+}
+
+} /* namespace */
+
+void allowed_topics_benchmarks(
+        BenchmarkRunner& runner)
+{
+    const std::vector<DdsTopic> distinct_topics = create_topics(runner.scaled(DISTINCT_TOPICS));
+    const std::vector<DdsTopic> cached_topics = create_topics(CACHED_TOPICS);
+    const std::uint64_t cached_operations = runner.scaled(CACHED_OPERATIONS);
+
+    runner.run(
+        "allowed_topics/first_lookup",
+        {{"filters", std::to_string(FILTERS)}, {"topics", std::to_string(distinct_topics.size())}},
+        [&]()
+        {
+            auto allowed_topics = create_allowed_topics();
+            return query(*allowed_topics, distinct_topics, distinct_topics.size());
+        });
+
+    runner.run(
+        "allowed_topics/cached_lookup",
+        {{"filters", std::to_string(FILTERS)}, {"topics", std::to_string(cached_topics.size())}},
+        [&]()
+        {
+            auto allowed_topics = create_allowed_topics();
+            // Warm up the cache before measuring
+            query(*allowed_topics, cached_topics, cached_topics.size());
+            return query(*allowed_topics, cached_topics, cached_operations);
+        });
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
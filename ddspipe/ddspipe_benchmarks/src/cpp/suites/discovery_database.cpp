@@ -0,0 +1,230 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file discovery_database.cpp
+ */
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include "suites/suites.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+using namespace eprosima::ddspipe::core::types;
+
+//! Endpoints in the database
+constexpr const std::uint64_t ENDPOINTS = 50000;
+
+//! Topics the endpoints are spread over
+constexpr const unsigned int TOPICS = 500;
+
+//! Participants the endpoints are discovered by
+constexpr const unsigned int PARTICIPANTS = 10;
+
+//! Queries of the number of active endpoints
+constexpr const std::uint64_t QUERIES = 200000;
+
+/**
+ * Discovery Database that counts the operations processed, so the benchmarks can wait until every operation
+ * queued has been applied.
+ */
+class CountedDatabase
+{
+public:
+
+    CountedDatabase()
+        : processed_(0)
+    {
+        database.add_batch_processed_callback([this](const std::vector<core::DatabaseEvent>& batch)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        processed_ += batch.size();
+                    }
+                    cv_.notify_all();
+                });
+        database.start();
+    }
+
+    ~CountedDatabase()
+    {
+        database.stop();
+    }
+
+    //! Wait until \c operations operations have been processed since the database was created
+    void wait_processed(
+            const std::uint64_t operations)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this, operations]()
+                {
+                    return processed_ >= operations;
+                });
+    }
+
+    core::DiscoveryDatabase database;
+
+protected:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::uint64_t processed_;
+};
+
+//! Endpoints spread over every topic and participant, alternating writers and readers
+std::vector<Endpoint> create_endpoints(
+        const std::uint64_t count)
+{
+    std::vector<Endpoint> endpoints(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        Endpoint& endpoint = endpoints[i];
+        endpoint.kind = (i % 2 == 0) ? EndpointKind::writer : EndpointKind::reader;
+        endpoint.guid = Guid::new_unique_guid();
+        endpoint.topic.m_topic_name = "bench_topic_" + std::to_string(i % TOPICS);
+        endpoint.topic.type_name = "BenchmarkType";
+        endpoint.discoverer_participant_id = "participant_" + std::to_string((i / TOPICS) % PARTICIPANTS);
+    }
+    return endpoints;
+}
+
+//! Add every endpoint and wait until they are in the database
+void add_all(
+        CountedDatabase& counted,
+        const std::vector<Endpoint>& endpoints)
+{
+    for (const auto& endpoint : endpoints)
+    {
+        counted.database.add_endpoint(endpoint);
+    }
+    counted.wait_processed(endpoints.size());
+}
+
+} /* namespace */
+
+void discovery_database_benchmarks(
+        BenchmarkRunner& runner)
+{
+    const std::uint64_t count = runner.scaled(ENDPOINTS);
+    const std::map<std::string, std::string> parameters = {
+        {"endpoints", std::to_string(count)},
+        {"topics", std::to_string(TOPICS)},
+        {"participants", std::to_string(PARTICIPANTS)}};
+
+    runner.run(
+        "discovery_database/add",
+        parameters,
+        [&]()
+        {
+            const auto endpoints = create_endpoints(count);
+            CountedDatabase counted;
+
+            const auto start = std::chrono::steady_clock::now();
+            add_all(counted, endpoints);
+
+            BenchmarkRun run;
+            run.seconds = seconds_since(start);
+            run.operations = count;
+            return run;
+        });
+
+    runner.run(
+        "discovery_database/update",
+        parameters,
+        [&]()
+        {
+            auto endpoints = create_endpoints(count);
+            CountedDatabase counted;
+            add_all(counted, endpoints);
+
+            // Deactivate every endpoint, as when their participants drop
+            const auto start = std::chrono::steady_clock::now();
+            for (auto& endpoint : endpoints)
+            {
+                endpoint.active = false;
+                counted.database.update_endpoint(endpoint);
+            }
+            counted.wait_processed(2 * count);
+
+            BenchmarkRun run;
+            run.seconds = seconds_since(start);
+            run.operations = count;
+            return run;
+        });
+
+    runner.run(
+        "discovery_database/erase",
+        parameters,
+        [&]()
+        {
+            const auto endpoints = create_endpoints(count);
+            CountedDatabase counted;
+            add_all(counted, endpoints);
+
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto& endpoint : endpoints)
+            {
+                counted.database.erase_endpoint(endpoint);
+            }
+            counted.wait_processed(2 * count);
+
+            BenchmarkRun run;
+            run.seconds = seconds_since(start);
+            run.operations = count;
+            return run;
+        });
+
+    const std::uint64_t queries = runner.scaled(QUERIES);
+    runner.run(
+        "discovery_database/count_active_endpoints",
+        parameters,
+        [&]()
+        {
+            const auto endpoints = create_endpoints(count);
+            CountedDatabase counted;
+            add_all(counted, endpoints);
+
+            // Query the topics as the pipe does when an endpoint is discovered
+            std::uint64_t found = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < queries; ++i)
+            {
+                const Endpoint& endpoint = endpoints[i % endpoints.size()];
+                found += counted.database.count_active_endpoints(
+                    endpoint.topic, endpoint.discoverer_participant_id, endpoint.kind);
+            }
+
+            BenchmarkRun run;
+            run.seconds = seconds_since(start);
+            run.operations = queries;
+            run.metrics["mean_endpoints_found"] = static_cast<double>(found) / static_cast<double>(queries);
+            return run;
+        });
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
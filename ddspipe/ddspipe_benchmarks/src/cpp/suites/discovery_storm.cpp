@@ -0,0 +1,163 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file discovery_storm.cpp
+ */
+
+#include <functional>
+#include <string>
+
+#include "harness/DiscoverySimulation.hpp"
+#include "suites/suites.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+//! Fraction of the remote participants that lose and recover liveliness in each flapping round
+constexpr const double FLAPPING_FRACTION = 0.1;
+
+//! Flapping rounds
+constexpr const unsigned int FLAPPING_ROUNDS = 10;
+
+/**
+ * Run \c phase over a simulation where every remote participant has already joined, and measure it.
+ *
+ * The mutex times and the memory growth only count the phase, not the join before it (unless the phase is the
+ * join itself).
+ */
+BenchmarkRun measure(
+        const DiscoveryScenario& scenario,
+        const bool measure_join,
+        const std::function<void(DiscoverySimulation&)>& phase)
+{
+    const std::uint64_t initial_memory = DiscoverySimulation::resident_memory();
+
+    DiscoverySimulation simulation(scenario);
+
+    if (!measure_join)
+    {
+        simulation.join_all();
+    }
+
+    const std::uint64_t operations_before = simulation.operations_injected();
+    const auto hold_times_before = simulation.pipe().mutex_hold_times();
+    const auto wait_times_before = simulation.pipe().mutex_wait_times();
+    const std::uint64_t memory_before = DiscoverySimulation::resident_memory();
+
+    const auto start = std::chrono::steady_clock::now();
+    phase(simulation);
+
+    BenchmarkRun run;
+    run.seconds = seconds_since(start);
+    run.operations = simulation.operations_injected() - operations_before;
+
+    const std::uint64_t memory_after = DiscoverySimulation::resident_memory();
+    run.metrics["memory_growth_bytes"] = static_cast<double>(memory_after) - static_cast<double>(memory_before);
+    run.metrics["memory_since_creation_bytes"] =
+            static_cast<double>(memory_after) - static_cast<double>(initial_memory);
+    run.metrics["bridges_created"] = static_cast<double>(simulation.bridges_created());
+
+    add_latency_metrics(run, "mutex_hold_",
+            latency_difference(simulation.pipe().mutex_hold_times(), hold_times_before));
+    add_latency_metrics(run, "mutex_wait_",
+            latency_difference(simulation.pipe().mutex_wait_times(), wait_times_before));
+
+    if (measure_join)
+    {
+        add_latency_metrics(run, "time_to_bridge_", simulation.time_to_bridge_creation());
+    }
+
+    return run;
+}
+
+} /* namespace */
+
+void discovery_storm_benchmarks(
+        BenchmarkRunner& runner)
+{
+    const DiscoveryScenario sizes[] = {
+        {10000, 100, 1000},
+        {50000, 500, 2500},
+        {100000, 1000, 5000}};
+
+    for (const auto& size : sizes)
+    {
+        DiscoveryScenario scenario = size;
+        scenario.endpoints = runner.scaled(size.endpoints);
+        scenario.remote_participants = static_cast<unsigned int>(runner.scaled(size.remote_participants));
+        scenario.topics = static_cast<unsigned int>(runner.scaled(size.topics));
+
+        const std::map<std::string, std::string> parameters = {
+            {"endpoints", std::to_string(scenario.endpoints)},
+            {"remote_participants", std::to_string(scenario.remote_participants)},
+            {"topics", std::to_string(scenario.topics)},
+            {"local_participants", std::to_string(scenario.local_participants)}};
+
+        // Every remote participant joins at once
+        runner.run(
+            "discovery_storm/join",
+            parameters,
+            [&]()
+            {
+                return measure(scenario, true, [](DiscoverySimulation& simulation)
+                {
+                    simulation.join_all();
+                });
+            });
+
+        // Some remote participants lose and recover liveliness over and over
+        runner.run(
+            "discovery_storm/flap",
+            parameters,
+            [&]()
+            {
+                return measure(scenario, false, [](DiscoverySimulation& simulation)
+                {
+                    simulation.flap(FLAPPING_FRACTION, FLAPPING_ROUNDS);
+                });
+            });
+
+        // Every remote participant restarts with a new guid prefix
+        runner.run(
+            "discovery_storm/restart",
+            parameters,
+            [&]()
+            {
+                return measure(scenario, false, [](DiscoverySimulation& simulation)
+                {
+                    simulation.restart_all();
+                });
+            });
+
+        // Every remote participant leaves
+        runner.run(
+            "discovery_storm/leave",
+            parameters,
+            [&]()
+            {
+                return measure(scenario, false, [](DiscoverySimulation& simulation)
+                {
+                    simulation.leave_all();
+                });
+            });
+    }
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,166 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file payload_pool.cpp
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/CopyPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/MapPayloadPool.hpp>
+
+#include "suites/suites.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+//! Size [bytes] of the payloads reserved
+constexpr const std::uint32_t PAYLOAD_SIZE = 256;
+
+//! Payloads held at once by each thread, so the pool does not only serve the same payload over and over
+constexpr const std::uint64_t BATCH_SIZE = 16;
+
+//! Operations of each thread
+constexpr const std::uint64_t OPERATIONS_PER_THREAD = 200000;
+
+std::shared_ptr<core::PayloadPool> create_pool(
+        const std::string& kind)
+{
+    if (kind == "fast")
+    {
+        return std::make_shared<core::FastPayloadPool>();
+    }
+    if (kind == "map")
+    {
+        return std::make_shared<core::MapPayloadPool>();
+    }
+    return std::make_shared<core::CopyPayloadPool>();
+}
+
+/**
+ * Reserve and release payloads of \c pool from \c threads threads at once.
+ *
+ * If \c share , every payload reserved is also taken again from the pool as if it was forwarded to a writer,
+ * which shares it in the Fast and Map pools and copies it in the Copy pool.
+ */
+BenchmarkRun reserve_release(
+        core::PayloadPool& pool,
+        const unsigned int threads,
+        const std::uint64_t operations_per_thread,
+        const bool share)
+{
+    const std::uint64_t batches = (operations_per_thread + BATCH_SIZE - 1) / BATCH_SIZE;
+
+    std::atomic<unsigned int> ready(0);
+    std::atomic<bool> go(false);
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&]()
+                {
+                    std::vector<core::types::Payload> payloads(BATCH_SIZE);
+                    std::vector<core::types::Payload> shared(BATCH_SIZE);
+
+                    ready++;
+                    while (!go)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    for (std::uint64_t batch = 0; batch < batches; ++batch)
+                    {
+                        for (auto& payload : payloads)
+                        {
+                            pool.get_payload(PAYLOAD_SIZE, payload);
+                        }
+
+                        if (share)
+                        {
+                            for (std::uint64_t j = 0; j < BATCH_SIZE; ++j)
+                            {
+                                fastrtps::rtps::IPayloadPool* owner = &pool;
+                                pool.get_payload(payloads[j], owner, shared[j]);
+                            }
+                            for (auto& payload : shared)
+                            {
+                                pool.release_payload(payload);
+                            }
+                        }
+
+                        for (auto& payload : payloads)
+                        {
+                            pool.release_payload(payload);
+                        }
+                    }
+                });
+    }
+
+    while (ready < threads)
+    {
+        std::this_thread::yield();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go = true;
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    BenchmarkRun run;
+    run.seconds = seconds_since(start);
+    run.operations = threads * batches * BATCH_SIZE;
+    return run;
+}
+
+} /* namespace */
+
+void payload_pool_benchmarks(
+        BenchmarkRunner& runner)
+{
+    const std::uint64_t operations_per_thread = runner.scaled(OPERATIONS_PER_THREAD);
+
+    for (const std::string kind : {"fast", "map", "copy"})
+    {
+        for (const unsigned int threads : {1u, 2u, 4u, 8u})
+        {
+            for (const bool share : {false, true})
+            {
+                runner.run(
+                    share ? "payload_pool/reserve_share_release" : "payload_pool/reserve_release",
+                    {{"pool", kind}, {"threads", std::to_string(threads)}, {"size", std::to_string(PAYLOAD_SIZE)}},
+                    [&]()
+                    {
+                        auto pool = create_pool(kind);
+                        return reserve_release(*pool, threads, operations_per_thread, share);
+                    });
+            }
+        }
+    }
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,190 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file pipe.cpp
+ */
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+
+#include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
+#include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/SinkParticipantConfiguration.hpp>
+#include <ddspipe_participants/participant/auxiliar/GeneratorParticipant.hpp>
+#include <ddspipe_participants/participant/auxiliar/SinkParticipant.hpp>
+
+#include "suites/suites.hpp"
+
+// Defined in Track.cpp: tracks only forward data while this process is the master
+extern std::atomic<bool> master_flag;
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+//! Time [ms] the data is forwarded in each run
+constexpr const unsigned int DURATION_MS = 2000;
+
+//! Samples generated per second in each topic
+constexpr const double RATE = 20000;
+
+//! Threads of the pipe
+constexpr const unsigned int THREADS = 4;
+
+//! Parameters of a pipe benchmark
+struct PipeParameters
+{
+    unsigned int topics;
+    std::uint32_t payload_size;
+};
+
+//! Merge the latencies of \c source into \c target (both taken from histograms with the same buckets)
+void merge_latency(
+        core::LatencyDistributionSnapshot& target,
+        const core::LatencyDistributionSnapshot& source)
+{
+    std::map<std::uint64_t, std::uint64_t> buckets(target.buckets.begin(), target.buckets.end());
+    for (const auto& bucket : source.buckets)
+    {
+        buckets[bucket.first] += bucket.second;
+    }
+
+    target.buckets.assign(buckets.begin(), buckets.end());
+    target.count += source.count;
+    target.sum_ns += source.sum_ns;
+    target.max_ns = target.max_ns > source.max_ns ? target.max_ns : source.max_ns;
+}
+
+/**
+ * Forward the data of a generator participant to a sink participant through a DDS Pipe for \c duration_ms ,
+ * and measure the samples delivered, lost and their latency.
+ */
+BenchmarkRun loopback(
+        const PipeParameters& parameters,
+        const unsigned int duration_ms)
+{
+    auto discovery_database = std::make_shared<core::DiscoveryDatabase>();
+    auto payload_pool = std::make_shared<core::FastPayloadPool>();
+    auto participants_database = std::make_shared<core::ParticipantsDatabase>();
+    auto thread_pool = std::make_shared<utils::SlotThreadPool>(THREADS);
+
+    auto generator_configuration = std::make_shared<participants::GeneratorParticipantConfiguration>();
+    generator_configuration->id = "generator";
+    generator_configuration->topics = parameters.topics;
+    generator_configuration->rate = RATE;
+    generator_configuration->payload_size = parameters.payload_size;
+
+    auto sink_configuration = std::make_shared<participants::SinkParticipantConfiguration>();
+    sink_configuration->id = "sink";
+
+    auto generator = std::make_shared<participants::GeneratorParticipant>(
+        generator_configuration, payload_pool, discovery_database);
+    auto sink = std::make_shared<participants::SinkParticipant>(sink_configuration);
+
+    participants_database->add_participant(generator->id(), generator);
+    participants_database->add_participant(sink->id(), sink);
+
+    core::DdsPipeConfiguration pipe_configuration;
+    pipe_configuration.init_enabled = true;
+    pipe_configuration.master_flag = true;
+
+    master_flag = true;
+
+    std::unique_ptr<core::DdsPipe> pipe(new core::DdsPipe(
+                pipe_configuration,
+                discovery_database,
+                payload_pool,
+                participants_database,
+                thread_pool));
+
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+
+    const auto statistics = sink->statistics();
+    const std::uint64_t generated = generator->samples_generated();
+    const std::uint64_t skipped = generator->samples_skipped();
+
+    BenchmarkRun run;
+    run.seconds = seconds_since(start);
+
+    // Stop forwarding before the participants are destroyed
+    pipe.reset();
+
+    participants::SinkStatistics total;
+    for (const auto& topic : statistics)
+    {
+        total.samples += topic.second.samples;
+        total.lost += topic.second.lost;
+        total.duplicates += topic.second.duplicates;
+        total.out_of_order += topic.second.out_of_order;
+        total.bytes += topic.second.bytes;
+        merge_latency(total.latency, topic.second.latency);
+    }
+
+    run.operations = total.samples;
+    run.metrics["samples_generated"] = static_cast<double>(generated);
+    run.metrics["samples_skipped"] = static_cast<double>(skipped);
+    run.metrics["samples_lost"] = static_cast<double>(total.lost);
+    run.metrics["samples_duplicated"] = static_cast<double>(total.duplicates);
+    run.metrics["samples_out_of_order"] = static_cast<double>(total.out_of_order);
+    run.metrics["bytes_per_second"] = static_cast<double>(total.bytes) / run.seconds;
+    add_latency_metrics(run, "latency_", total.latency);
+
+    return run;
+}
+
+} /* namespace */
+
+void pipe_benchmarks(
+        BenchmarkRunner& runner)
+{
+    const unsigned int duration_ms = static_cast<unsigned int>(runner.scaled(DURATION_MS));
+
+    const PipeParameters cases[] = {
+        {1, 64},
+        {8, 64},
+        {8, 4096}};
+
+    for (const auto& parameters : cases)
+    {
+        runner.run(
+            "pipe/loopback",
+            {
+                {"topics", std::to_string(parameters.topics)},
+                {"payload_size", std::to_string(parameters.payload_size)},
+                {"rate", std::to_string(static_cast<unsigned int>(RATE))},
+                {"threads", std::to_string(THREADS)}},
+            [&]()
+            {
+                return loopback(parameters, duration_ms);
+            });
+    }
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
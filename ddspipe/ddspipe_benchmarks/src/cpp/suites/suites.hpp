@@ -0,0 +1,98 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file suites.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+#include "benchmark/Benchmark.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+//! Reserve and release of payloads in every Payload Pool, from several threads at once
+void payload_pool_benchmarks(
+        BenchmarkRunner& runner);
+
+//! Latency from the emission of a task to its execution in the Slot Thread Pool
+void thread_pool_benchmarks(
+        BenchmarkRunner& runner);
+
+//! Topic filtering by an Allowed Topic List with 1000 filters
+void allowed_topics_benchmarks(
+        BenchmarkRunner& runner);
+
+//! Additions, queries, updates and erasures in a Discovery Database of 50000 endpoints
+void discovery_database_benchmarks(
+        BenchmarkRunner& runner);
+
+//! Throughput and latency of a whole DDS Pipe from a generator participant to a sink participant
+void pipe_benchmarks(
+        BenchmarkRunner& runner);
+
+//! Discovery storms of 10000 to 100000 endpoints injected in a DDS Pipe, with several churn patterns
+void discovery_storm_benchmarks(
+        BenchmarkRunner& runner);
+
+//! Add the percentiles and maximum of \c latency to the metrics of \c run , with names starting by \c prefix
+inline void add_latency_metrics(
+        BenchmarkRun& run,
+        const std::string& prefix,
+        const core::LatencyDistributionSnapshot& latency)
+{
+    run.metrics[prefix + "p50_ns"] = static_cast<double>(latency.percentile_ns(0.5));
+    run.metrics[prefix + "p99_ns"] = static_cast<double>(latency.percentile_ns(0.99));
+    run.metrics[prefix + "p999_ns"] = static_cast<double>(latency.percentile_ns(0.999));
+    run.metrics[prefix + "max_ns"] = static_cast<double>(latency.max_ns);
+}
+
+/**
+ * @brief Latencies recorded in a histogram between the snapshots \c before and \c after .
+ *
+ * The maximum is the upper bound of the greatest bucket that has changed, as the real one is not known.
+ */
+inline core::LatencyDistributionSnapshot latency_difference(
+        const core::LatencyDistributionSnapshot& after,
+        const core::LatencyDistributionSnapshot& before)
+{
+    std::map<std::uint64_t, std::uint64_t> previous(before.buckets.begin(), before.buckets.end());
+
+    core::LatencyDistributionSnapshot difference;
+    for (const auto& bucket : after.buckets)
+    {
+        const std::uint64_t count = bucket.second - previous[bucket.first];
+        if (count > 0)
+        {
+            difference.buckets.emplace_back(bucket.first, count);
+            difference.count += count;
+            difference.max_ns = bucket.first < after.max_ns ? bucket.first : after.max_ns;
+        }
+    }
+    difference.sum_ns = after.sum_ns - before.sum_ns;
+
+    return difference;
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,151 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file thread_pool.cpp
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+
+#include "suites/suites.hpp"
+
+namespace eprosima {
+namespace ddspipe {
+namespace benchmarks {
+
+namespace {
+
+//! Tasks emitted in each run
+constexpr const std::uint64_t OPERATIONS = 20000;
+
+std::uint64_t now_ns() noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * Emit a task and wait until it has run before emitting the next one, measuring the time from each emission
+ * until the task starts running in a thread of the pool.
+ */
+BenchmarkRun emit_to_run(
+        const unsigned int threads,
+        const std::uint64_t operations)
+{
+    utils::SlotThreadPool pool(threads);
+    core::LatencyHistogram latency;
+
+    std::atomic<std::uint64_t> emitted_at(0);
+    std::atomic<std::uint64_t> executed(0);
+
+    const utils::TaskId task_id = utils::new_unique_task_id();
+    pool.slot(task_id, [&]()
+            {
+                latency.record(now_ns() - emitted_at.load());
+                executed++;
+            });
+    pool.enable();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 1; i <= operations; ++i)
+    {
+        emitted_at = now_ns();
+        pool.emit(task_id);
+        while (executed.load() < i)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    BenchmarkRun run;
+    run.seconds = seconds_since(start);
+    run.operations = operations;
+    add_latency_metrics(run, "", latency.snapshot());
+
+    pool.disable();
+    return run;
+}
+
+//! Emit every task at once and wait until all of them have run
+BenchmarkRun emit_all(
+        const unsigned int threads,
+        const std::uint64_t operations)
+{
+    utils::SlotThreadPool pool(threads);
+
+    std::atomic<std::uint64_t> executed(0);
+
+    const utils::TaskId task_id = utils::new_unique_task_id();
+    pool.slot(task_id, [&]()
+            {
+                executed++;
+            });
+    pool.enable();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < operations; ++i)
+    {
+        pool.emit(task_id);
+    }
+    while (executed.load() < operations)
+    {
+        std::this_thread::yield();
+    }
+
+    BenchmarkRun run;
+    run.seconds = seconds_since(start);
+    run.operations = operations;
+
+    pool.disable();
+    return run;
+}
+
+} /* namespace */
+
+void thread_pool_benchmarks(
+        BenchmarkRunner& runner)
+{
+    const std::uint64_t operations = runner.scaled(OPERATIONS);
+
+    for (const unsigned int threads : {1u, 4u})
+    {
+        runner.run(
+            "thread_pool/emit_to_run",
+            {{"threads", std::to_string(threads)}},
+            [&]()
+            {
+                return emit_to_run(threads, operations);
+            });
+
+        runner.run(
+            "thread_pool/emit_all",
+            {{"threads", std::to_string(threads)}},
+            [&]()
+            {
+                return emit_all(threads, operations);
+            });
+    }
+}
+
+} /* namespace benchmarks */
+} /* namespace ddspipe */
+} /* namespace eprosima */
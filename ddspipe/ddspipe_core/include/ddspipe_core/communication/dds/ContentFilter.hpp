@@ -0,0 +1,106 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/dynamic_types/CompiledContentFilter.hpp>
+#include <ddspipe_core/types/dynamic_types/ContentFilterExpression.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * ContentFilter discards the samples of a topic that do not match its content filter expression, before they are
+ * forwarded to any writer.
+ *
+ * It is shared by every \c Track of every \c DdsBridge with the same type and expression (see
+ * \c ContentFilterRegistry ). The expression is compiled once against the DynamicType of the topic type, as soon as
+ * it is known by the Fast DDS TypeObjectFactory (e.g. discovered by a \c DynTypesParticipant ). Until then, or if
+ * the expression cannot be compiled against the type, every sample is forwarded.
+ */
+class ContentFilter
+{
+public:
+
+    /**
+     * @brief Construct a ContentFilter.
+     *
+     * @param expression: Parsed content filter expression of the topic.
+     * @param type_name: Name of the data type of the topic.
+     */
+    DDSPIPE_CORE_DllAPI
+    ContentFilter(
+            const std::shared_ptr<const types::ContentFilterExpression>& expression,
+            const std::string& type_name);
+
+    /**
+     * @brief Whether \c data does not match the expression and must be discarded.
+     *
+     * Data that cannot be evaluated (not RTPS data, disposals or unsupported encapsulations) is never discarded.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    bool is_filtered_out(
+            const IRoutingData& data) noexcept;
+
+    //! Time between two attempts to find the DynamicType of the topic type.
+    DDSPIPE_CORE_DllAPI
+    static constexpr const std::chrono::milliseconds TYPE_LOOKUP_PERIOD {1000};
+
+protected:
+
+    //! Compiled expression, or nullptr if the type is not known yet or the expression cannot be compiled.
+    std::shared_ptr<const types::CompiledContentFilter> compiled_filter_() noexcept;
+
+    //! Look for the DynamicType of \c type_name_ in the TypeObjectFactory (nullptr if not found).
+    fastrtps::types::DynamicType_ptr find_dynamic_type_() const noexcept;
+
+    //! Name of the data type of the topic.
+    const std::string type_name_;
+
+    //! Parsed expression.
+    const std::shared_ptr<const types::ContentFilterExpression> expression_;
+
+    //! Compiled expression (only set once \c resolved_ ).
+    std::shared_ptr<const types::CompiledContentFilter> compiled_;
+
+    //! Whether the compilation has finished (either successfully or not), so \c compiled_ does not change anymore.
+    std::atomic<bool> resolved_;
+
+    //! Next time the DynamicType of the topic type is looked for.
+    std::chrono::steady_clock::time_point next_type_lookup_;
+
+    //! Whether a sample that could not be evaluated has been reported.
+    std::atomic<bool> evaluation_error_reported_;
+
+    //! Mutex to protect the compilation, as several Tracks share the filter.
+    std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,83 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <cpp_utils/types/Singleton.hpp>
+
+#include <ddspipe_core/communication/dds/ContentFilter.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/dynamic_types/ContentFilterExpression.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Registry of the content filter expressions and of the filters built from them.
+ *
+ * Expressions are parsed once, when the configuration is read, and the \c ContentFilter of a type and expression
+ * is shared by every \c DdsBridge that uses them, so it is compiled only once per type.
+ */
+class ContentFilterRegistry
+{
+public:
+
+    /**
+     * @brief Parsed \c expression , parsing it the first time it is requested.
+     *
+     * @throw \c ConfigurationException if the expression is not well formed.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<const types::ContentFilterExpression> expression(
+            const std::string& expression);
+
+    /**
+     * @brief Filter of \c expression for the topics of type \c type_name , creating it if no bridge uses it.
+     *
+     * @return nullptr if \c expression is not well formed (every sample is forwarded).
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<ContentFilter> filter(
+            const std::string& expression,
+            const std::string& type_name) noexcept;
+
+protected:
+
+    //! Expressions parsed, indexed by the expression as written by the user
+    std::map<std::string, std::shared_ptr<const types::ContentFilterExpression>> expressions_;
+
+    //! Filters in use, indexed by type name and expression
+    std::map<std::pair<std::string, std::string>, std::weak_ptr<ContentFilter>> filters_;
+
+    //! Protects \c expressions_ and \c filters_
+    std::mutex mutex_;
+};
+
+//! Registry shared by every bridge of the process
+using ProcessContentFilterRegistry = utils::Singleton<ContentFilterRegistry>;
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
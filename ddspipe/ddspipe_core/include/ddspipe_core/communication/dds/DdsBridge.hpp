@@ -114,7 +114,15 @@ public:
 
     DDSPIPE_CORE_DllAPI
     void change_master_flag(bool master_flag) noexcept;
-    
+
+    /**
+     * Number of samples of this topic received by every Track.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::uint64_t samples_received() noexcept;
+
 protected:
 
     /**
@@ -182,6 +190,18 @@ protected:
      */
     std::map<types::ParticipantId, std::unique_ptr<Track>> tracks_;
 
+    /**
+     * Filter shared by every Track to discard the data received through redundant routes.
+     * It is created with the first Track whose topic requires deduplication.
+     */
+    std::shared_ptr<DuplicateFilter> duplicate_filter_;
+
+    /**
+     * Filter shared by every Track to discard the data that does not match the content filter of the topic.
+     * It is created with the first Track whose topic has a content filter, so its expression is compiled only once.
+     */
+    std::shared_ptr<ContentFilter> content_filter_;
+
     //! Mutex to prevent simultaneous calls to enable and/or disable
     std::mutex mutex_;
 
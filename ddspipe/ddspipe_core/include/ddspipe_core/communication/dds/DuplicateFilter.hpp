@@ -0,0 +1,159 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * DuplicateFilter detects the samples of a topic that have already been forwarded, so the ones received again
+ * through a redundant route are not sent twice.
+ *
+ * It is shared by every \c Track of a \c DdsBridge , as each redundant route arrives through a different reader.
+ *
+ * Depending on the \c DeduplicationKind , a sample is identified by:
+ *  - SEQUENCE : the guid and sequence number it had in its original writer, which the proxies forward along with
+ *               it. A sliding window bitmap of the last \c window_size sequence numbers is kept for each original
+ *               guid, up to \c max_sources guids. The windows of the least recently seen guids are forgotten first,
+ *               so writers that left do not grow the filter. Samples older than the window are never duplicates,
+ *               as they cannot be told apart from samples that are only late.
+ *  - HASH : the hash of its payload and source timestamp, for routes where the sequence numbers are rewritten.
+ *           The hashes of the last \c window_size samples of the topic are kept.
+ */
+class DuplicateFilter
+{
+public:
+
+    /**
+     * @brief Construct a DuplicateFilter.
+     *
+     * @param kind: How the duplicated samples are detected.
+     * @param window_size: Number of samples remembered (per source guid in SEQUENCE kind).
+     * @param max_sources: Number of source guids remembered in SEQUENCE kind.
+     */
+    DDSPIPE_CORE_DllAPI
+    DuplicateFilter(
+            const types::DeduplicationKind& kind,
+            const unsigned int window_size = DEFAULT_WINDOW_SIZE,
+            const unsigned int max_sources = DEFAULT_MAX_SOURCES);
+
+    /**
+     * @brief Whether \c data has already been received.
+     *
+     * If it has not, it is registered so any later copy of it is considered a duplicate.
+     * Data that cannot be identified (not RTPS data or unknown original identity) is never a duplicate.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    bool is_duplicate(
+            const IRoutingData& data) noexcept;
+
+    //! Default number of samples remembered.
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_WINDOW_SIZE = 1024;
+
+    //! Default number of source guids remembered.
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_MAX_SOURCES = 256;
+
+protected:
+
+    //! Sliding window of the last sequence numbers received from a source guid.
+    struct SequenceWindow
+    {
+        //! Highest sequence number received.
+        std::uint64_t highest{0};
+
+        //! One bit per sequence number in ( \c highest - window_size , \c highest ].
+        std::vector<std::uint64_t> bitmap;
+
+        //! Position of its source guid in \c sources_order_ .
+        std::list<types::Guid>::iterator order_it;
+    };
+
+    //! Get the window of \c source_guid , creating it (and forgetting the least recently seen one) if needed.
+    SequenceWindow& sequence_window_nts_(
+            const types::Guid& source_guid) noexcept;
+
+    //! Check and register a sample by the guid and sequence number of its original writer.
+    bool is_sequence_duplicate_nts_(
+            const types::Guid& source_guid,
+            const std::uint64_t sequence_number) noexcept;
+
+    //! Check and register a sample by the hash of its payload and source timestamp.
+    bool is_hash_duplicate_nts_(
+            const types::Payload& payload,
+            const types::DataTime& source_timestamp) noexcept;
+
+    //! Whether the bit of \c sequence_number is set in \c window .
+    bool test_bit_(
+            const SequenceWindow& window,
+            const std::uint64_t sequence_number) const noexcept;
+
+    //! Set (or clear) the bit of \c sequence_number in \c window .
+    void set_bit_(
+            SequenceWindow& window,
+            const std::uint64_t sequence_number,
+            const bool value = true) const noexcept;
+
+    //! FNV-1a hash of the payload data and the source timestamp.
+    static std::uint64_t hash_payload_(
+            const types::Payload& payload,
+            const types::DataTime& source_timestamp) noexcept;
+
+    //! How the duplicated samples are detected.
+    const types::DeduplicationKind kind_;
+
+    //! Number of samples remembered (rounded up to a multiple of 64).
+    const unsigned int window_size_;
+
+    //! Number of source guids remembered.
+    const unsigned int max_sources_;
+
+    //! Sequence windows indexed by source guid.
+    std::map<types::Guid, SequenceWindow> sequence_windows_;
+
+    //! Source guids with a window, from the most to the least recently seen.
+    std::list<types::Guid> sources_order_;
+
+    //! Hashes of the last samples received, in order of arrival.
+    std::deque<std::uint64_t> hashes_order_;
+
+    //! Hashes of the last samples received, to look them up.
+    std::unordered_set<std::uint64_t> hashes_;
+
+    //! Mutex to protect the windows, as several Tracks share the filter.
+    std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -15,14 +15,23 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
 
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/memory/Heritable.hpp>
 
+#include <ddspipe_core/communication/dds/ContentFilter.hpp>
+#include <ddspipe_core/communication/dds/DuplicateFilter.hpp>
 #include <ddspipe_core/interface/IParticipant.hpp>
 #include <ddspipe_core/interface/IReader.hpp>
 #include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/metrics/EntityMetrics.hpp>
+#include <ddspipe_core/metrics/TopicLatencyMetrics.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
 
@@ -46,6 +55,10 @@ public:
      * @param topic:    Topic that this Track manages communication
      * @param reader:   Reader that will receive the remote data
      * @param writers:  Map of Writers that will send the data received by \c source indexed by Participant id
+     * @param duplicate_filter: Filter shared with the other Tracks of the topic to discard duplicated data (optional)
+     * @param content_filter: Filter shared with the other Tracks of the topic to discard non matching data (optional)
+     * @param conflate: Whether to forward only the latest sample per instance (as configured for the reader's
+     *                  participant, so it can differ from the \c conflate of \c topic )
      */
     DDSPIPE_CORE_DllAPI
     Track(
@@ -54,7 +67,10 @@ public:
             const std::shared_ptr<IReader>& reader,
             std::map<types::ParticipantId, std::shared_ptr<IWriter>>&& writers,
             const std::shared_ptr<PayloadPool>& payload_pool,
-            const std::shared_ptr<utils::SlotThreadPool>& thread_pool) noexcept;
+            const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+            const std::shared_ptr<DuplicateFilter>& duplicate_filter = nullptr,
+            const std::shared_ptr<ContentFilter>& content_filter = nullptr,
+            const bool conflate = false) noexcept;
 
     /**
      * @brief Destructor
@@ -137,6 +153,14 @@ public:
     DDSPIPE_CORE_DllAPI
     void change_master(bool flag) noexcept;
 
+    /**
+     * Number of samples taken by this Track from its reader, whether they were forwarded or not.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::uint64_t samples_received() const noexcept;
+
 protected:
 
     /*
@@ -187,6 +211,58 @@ protected:
      */
     void transmit_() noexcept;
 
+    /**
+     * Send \c data through every writer in \c writers_ .
+     *
+     * Errors in a writer are logged and do not prevent the data to be sent through the rest of writers.
+     */
+    void write_data_(
+            IRoutingData& data) noexcept;
+
+    /**
+     * Send \c data through \c writer .
+     *
+     * @return false if \c data is too old to be forwarded (and so it has not been written), true otherwise
+     */
+    bool write_data_(
+            const types::ParticipantId& writer_id,
+            IWriter& writer,
+            IRoutingData& data) noexcept;
+
+    /**
+     * Store \c data as the latest pending sample of its instance for every writer, replacing (and so discarding)
+     * any previous pending sample of that same instance, and write the pending samples that the writers can accept.
+     *
+     * Data that is not RTPS data cannot be conflated, and thus it is sent straight away.
+     */
+    void conflate_data_(
+            std::unique_ptr<IRoutingData>&& data) noexcept;
+
+    /**
+     * Write the pending conflated samples of each writer while it can accept them (see \c IWriter::can_accept ).
+     *
+     * The samples that a writer can not accept yet are kept, and retried when new data arrives or every
+     * \c CONFLATE_FLUSH_PERIOD_MS_ , so a slow writer only sends the latest sample of each instance once it has
+     * room for it.
+     */
+    void flush_conflated_data_() noexcept;
+
+    //! Wake up the Track if there are pending conflated samples, so they are retried
+    void retry_conflated_data_() noexcept;
+
+    //! Count a sample dropped by the Track in the metrics of the topic and the reader participant
+    void add_dropped_metric_(
+            const MetricKind kind) noexcept;
+
+    /**
+     * Whether \c data is older than the topic's \c max_age and thus it must not be forwarded.
+     *
+     * The age is calculated with the source timestamp of the data, so clocks of both hosts are expected to be
+     * synchronized. Data that is not RTPS data or does not have a source timestamp is never stale.
+     */
+    bool is_data_stale_(
+            const IRoutingData& data) const noexcept;
+
     //! Topic that refers to this Bridge
     const utils::Heritable<ITopic> topic_;
 
@@ -251,10 +327,50 @@ protected:
 
     const unsigned int transport_priority_id_;
 
+    //! Whether only the latest sample of each instance is forwarded (conflate topic QoS)
+    const bool conflate_;
+
+    /**
+     * Latest sample taken and not yet written of each instance, for each writer.
+     *
+     * Only used when \c conflate_ is set. It is protected by \c on_transmission_mutex_ .
+     */
+    std::map<types::ParticipantId, std::map<types::InstanceHandle, std::shared_ptr<IRoutingData>>> conflated_data_;
+
+    //! Number of samples in \c conflated_data_ (so it can be checked without locking the mutex)
+    std::atomic<std::size_t> conflated_pending_;
+
+    //! Handler that retries the pending conflated samples periodically (only if \c conflate_ is set)
+    std::unique_ptr<utils::event::PeriodicEventHandler> conflate_flush_handler_;
+
+    //! Maximum age of the data to be forwarded in nanoseconds (0 = no limit)
+    const std::int64_t max_age_ns_;
+
+    //! Number of samples taken from the reader
+    std::atomic<std::uint64_t> samples_received_;
+
+    //! Filter to discard the data already forwarded by another Track of the topic (nullptr if no deduplication)
+    std::shared_ptr<DuplicateFilter> duplicate_filter_;
+
+    //! Filter to discard the data that does not match the content filter of the topic (nullptr if no filter)
+    std::shared_ptr<ContentFilter> content_filter_;
+
+    //! Metrics of the topic
+    std::shared_ptr<EntityMetrics> topic_metrics_;
+
+    //! Metrics of the participant of the reader
+    std::shared_ptr<EntityMetrics> participant_metrics_;
+
+    //! Latency histograms of the topic
+    std::shared_ptr<TopicLatencyMetrics> topic_latency_metrics_;
+
     std::shared_ptr<utils::SlotThreadPool> thread_pool_;
 
     static const unsigned int MAX_MESSAGES_TRANSMIT_LOOP_;
 
+    //! Period to retry the pending conflated samples that the writers could not accept [ms]
+    static const unsigned int CONFLATE_FLUSH_PERIOD_MS_;
+
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
             std::ostream&,
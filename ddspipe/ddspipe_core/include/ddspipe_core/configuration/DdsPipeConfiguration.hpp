@@ -16,6 +16,7 @@
 
 #include <map>
 #include <set>
+#include <string>
 
 #include <cpp_utils/Formatter.hpp>
 #include <cpp_utils/macros/custom_enumeration.hpp>
@@ -23,6 +24,7 @@
 #include <ddspipe_core/configuration/IConfiguration.hpp>
 #include <ddspipe_core/configuration/RoutesConfiguration.hpp>
 #include <ddspipe_core/configuration/TopicRoutesConfiguration.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 #include <ddspipe_core/types/topic/filter/ManualTopic.hpp>
@@ -107,6 +109,9 @@ struct DdsPipeConfiguration : public IConfiguration
     //! Set of manually configured Topic QoS
     std::vector<ddspipe::core::types::ManualTopic> manual_topics{};
 
+    //! Topic QoS configured for every topic, imposed over the discovered ones
+    ddspipe::core::types::TopicQoS topic_qos{};
+
     //! Configuration of the generic routes.
     RoutesConfiguration routes{};
 
@@ -124,6 +129,21 @@ struct DdsPipeConfiguration : public IConfiguration
 
     //! The type of the entity whose discovery should trigger the discovery callbacks.
     DiscoveryTrigger discovery_trigger = DiscoveryTrigger::READER;
+
+    //! Number of threads that create and enable the bridges of the topics (0 to use as many threads as cores).
+    unsigned int bridge_creation_threads = 0;
+
+    //! File where the topics discovered are persisted, to create their bridges on startup (empty to disable).
+    std::string discovery_snapshot_file{};
+
+    //! Time between two snapshots of the topics discovered [ms].
+    unsigned int discovery_snapshot_period = 5000;
+
+    //! Time after startup after which the topics of the snapshot that have not been discovered again are removed [ms].
+    unsigned int discovery_snapshot_reconcile_timeout = 30000;
+
+    //! Time without samples nor relevant endpoints after which the bridge of a topic is destroyed [ms] (0 = never).
+    unsigned int idle_bridge_ttl = 0;
 };
 
 } /* namespace core */
@@ -0,0 +1,95 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Differences between two \c DdsPipeConfiguration , so a reload only applies what has changed.
+ *
+ * The attributes that cannot be changed in a running \c DdsPipe are listed in \c not_reloadable .
+ */
+struct DdsPipeConfigurationDiff
+{
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    //! Compare \c old_configuration with \c new_configuration
+    DDSPIPE_CORE_DllAPI
+    DdsPipeConfigurationDiff(
+            const DdsPipeConfiguration& old_configuration,
+            const DdsPipeConfiguration& new_configuration) noexcept;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    //! Whether both configurations are the same
+    DDSPIPE_CORE_DllAPI
+    bool empty() const noexcept;
+
+    //! Whether any change requires to rebuild the bridges of the topics affected by it
+    DDSPIPE_CORE_DllAPI
+    bool affects_bridges() const noexcept;
+
+    /**
+     * @brief Whether the bridge of \c topic must be rebuilt to apply the new configuration.
+     *
+     * It is the case if its routes, the manual topics that match it or the configured Topic QoS have changed.
+     */
+    DDSPIPE_CORE_DllAPI
+    static bool affects_topic(
+            const DdsPipeConfiguration& old_configuration,
+            const DdsPipeConfiguration& new_configuration,
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether the allowlist or the blocklist have changed
+    bool allowed_topics = false;
+
+    //! Whether the master flag has changed
+    bool master_flag = false;
+
+    //! Whether the generic routes have changed
+    bool routes = false;
+
+    //! Whether the routes specific to a topic have changed
+    bool topic_routes = false;
+
+    //! Whether the manual topics have changed
+    bool manual_topics = false;
+
+    //! Whether the Topic QoS configured for every topic has changed
+    bool topic_qos = false;
+
+    //! Name of the attributes that have changed but cannot be applied without restarting
+    std::vector<std::string> not_reloadable{};
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
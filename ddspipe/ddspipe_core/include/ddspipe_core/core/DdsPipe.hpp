@@ -14,18 +14,28 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <map>
 #include <memory>
+#include <thread>
 
 #include <cpp_utils/ReturnCode.hpp>
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 
 #include <ddspipe_core/communication/dds/DdsBridge.hpp>
 #include <ddspipe_core/communication/rpc/RpcBridge.hpp>
 #include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
+#include <ddspipe_core/configuration/DdsPipeConfigurationDiff.hpp>
 #include <ddspipe_core/dynamic/AllowedTopicList.hpp>
 #include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
 #include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/tasks/SerialTaskPool.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+#include <ddspipe_core/metrics/MonitoredMutex.hpp>
 
 #include <ddspipe_core/library/library_dll.h>
 
@@ -84,14 +94,16 @@ public:
     /**
      * @brief Reload the DdsPipe configuration.
      *
+     * Only the differences with the current configuration are applied: the allowed topics and master flag are
+     * updated in place, and only the bridges whose routes, manual topics or Topic QoS have changed are rebuilt.
+     * The attributes that cannot be reloaded are ignored with a warning.
+     *
      * @param [in] new_configuration : new configuration.
      *
      * @return \c RETCODE_OK if the configuration has been updated correctly.
      * @return \c RETCODE_NO_DATA if the new configuration has not changed.
      * @return \c RETCODE_ERROR if any other error has occurred.
      *
-     * @note This method checks that the new configuration file is valid and calls \c reload_allowed_topics_
-     *
      * @throw \c ConfigurationException in case the new yaml is not well-formed.
      */
     DDSPIPE_CORE_DllAPI
@@ -129,6 +141,23 @@ public:
     DDSPIPE_CORE_DllAPI
     void reload_master_flag(bool master_flag) noexcept;
 
+    /////////////////////////
+    // STATISTICS METHODS
+    /////////////////////////
+
+    /**
+     * @brief Times [ns] the internal mutex has been held.
+     *
+     * The mutex serializes the discovery callbacks and the bridge management, so long hold times delay the
+     * creation of the bridges (e.g. in discovery storms).
+     */
+    DDSPIPE_CORE_DllAPI
+    LatencyDistributionSnapshot mutex_hold_times() const noexcept;
+
+    //! Times [ns] waited to lock the internal mutex
+    DDSPIPE_CORE_DllAPI
+    LatencyDistributionSnapshot mutex_wait_times() const noexcept;
+
 protected:
 
     /////////////////////////
@@ -150,42 +179,49 @@ protected:
      * @return \c RETCODE_NO_DATA if the new allowed topics have not changed.
      * @return \c RETCODE_ERROR if any other error has occurred.
      */
-    utils::ReturnCode reload_allowed_topics_(
+    utils::ReturnCode reload_allowed_topics_nts_(
             const std::shared_ptr<AllowedTopicList>& allowed_topics);
 
-    /////////////////////////
-    // CALLBACK METHODS
-    /////////////////////////
+    //! Set the master flag of the configuration and every bridge
+    void reload_master_flag_nts_(
+            bool master_flag) noexcept;
 
     /**
-     * @brief Method called every time a new endpoint has been discovered
+     * @brief Destroy the bridge of \c topic and create it again with the current configuration.
      *
-     * This method calls \c discovered_endpoint_nts_ with a lock on the mutex to make it thread safe.
+     * The bridge is rebuilt in \c bridge_tasks_ , after any pending operation over it, and only if the topic is
+     * active. The rest of the bridges keep forwarding data meanwhile.
      *
-     * @param [in] endpoint : endpoint discovered
+     * @param [in] topic : topic whose bridge is rebuilt (it replaces the one stored in \c current_topics_ )
      */
-    void discovered_endpoint_(
-            const types::Endpoint& endpoint) noexcept;
+    void rebuild_topic_nts_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /////////////////////////
+    // CALLBACK METHODS
+    /////////////////////////
 
     /**
-     * @brief Method called every time a new endpoint has been updated
+     * @brief Method called every time the discovery database has processed a batch of operations
      *
-     * This method calls \c updated_endpoint_nts_ with a lock on the mutex to make it thread safe.
+     * This method calls \c processed_batch_nts_ with a lock on the mutex to make it thread safe.
      *
-     * @param [in] endpoint : endpoint updated
+     * @param [in] batch : operations performed in the database
      */
-    void updated_endpoint_(
-            const types::Endpoint& endpoint) noexcept;
+    void processed_batch_(
+            const std::vector<DatabaseEvent>& batch) noexcept;
 
     /**
-     * @brief Method called every time an endpoint has been removed/dropped
+     * @brief Process a batch of discovery database operations at once
      *
-     * This method calls \c removed_endpoint_nts_ with a lock on the mutex to make it thread safe.
+     * The operations of every topic and discoverer participant are coalesced, so a topic is only discovered (or
+     * removed) once per batch, when its number of relevant active endpoints changes from 0 (or to 0).
+     * Service endpoints are processed one by one with \c discovered_endpoint_nts_ and \c removed_endpoint_nts_ .
      *
-     * @param [in] endpoint : endpoint removed/dropped
+     * @param [in] batch : operations performed in the database
      */
-    void removed_endpoint_(
-            const types::Endpoint& endpoint) noexcept;
+    void processed_batch_nts_(
+            const std::vector<DatabaseEvent>& batch) noexcept;
 
     /**
      * @brief Method called every time a new endpoint has been discovered
@@ -206,14 +242,26 @@ protected:
             const types::Endpoint& endpoint) noexcept;
 
     /**
-     * @brief Method called every time a new endpoint has been updated
+     * @brief Remove the writer of the participant that discovered \c topic from its bridge.
      *
-     * This method calls \c discovered_endpoint_nts_ or \c removed_endpoint_nts_.
+     * Called when the last relevant endpoint of a topic discovered by a participant has been removed/dropped,
+     * only if unused entities must be removed.
      *
-     * @param [in] endpoint : endpoint updated
+     * @param [in] topic : topic removed/dropped.
      */
-    void updated_endpoint_nts_(
-            const types::Endpoint& endpoint) noexcept;
+    void removed_topic_nts_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /**
+     * @brief Forget a topic and destroy its bridge.
+     *
+     * The bridge is destroyed in \c bridge_tasks_ , after any pending operation over it.
+     * If the topic is discovered again, it is handled as a new one.
+     *
+     * @param [in] topic : topic to remove.
+     */
+    void remove_topic_nts_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
 
     /**
      * @brief Check whether the kind of an endpoint matches the discovery trigger kind.
@@ -227,6 +275,21 @@ protected:
     bool is_endpoint_kind_relevant_(
             const types::Endpoint& endpoint) noexcept;
 
+    /**
+     * @brief Number of active endpoints of a topic discovered by a participant whose kind matches the discovery
+     * trigger.
+     *
+     * @param [in] topic : topic of the endpoints.
+     * @param [in] discoverer_participant_id : id of the participant that discovered the endpoints.
+     */
+    std::size_t count_relevant_endpoints_(
+            const ITopic& topic,
+            const types::ParticipantId& discoverer_participant_id) noexcept;
+
+    //! Number of active endpoints of a topic (discovered by any participant) whose kind matches the discovery trigger
+    std::size_t count_relevant_endpoints_(
+            const ITopic& topic) noexcept;
+
     /**
      * @brief Check whether an endpoint is the first endpoint discovered or the last removed.
      *
@@ -250,6 +313,29 @@ protected:
     void init_bridges_nts_(
             const std::set<utils::Heritable<types::DistributedTopic>>& builtin_topics);
 
+    /**
+     * @brief Add the allowed topics of the discovery snapshot as discovered, so their bridges are created and
+     * enabled before their endpoints are discovered again.
+     *
+     * Only the topics with endpoints of the kind of the discovery trigger are added.
+     */
+    void init_snapshot_topics_nts_() noexcept;
+
+    /**
+     * @brief Remove the topics of the discovery snapshot that have not been discovered again.
+     *
+     * Called once \c discovery_snapshot_reconcile_timeout has elapsed since the construction.
+     */
+    void reconcile_snapshot_topics_() noexcept;
+
+    /**
+     * @brief Remove the topics whose bridge has not received any sample, and that have had no relevant endpoints,
+     * for longer than \c idle_bridge_ttl .
+     *
+     * Builtin topics are never removed. A removed topic is created again as soon as it is rediscovered.
+     */
+    void reclaim_idle_bridges_() noexcept;
+
     /////////////////////////
     // INTERNAL AUXILIARY METHODS
     /////////////////////////
@@ -309,6 +395,64 @@ protected:
             const utils::Heritable<types::DistributedTopic>& topic,
             bool enabled = false) noexcept;
 
+    /**
+     * @brief Create a \c DdsBridge object (with its entities) for \c topic .
+     *
+     * It does not access any variable protected by \c mutex_ , so it can be called without it.
+     *
+     * @param [in] topic : topic of the bridge
+     * @param [in] master_flag : whether the bridge writers send data
+     * @param [in] routes_config : routes of the topic
+     * @param [in] manual_topics : manual topics that match the topic
+     *
+     * @return the bridge created, or nullptr if its creation failed.
+     */
+    std::shared_ptr<DdsBridge> create_bridge_(
+            const utils::Heritable<types::DistributedTopic>& topic,
+            const bool master_flag,
+            const RoutesConfiguration& routes_config,
+            const std::vector<types::ManualTopic>& manual_topics) noexcept;
+
+    /**
+     * @brief Create in \c bridge a writer for every participant (other than the topic discoverer) that has
+     * relevant endpoints of its topic.
+     *
+     * Used when \c remove_unused_entities is set, to restore the writers of a rebuilt bridge.
+     */
+    void create_discovered_writers_(
+            const utils::Heritable<types::DistributedTopic>& topic,
+            const std::shared_ptr<DdsBridge>& bridge) noexcept;
+
+    /**
+     * @brief Bridge of \c topic , or nullptr if it does not exist.
+     *
+     * Thread safe
+     */
+    std::shared_ptr<DdsBridge> find_bridge_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /**
+     * @brief Add a task over the bridge of \c topic to \c bridge_tasks_ .
+     *
+     * The tasks of a topic are executed in order, after the previous ones, without \c mutex_ locked.
+     *
+     * @param [in] topic : topic of the bridge
+     * @param [in] task : task to execute
+     */
+    void emit_bridge_task_nts_(
+            const utils::Heritable<types::DistributedTopic>& topic,
+            SerialTaskPool::Task&& task) noexcept;
+
+    /**
+     * @brief Create the bridge of \c topic if it does not exist and enable it.
+     *
+     * Executed in \c bridge_tasks_ , so the RTPS entities are created without \c mutex_ locked.
+     *
+     * @param [in] topic : topic of the bridge
+     */
+    void activate_bridge_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
     /**
      * @brief Create a new \c RpcBridge object
      *
@@ -323,6 +467,7 @@ protected:
      * @brief Enable a specific topic
      *
      * If the topic did not exist before, the Bridge is created.
+     * The Bridge is created and enabled asynchronously in \c bridge_tasks_ .
      *
      * @param [in] topic : Topic to be enabled
      */
@@ -393,8 +538,16 @@ protected:
     // INTERNAL DATA STORAGE
     /////////////////////////
 
+    /**
+     * @brief Pool that creates, enables and disables the bridges.
+     *
+     * The bridges of different topics are handled in parallel, while the operations over the same topic are
+     * serialized. This way, \c mutex_ is not held while the RTPS entities are created.
+     */
+    std::unique_ptr<SerialTaskPool> bridge_tasks_;
+
     //! Map of bridges indexed by their topic
-    std::map<utils::Heritable<types::DistributedTopic>, std::unique_ptr<DdsBridge>> bridges_;
+    std::map<utils::Heritable<types::DistributedTopic>, std::shared_ptr<DdsBridge>> bridges_;
 
     //! Map of RPC bridges indexed by their topic
     std::map<types::RpcTopic, std::unique_ptr<RpcBridge>> rpc_bridges_;
@@ -415,6 +568,31 @@ protected:
      */
     std::map<types::RpcTopic, bool> current_services_;
 
+    //! Topics added from the discovery snapshot that have not been reconciled with the live discovery yet
+    std::set<utils::Heritable<types::DistributedTopic>> snapshot_topics_;
+
+    //! Thread that reconciles \c snapshot_topics_ once the reconcile timeout elapses, and then finishes
+    std::thread snapshot_reconcile_thread_;
+
+    //! Set to stop waiting for the reconcile timeout, so \c snapshot_reconcile_thread_ finishes without reconciling
+    std::promise<void> snapshot_reconcile_cancel_;
+
+    //! Activity of a bridge, to know for how long it has been idle
+    struct BridgeActivity
+    {
+        //! Samples received by the bridge in the last check
+        std::uint64_t samples_received;
+
+        //! Last check in which the bridge had received samples or had relevant endpoints
+        std::chrono::steady_clock::time_point last_activity;
+    };
+
+    //! Activity of each bridge in the last idle check
+    std::map<utils::Heritable<types::DistributedTopic>, BridgeActivity> bridges_activity_;
+
+    //! Handler that removes the idle bridges periodically (only if \c idle_bridge_ttl is set)
+    std::unique_ptr<utils::event::PeriodicEventHandler> idle_bridges_handler_;
+
     /////////////////////
     // AUXILIAR VARIABLES
     /////////////////////
@@ -424,8 +602,10 @@ protected:
 
     /**
      * @brief Internal mutex for concurrent calls
+     *
+     * It measures its wait and hold times, reported by \c mutex_hold_times and \c mutex_wait_times .
      */
-    mutable std::mutex mutex_;
+    mutable MonitoredMutex mutex_;
 };
 
 } /* namespace core */
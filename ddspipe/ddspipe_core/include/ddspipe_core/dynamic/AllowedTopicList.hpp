@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -26,6 +28,7 @@
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
 #include <ddspipe_core/types/topic/filter/IFilterTopic.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
+#include <ddspipe_core/dynamic/TopicFilterMatcher.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -38,6 +41,11 @@ namespace core {
  *
  * In case of an empty allowlist, every topic is allowed except those in blocklist.
  * In case of both lists empty, every topic is allowed.
+ *
+ * The lists are compiled into a \c TopicFilterMatcher each, and the decision taken for each DDS topic is cached.
+ * Both are replaced at once whenever the lists change, so checking a topic never locks a mutex.
+ * The compiled lists are published through a raw pointer, and the replaced ones are released once every check that
+ * could be using them has finished (an RCU-like grace period tracked with an epoch and two reader counters).
  */
 class AllowedTopicList
 {
@@ -77,6 +85,8 @@ public:
      * @param topic: topic to check if it is allowed
      *
      * @return True if the topic is allowed, false otherwise
+     *
+     * Lock free
      */
     DDSPIPE_CORE_DllAPI
     bool is_topic_allowed(
@@ -115,6 +125,87 @@ public:
 
 protected:
 
+    /**
+     * Decisions taken for the DDS topics already checked, indexed by their name and type.
+     *
+     * It is an open addressing table of a fixed number of slots, each of them set only once with an immutable
+     * decision, so it is read and written without locking and without copying. A decision is not stored if no free
+     * slot is found within \c MAX_PROBES of its position; that topic is checked against the lists every time.
+     */
+    class DecisionCache
+    {
+    public:
+
+        DecisionCache() noexcept;
+
+        //! Release the decisions stored (no check may be using them anymore)
+        ~DecisionCache();
+
+        //! Get the decision taken for \c key , if any
+        bool find(
+                const std::string& key,
+                bool& allowed) const noexcept;
+
+        //! Store the decision taken for \c key
+        void insert(
+                const std::string& key,
+                const bool allowed) noexcept;
+
+        //! Number of slots of the cache
+        static constexpr const std::size_t NUMBER_OF_SLOTS = 4096;
+
+        //! Maximum number of slots visited to find or store a decision
+        static constexpr const std::size_t MAX_PROBES = 32;
+
+    protected:
+
+        //! Decision taken for a topic, never modified once stored
+        struct Decision
+        {
+            std::string key;
+            bool allowed;
+        };
+
+        //! Slots, nullptr until a decision is stored in them
+        std::array<std::atomic<const Decision*>, NUMBER_OF_SLOTS> slots_;
+    };
+
+    //! Lists compiled, along with the decisions taken with them
+    struct CompiledLists
+    {
+        CompiledLists(
+                const std::set<utils::Heritable<types::IFilterTopic>>& allowlist,
+                const std::set<utils::Heritable<types::IFilterTopic>>& blocklist);
+
+        //! Whether \c topic is allowed by these lists (not cached)
+        bool is_topic_allowed(
+                const ITopic& topic) const noexcept;
+
+        TopicFilterMatcher allowlist;
+
+        TopicFilterMatcher blocklist;
+
+        mutable DecisionCache decisions;
+    };
+
+    //! Compile the current lists and replace \c compiled_ , discarding the decisions cached
+    void compile_nts_();
+
+    //! Register a check in the current epoch, so the lists it reads are not released meanwhile
+    std::size_t begin_read_() const noexcept;
+
+    //! Unregister a check registered by \c begin_read_ with the reader counter it returned
+    void end_read_(
+            const std::size_t reader_counter) const noexcept;
+
+    //! Wait until every check that could be reading lists already replaced has finished
+    void wait_for_readers_nts_() const noexcept;
+
+    //! Whether \c topic is allowed by \c compiled , using its cached decision if any
+    static bool is_topic_allowed_(
+            const CompiledLists& compiled,
+            const ITopic& topic) noexcept;
+
     /**
      * @brief Get a list of filtered topics and return a list that filters repeated topics eliminating redundancy
      *
@@ -130,7 +221,16 @@ protected:
     //! List of topics that are allowed
     std::set<utils::Heritable<types::IFilterTopic>> allowlist_;
 
-    //! Mutex to restrict access to the class
+    //! Lists compiled, owned by this object and only replaced with the mutex taken
+    std::atomic<const CompiledLists*> compiled_;
+
+    //! Epoch of the checks, whose parity selects the reader counter new checks register in
+    mutable std::atomic<std::size_t> epoch_;
+
+    //! Number of checks running, registered in the counter of the parity of the epoch when they began
+    mutable std::array<std::atomic<std::size_t>, 2> readers_;
+
+    //! Mutex to restrict the modification of the lists
     mutable std::recursive_mutex mutex_;
 
     // Allow operator << to use private variables
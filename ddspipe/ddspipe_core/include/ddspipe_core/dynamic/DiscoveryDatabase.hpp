@@ -19,16 +19,23 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 #include <fastrtps/utils/DBQueue.h>
 
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
 #include <ddspipe_core/types/dds/Endpoint.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
+#include <ddspipe_core/dynamic/DiscoverySnapshot.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -42,6 +49,21 @@ enum class DatabaseOperation
     erase
 };
 
+/**
+ * Operation performed in a DiscoveryDatabase, as notified to the batch callbacks.
+ */
+struct DatabaseEvent
+{
+    //! Operation performed
+    DatabaseOperation operation;
+
+    //! Endpoint added or updated (as stored after the operation), or endpoint erased
+    types::Endpoint endpoint;
+
+    //! Whether an active endpoint with the same guid was in the database before the operation
+    bool was_active;
+};
+
 /**
  * Class that stores a collection of discovered remote (not belonging to this DdsPipe) Endpoints.
  */
@@ -102,6 +124,60 @@ public:
     bool endpoint_exists(
             const types::Guid& guid) const noexcept;
 
+    //! Whether this guid is in the database and the endpoint is active
+    DDSPIPE_CORE_DllAPI
+    bool endpoint_active(
+            const types::Guid& guid) const noexcept;
+
+    /**
+     * @brief Number of Endpoints (active or not) in the database with this topic
+     *
+     * @param [in] topic: topic of the endpoints to count
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t count_endpoints(
+            const types::DdsTopic& topic) const noexcept;
+
+    /**
+     * @brief Number of active Endpoints in the database with this topic, discoverer participant and kind
+     *
+     * It does not copy any Endpoint, so it should be preferred over \c get_endpoints in the discovery path.
+     *
+     * @param [in] topic: topic of the endpoints to count
+     * @param [in] discoverer_participant_id: id of the participant that discovered the endpoints
+     * @param [in] kind: kind of the endpoints to count
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t count_active_endpoints(
+            const ITopic& topic,
+            const types::ParticipantId& discoverer_participant_id,
+            const types::EndpointKind kind) const noexcept;
+
+    /**
+     * @brief Number of active Endpoints in the database with this topic and kind, whatever participant discovered them
+     *
+     * @param [in] topic: topic of the endpoints to count
+     * @param [in] kind: kind of the endpoints to count
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t count_active_endpoints(
+            const ITopic& topic,
+            const types::EndpointKind kind) const noexcept;
+
+    /**
+     * @brief Persist periodically the topics with active endpoints in \c file_path .
+     *
+     * The snapshot is only written when the topics have changed since the last one, and once more when the
+     * database is stopped. It can be read with \c DiscoverySnapshot::load to warm restart.
+     *
+     * @param [in] file_path: file where the snapshot is written
+     * @param [in] period: time between snapshots [ms]
+     */
+    DDSPIPE_CORE_DllAPI
+    void enable_snapshot(
+            const std::string& file_path,
+            const utils::Duration_ms period) noexcept;
+
     /**
      * @brief Insert endpoint to the database
      *
@@ -152,6 +228,8 @@ public:
     /**
      * @brief Get the endpoints that pass the given filter
      *
+     * @note This iterates and copies the whole database. Use the count methods when possible.
+     *
      * @return A map with the endpoints that pass the filter
      */
     DDSPIPE_CORE_DllAPI
@@ -186,7 +264,20 @@ public:
             std::function<void(types::Endpoint)> endpoint_erased_callback) noexcept;
 
     /**
-     * @brief Remove all callbacks from all types (endpoint discovered, updated and erased)
+     * @brief Add callback to be called once per batch of operations processed
+     *
+     * Operations are queued and processed in batches by a dedicated thread. Once a batch has been applied to the
+     * database, this callback receives every operation of the batch that succeeded, in order. This allows to process
+     * a burst of discovery events at once, instead of one by one.
+     *
+     * @param [in] batch_processed_callback: callback to add
+     */
+    DDSPIPE_CORE_DllAPI
+    void add_batch_processed_callback(
+            std::function<void(const std::vector<DatabaseEvent>&)> batch_processed_callback) noexcept;
+
+    /**
+     * @brief Remove all callbacks from all types (endpoint discovered, updated, erased and batch processed)
      *
      */
     DDSPIPE_CORE_DllAPI
@@ -244,10 +335,37 @@ protected:
     DDSPIPE_CORE_DllAPI
     void process_queue_() noexcept;
 
+    //! Add \c endpoint to the secondary indexes. Must be called with \c mutex_ locked.
+    DDSPIPE_CORE_DllAPI
+    void index_endpoint_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
+    //! Remove \c endpoint from the secondary indexes. Must be called with \c mutex_ locked.
+    DDSPIPE_CORE_DllAPI
+    void unindex_endpoint_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
+    //! Topics with active endpoints, and the kinds of their endpoints
+    DDSPIPE_CORE_DllAPI
+    std::vector<DiscoverySnapshot::Entry> snapshot_entries_() const noexcept;
+
+    //! Write the snapshot if the topics have changed since the last one
+    DDSPIPE_CORE_DllAPI
+    void save_snapshot_() noexcept;
+
+    //! Key of \c active_endpoints_index_ : topic unique name, discoverer participant id and endpoint kind
+    using ActiveEndpointsKey = std::tuple<std::string, types::ParticipantId, types::EndpointKind>;
+
     //! Database of endpoints indexed by guid
     std::map<types::Guid, types::Endpoint> entities_;
 
-    //! Mutex to guard queries to the database
+    //! Guids of every endpoint in \c entities_ indexed by topic unique name
+    std::map<std::string, std::set<types::Guid>> topic_index_;
+
+    //! Guids of the active endpoints in \c entities_ indexed by topic, discoverer participant and kind
+    std::map<ActiveEndpointsKey, std::set<types::Guid>> active_endpoints_index_;
+
+    //! Mutex to guard queries to the database (and its indexes)
     mutable std::shared_timed_mutex mutex_;
 
     //! Vector of callbacks to be called when an Endpoint is added
@@ -259,6 +377,9 @@ protected:
     //! Vector of callbacks to be called when an Endpoint is erased
     std::vector<std::function<void(types::Endpoint)>> erased_endpoint_callbacks_;
 
+    //! Vector of callbacks to be called when a batch of operations has been processed
+    std::vector<std::function<void(const std::vector<DatabaseEvent>&)>> batch_processed_callbacks_;
+
     //! Mutex to guard callbacks vectors
     mutable std::mutex callbacks_mutex_;
 
@@ -279,6 +400,18 @@ protected:
 
     //! Flag to indicate whether the DiscoveryDatabase was initialized
     std::atomic<bool> enabled_;
+
+    //! File where the snapshots are written (empty if disabled)
+    std::string snapshot_file_path_;
+
+    //! Whether the topics with active endpoints have changed since the last snapshot
+    std::atomic<bool> snapshot_outdated_;
+
+    //! Mutex to prevent writing two snapshots at the same time
+    std::mutex snapshot_mutex_;
+
+    //! Handler that writes the snapshots periodically
+    std::unique_ptr<utils::event::PeriodicEventHandler> snapshot_handler_;
 };
 
 } /* namespace core */
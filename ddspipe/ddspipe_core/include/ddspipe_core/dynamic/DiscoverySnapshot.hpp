@@ -0,0 +1,87 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Compact snapshot of the topics discovered, persisted in a local file so the bridges can be created before
+ * rediscovering every endpoint after a restart.
+ *
+ * The file is a text file with one topic per line: name, type, the QoS obtained from discovery (durability,
+ * reliability, ownership, keyed and partitions), whether the topic had active readers and writers, and its
+ * history depth. The fields are separated by tabs.
+ *
+ * Snapshots of the previous version (without history depth) are still read, leaving the history depth unset.
+ */
+class DiscoverySnapshot
+{
+public:
+
+    //! Topic stored in a snapshot
+    struct Entry
+    {
+        //! Topic with the QoS discovered
+        types::DdsTopic topic;
+
+        //! Whether the topic had any active reader
+        bool has_readers;
+
+        //! Whether the topic had any active writer
+        bool has_writers;
+    };
+
+    /**
+     * @brief Write \c entries to \c file_path .
+     *
+     * The snapshot is written to a temporary file that then replaces \c file_path , so a crash while writing never
+     * leaves a truncated snapshot.
+     *
+     * @return whether the snapshot has been written
+     */
+    DDSPIPE_CORE_DllAPI
+    static bool save(
+            const std::string& file_path,
+            const std::vector<Entry>& entries) noexcept;
+
+    /**
+     * @brief Read the entries stored in \c file_path .
+     *
+     * Malformed lines are skipped.
+     *
+     * @return the entries read (empty if the file does not exist)
+     */
+    DDSPIPE_CORE_DllAPI
+    static std::vector<Entry> load(
+            const std::string& file_path) noexcept;
+
+    //! First line of every snapshot file, to recognise its format
+    static constexpr const char* HEADER = "# ddspipe discovery snapshot v2";
+
+    //! First line of the snapshot files of the previous version
+    static constexpr const char* HEADER_V1 = "# ddspipe discovery snapshot v1";
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
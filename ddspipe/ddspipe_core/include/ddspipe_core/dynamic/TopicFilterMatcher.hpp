@@ -0,0 +1,160 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/memory/Heritable.hpp>
+
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/topic/filter/IFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Glob pattern compiled into a nondeterministic automaton, with the same semantics as \c utils::match_pattern
+ * (\c fnmatch without escape character): \c * matches any sequence, \c ? any character and \c [...] any
+ * character in the set (\c [!...] or \c [^...] for any character not in it).
+ *
+ * Matching a string takes linear time in its length times the length of the pattern, with no backtracking.
+ * Patterns with unterminated sets or POSIX classes inside a set are matched with \c utils::match_pattern instead.
+ */
+class GlobPattern
+{
+public:
+
+    //! Compile \c pattern
+    DDSPIPE_CORE_DllAPI
+    GlobPattern(
+            const std::string& pattern);
+
+    //! Whether the substring of \c str starting in \c from matches the pattern
+    DDSPIPE_CORE_DllAPI
+    bool matches(
+            const std::string& str,
+            const std::size_t from = 0) const noexcept;
+
+protected:
+
+    //! Element of the pattern, that matches one character (or any sequence if it is a star)
+    struct Token
+    {
+        enum class Kind
+        {
+            literal,
+            any,
+            set,
+            star,
+        };
+
+        Kind kind;
+
+        //! Character of a literal token
+        char character;
+
+        //! Whether the set matches the characters not in it
+        bool negated;
+
+        //! Inclusive ranges of characters of a set
+        std::vector<std::pair<unsigned char, unsigned char>> ranges;
+
+        //! Whether this token (not being a star) consumes \c c
+        bool accepts(
+                const char c) const noexcept;
+    };
+
+    //! Tokens of the pattern, with no consecutive stars
+    std::vector<Token> tokens_;
+
+    //! Pattern that cannot be compiled (unterminated set or POSIX class), matched with \c utils::match_pattern
+    //! (empty otherwise)
+    std::string unsupported_pattern_;
+};
+
+/**
+ * TopicFilterMatcher compiles a set of filter topics to check whether any of them matches a topic.
+ *
+ * The topic name patterns of \c WildcardDdsFilterTopic filters are split into their literal prefix, stored in a
+ * trie, and the rest of the pattern, compiled into a \c GlobPattern . Matching a topic walks the trie along its
+ * name, so only the filters whose prefix matches are evaluated, instead of calling \c fnmatch for every filter.
+ * Filters of any other kind are evaluated as they are.
+ *
+ * It is immutable once constructed, so it can be read from several threads without locking.
+ */
+class TopicFilterMatcher
+{
+public:
+
+    //! Compile \c filters
+    DDSPIPE_CORE_DllAPI
+    TopicFilterMatcher(
+            const std::set<utils::Heritable<types::IFilterTopic>>& filters);
+
+    //! Whether there are no filters
+    DDSPIPE_CORE_DllAPI
+    bool empty() const noexcept;
+
+    //! Whether any of the filters matches \c topic
+    DDSPIPE_CORE_DllAPI
+    bool matches(
+            const ITopic& topic) const noexcept;
+
+protected:
+
+    //! Wildcard filter whose topic name pattern starts with the literal prefix of a \c TrieNode
+    struct CompiledFilter
+    {
+        //! Pattern of the topic name after its literal prefix (nullptr if it is only the prefix)
+        std::shared_ptr<GlobPattern> name_suffix;
+
+        //! Pattern of the type name (nullptr if any type matches)
+        std::shared_ptr<GlobPattern> type_name;
+    };
+
+    //! Node of the trie of the literal prefixes of the topic name patterns
+    struct TrieNode
+    {
+        //! Nodes of the prefixes one character longer
+        std::map<char, std::unique_ptr<TrieNode>> children;
+
+        //! Filters whose literal prefix ends in this node
+        std::vector<CompiledFilter> filters;
+    };
+
+    //! Whether a topic with this name and type matches any wildcard filter
+    bool matches_wildcard_(
+            const std::string& topic_name,
+            const std::string& type_name) const noexcept;
+
+    //! Root of the trie (empty prefix)
+    TrieNode root_;
+
+    //! Filters that are not \c WildcardDdsFilterTopic , evaluated one by one
+    std::vector<utils::Heritable<types::IFilterTopic>> other_filters_;
+
+    //! Whether there are no filters
+    bool empty_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -201,6 +201,18 @@ public:
     DDSPIPE_CORE_DllAPI
     virtual bool is_clean() const noexcept;
 
+    //! Number of payloads reserved and not released yet
+    DDSPIPE_CORE_DllAPI
+    uint64_t payloads_in_use() const noexcept;
+
+    //! Number of bytes reserved and not released yet
+    DDSPIPE_CORE_DllAPI
+    uint64_t bytes_in_use() const noexcept;
+
+    //! Number of payloads reserved since the pool was created
+    DDSPIPE_CORE_DllAPI
+    uint64_t payloads_reserved() const noexcept;
+
 protected:
 
     /**
@@ -235,18 +247,28 @@ protected:
     virtual bool release_(
             types::Payload& payload);
 
-    //! Increase \c reserve_count_
+    //! Increase \c reserve_count_ (and \c reserved_bytes_ by \c size )
     DDSPIPE_CORE_DllAPI
-    void add_reserved_payload_();
+    void add_reserved_payload_(
+            uint32_t size = 0);
 
-    //! Increase \c release_count_ . Show a warning if there are more releases than reserves.
+    /**
+     * @brief Increase \c release_count_ (and \c released_bytes_ by \c size ).
+     *
+     * Show a warning if there are more releases than reserves.
+     */
     DDSPIPE_CORE_DllAPI
-    void add_release_payload_();
+    void add_release_payload_(
+            uint32_t size = 0);
 
     //! Count the number of reserved data from this pool
     std::atomic<uint64_t> reserve_count_;
     //! Count the number of released data from this pool
     std::atomic<uint64_t> release_count_;
+    //! Count the bytes reserved from this pool
+    std::atomic<uint64_t> reserved_bytes_;
+    //! Count the bytes released from this pool
+    std::atomic<uint64_t> released_bytes_;
 };
 
 } /* namespace core */
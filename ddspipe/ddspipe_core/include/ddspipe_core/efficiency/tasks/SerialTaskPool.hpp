@@ -0,0 +1,121 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Bounded pool of worker threads that executes tasks grouped by key.
+ *
+ * Tasks with different keys are executed concurrently, while tasks with the same key are executed one after the
+ * other, in the same order they were emitted. This allows to parallelize the work of different topics (e.g. the
+ * creation of their entities) while keeping the operations over each topic ordered.
+ */
+class SerialTaskPool
+{
+public:
+
+    //! Task to execute. It must not throw.
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Construct a SerialTaskPool and start its threads.
+     *
+     * @param number_of_threads: Number of worker threads (0 to use as many threads as cores).
+     */
+    DDSPIPE_CORE_DllAPI
+    SerialTaskPool(
+            const unsigned int number_of_threads);
+
+    /**
+     * @brief Destroy the SerialTaskPool
+     *
+     * Wait for every pending task to be executed and join the threads.
+     */
+    DDSPIPE_CORE_DllAPI
+    ~SerialTaskPool();
+
+    /**
+     * @brief Add a task to be executed after every task previously emitted with the same \c key .
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void emit(
+            const std::string& key,
+            Task&& task) noexcept;
+
+    /**
+     * @brief Block until every task emitted has been executed.
+     *
+     * Must not be called from a task, as it would never return.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void wait_all() noexcept;
+
+    //! Number of worker threads
+    DDSPIPE_CORE_DllAPI
+    unsigned int number_of_threads() const noexcept;
+
+protected:
+
+    //! Routine of the worker threads
+    void worker_routine_() noexcept;
+
+    /**
+     * Pending tasks of every key with tasks not executed yet.
+     *
+     * A key is in this map from the moment its first task is emitted until its queue is empty and its last task
+     * has finished, so no other worker takes a task of the same key meanwhile.
+     */
+    std::map<std::string, std::deque<Task>> pending_tasks_;
+
+    //! Keys with pending tasks that are not being executed by any worker, in the order they became ready
+    std::deque<std::string> ready_keys_;
+
+    //! Worker threads
+    std::vector<std::thread> workers_;
+
+    //! Whether the workers must stop once there are no tasks left
+    bool stop_;
+
+    //! Mutex to protect the queues
+    std::mutex mutex_;
+
+    //! Notified when a key becomes ready or the pool stops
+    std::condition_variable ready_cv_;
+
+    //! Notified when there are no tasks left
+    std::condition_variable idle_cv_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
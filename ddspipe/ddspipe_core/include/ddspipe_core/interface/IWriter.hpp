@@ -82,6 +82,20 @@ public:
     DDSPIPE_CORE_DllAPI
     virtual utils::ReturnCode write(
             IRoutingData& data) noexcept = 0;
+
+    /**
+     * @brief Whether the Writer can accept a new message without discarding messages not yet delivered
+     *
+     * Tracks of conflated topics use it to keep only the latest message of each instance while the Writer is
+     * congested (e.g. its history is full of messages not yet acknowledged), instead of writing every one.
+     *
+     * By default a Writer is never congested.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool can_accept() const noexcept
+    {
+        return true;
+    }
 };
 
 } /* namespace core */
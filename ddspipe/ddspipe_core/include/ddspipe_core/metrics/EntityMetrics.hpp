@@ -0,0 +1,135 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/MetricKind.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Counters and latency histogram of a topic or a participant.
+ *
+ * The latency of a topic is not recorded here but in its \c TopicLatencyMetrics (end to end stage), and converted
+ * with \c latency_histogram when the snapshot of the registry is taken, so every sample is measured only once.
+ *
+ * Every value is split in \c SHARDS cache line aligned shards. Each thread updates always the same shard with
+ * relaxed atomic additions, so the hot path takes no lock and threads rarely share a cache line.
+ * The shards are only added up when a snapshot is taken.
+ */
+class EntityMetrics
+{
+public:
+
+    //! Number of shards of every value
+    static constexpr const unsigned int SHARDS = 16;
+
+    //! Number of buckets with upper bound of the latency histogram (bucket i holds latencies up to 2^i us)
+    static constexpr const unsigned int LATENCY_BOUNDED_BUCKETS = 23;
+
+    /**
+     * @brief Construct the metrics of an entity.
+     *
+     * @param name : topic name or participant id
+     * @param type_name : type name of the topic (empty for participants)
+     */
+    DDSPIPE_CORE_DllAPI
+    EntityMetrics(
+            const std::string& name,
+            const std::string& type_name = "");
+
+    //! Add \c value to the counter \c kind
+    DDSPIPE_CORE_DllAPI
+    void add(
+            const MetricKind kind,
+            const std::uint64_t value = 1) noexcept;
+
+    //! Record a latency [ns]
+    DDSPIPE_CORE_DllAPI
+    void record_latency(
+            const std::uint64_t latency_ns) noexcept;
+
+    //! Aggregate the shards
+    DDSPIPE_CORE_DllAPI
+    EntityMetricsSnapshot snapshot() const noexcept;
+
+    /**
+     * @brief Latency histogram with the buckets of these metrics, holding the latencies of \c distribution .
+     *
+     * Each bucket of \c distribution is counted by its upper bound, so a latency may be counted one bucket above
+     * the one it would have been recorded in.
+     */
+    DDSPIPE_CORE_DllAPI
+    static LatencyHistogramSnapshot latency_histogram(
+            const LatencyDistributionSnapshot& distribution) noexcept;
+
+    //! Size of the payload of \c data [bytes] (0 if it is not RTPS data)
+    DDSPIPE_CORE_DllAPI
+    static std::uint64_t data_size(
+            const IRoutingData& data) noexcept;
+
+    /**
+     * @brief Time elapsed since \c data was received by the Reader.
+     *
+     * @return false if it is not RTPS data or its reception time is unknown
+     */
+    DDSPIPE_CORE_DllAPI
+    static bool data_latency(
+            const IRoutingData& data,
+            std::uint64_t& latency_ns) noexcept;
+
+protected:
+
+    //! Values updated by the threads that map to the same shard
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<std::uint64_t>, METRIC_KINDS_COUNT> counters{};
+
+        std::array<std::atomic<std::uint64_t>, LATENCY_BOUNDED_BUCKETS + 1> latency_buckets{};
+
+        std::atomic<std::uint64_t> latency_sum_ns{0};
+    };
+
+    //! Shard of the calling thread (assigned round robin the first time each thread calls it)
+    static unsigned int shard_index_() noexcept;
+
+    //! Index of the latency bucket of \c latency_ns
+    static unsigned int latency_bucket_(
+            const std::uint64_t latency_ns) noexcept;
+
+    //! Empty latency histogram, with the upper bound of every bucket
+    static LatencyHistogramSnapshot empty_latency_histogram_() noexcept;
+
+    //! Topic name or participant id
+    const std::string name_;
+
+    //! Type name of the topic
+    const std::string type_name_;
+
+    std::array<Shard, SHARDS> shards_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
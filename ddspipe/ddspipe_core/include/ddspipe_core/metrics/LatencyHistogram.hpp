@@ -0,0 +1,90 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Log-linear (HDR style) histogram of latencies in nanoseconds.
+ *
+ * Every power of two range is split in \c SUB_BUCKETS linear buckets, so the value reported for any latency is at
+ * most 1/\c SUB_BUCKETS (~6%) above the real one, from nanoseconds to \c 2^(MAX_EXPONENT+1) ns (~36 minutes).
+ * Greater latencies are counted in the last bucket.
+ *
+ * Recording a latency is a handful of relaxed atomic operations over a fixed array, so it takes no lock and does
+ * not allocate, and it can be left enabled in production.
+ */
+class LatencyHistogram
+{
+public:
+
+    //! Number of bits of the linear part of a bucket index
+    static constexpr const unsigned int SUB_BUCKET_BITS = 4;
+
+    //! Number of linear buckets in which every power of two range is split
+    static constexpr const unsigned int SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+
+    //! Exponent of the greatest power of two range split in buckets
+    static constexpr const unsigned int MAX_EXPONENT = 40;
+
+    //! Number of buckets
+    static constexpr const unsigned int BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+    DDSPIPE_CORE_DllAPI
+    LatencyHistogram();
+
+    //! Record a latency [ns]
+    DDSPIPE_CORE_DllAPI
+    void record(
+            const std::uint64_t latency_ns) noexcept;
+
+    //! Copy the non empty buckets (the latencies recorded meanwhile may be partially missed)
+    DDSPIPE_CORE_DllAPI
+    LatencyDistributionSnapshot snapshot() const noexcept;
+
+    //! Index of the bucket of \c latency_ns
+    DDSPIPE_CORE_DllAPI
+    static unsigned int bucket_index(
+            const std::uint64_t latency_ns) noexcept;
+
+    //! Greatest latency [ns] counted in bucket \c index
+    DDSPIPE_CORE_DllAPI
+    static std::uint64_t bucket_upper_bound(
+            const unsigned int index) noexcept;
+
+protected:
+
+    //! Number of latencies in each bucket
+    std::array<std::atomic<std::uint64_t>, BUCKETS> buckets_;
+
+    //! Sum of the latencies recorded [ns]
+    std::atomic<std::uint64_t> sum_ns_;
+
+    //! Greatest latency recorded [ns]
+    std::atomic<std::uint64_t> max_ns_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,49 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Counters kept for every topic and participant
+ENUMERATION_BUILDER(
+    MetricKind,
+    samples_in,             //! Samples taken from the readers.
+    bytes_in,               //! Bytes of the samples taken from the readers.
+    samples_out,            //! Samples written by the writers.
+    bytes_out,              //! Bytes of the samples written by the writers.
+    dropped_rate_limit,     //! Samples discarded by the max reception or transmission rate.
+    dropped_downsampling,   //! Samples discarded by downsampling.
+    dropped_writer_error,   //! Samples that a writer failed to write.
+    dropped_rejected,       //! Samples rejected by the reader history (resource limits).
+    dropped_stale,          //! Samples discarded for being older than the max age.
+    dropped_duplicate,      //! Samples discarded for being duplicated.
+    dropped_filtered,       //! Samples discarded by the content filter.
+    dropped_malformed,      //! Samples discarded for not being decodable.
+    compression_bytes_in,   //! Original size of the payloads compressed.
+    compression_bytes_out,  //! Compressed size of the payloads compressed.
+    compression_time_ns,    //! Time spent compressing payloads.
+    decompression_time_ns   //! Time spent decompressing payloads.
+    );
+
+//! Number of values of \c MetricKind
+constexpr const unsigned int METRIC_KINDS_COUNT = 16;
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
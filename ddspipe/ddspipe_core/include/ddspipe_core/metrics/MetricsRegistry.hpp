@@ -0,0 +1,138 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <cpp_utils/time/time_utils.hpp>
+#include <cpp_utils/types/Singleton.hpp>
+
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/EntityMetrics.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+#include <ddspipe_core/metrics/TopicLatencyMetrics.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Registry of the metrics of every topic and participant.
+ *
+ * The entities (Tracks, readers and writers) get their \c EntityMetrics once, when they are created, and update
+ * them without accessing the registry again. The metrics are kept while any entity uses them, and for
+ * \c unused_ttl milliseconds after the last one is destroyed, so the counters of a topic keep growing when its
+ * bridge is rebuilt, but the topics and participants that are gone do not grow the registry forever.
+ * The unused metrics are only looked for when a snapshot is taken, so creating entities never scans the registry.
+ *
+ * The latency histogram of a topic is taken from the end to end stage of its \c TopicLatencyMetrics .
+ */
+class MetricsRegistry
+{
+public:
+
+    //! Get (creating it if it does not exist) the metrics of a topic
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<EntityMetrics> topic_metrics(
+            const std::string& topic_name,
+            const std::string& type_name);
+
+    //! Get (creating it if it does not exist) the metrics of \c topic (the type name is only known for DDS topics)
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<EntityMetrics> topic_metrics(
+            const ITopic& topic);
+
+    //! Get (creating them if they do not exist) the latency histograms of \c topic
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<TopicLatencyMetrics> topic_latency_metrics(
+            const ITopic& topic);
+
+    //! Get (creating it if it does not exist) the metrics of a participant
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<EntityMetrics> participant_metrics(
+            const types::ParticipantId& participant_id);
+
+    /**
+     * @brief Aggregate the metrics of every topic and participant.
+     *
+     * The metrics that no entity has used for \c unused_ttl are removed first.
+     * The payload pool and thread pool metrics are not filled, as the registry does not own them.
+     */
+    DDSPIPE_CORE_DllAPI
+    MetricsSnapshot snapshot();
+
+    //! Set the time the metrics no entity uses are kept [ms]
+    DDSPIPE_CORE_DllAPI
+    void unused_ttl(
+            const utils::Duration_ms ttl) noexcept;
+
+    //! Default time the metrics no entity uses are kept [ms]
+    static constexpr const utils::Duration_ms DEFAULT_UNUSED_TTL = 300000;
+
+protected:
+
+    //! Metrics in the registry
+    template <typename T>
+    struct Entry
+    {
+        //! Metrics shared with the entities
+        std::shared_ptr<T> metrics;
+
+        //! Whether no entity used the metrics in the last purge
+        bool unused {false};
+
+        //! Time of the first purge that found the metrics unused
+        std::chrono::steady_clock::time_point unused_since;
+    };
+
+    //! Remove the entries of \c entries that no entity has used for \c unused_ttl_
+    template <typename Key, typename T>
+    void purge_unused_nts_(
+            std::map<Key, Entry<T>>& entries,
+            const std::chrono::steady_clock::time_point& now) noexcept;
+
+    //! Remove every metrics that no entity has used for \c unused_ttl_
+    void purge_unused_nts_() noexcept;
+
+    //! Metrics of every topic indexed by topic and type names
+    std::map<std::pair<std::string, std::string>, Entry<EntityMetrics>> topics_;
+
+    //! Latency histograms of every topic indexed by topic and type names
+    std::map<std::pair<std::string, std::string>, Entry<TopicLatencyMetrics>> topic_latencies_;
+
+    //! Metrics of every participant
+    std::map<types::ParticipantId, Entry<EntityMetrics>> participants_;
+
+    //! Time the metrics no entity uses are kept [ms]
+    std::atomic<utils::Duration_ms> unused_ttl_ {DEFAULT_UNUSED_TTL};
+
+    //! Protects \c topics_ , \c topic_latencies_ and \c participants_
+    mutable std::mutex mutex_;
+};
+
+//! Registry shared by every entity of the process
+using ProcessMetricsRegistry = utils::Singleton<MetricsRegistry>;
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,178 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/metrics/MetricKind.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Aggregated values of a latency histogram
+struct LatencyHistogramSnapshot
+{
+    //! Upper bound of each bucket [us] (the last bucket has no upper bound)
+    std::vector<std::uint64_t> upper_bounds_us{};
+
+    //! Number of latencies in each bucket (not cumulative). It has one more element than \c upper_bounds_us .
+    std::vector<std::uint64_t> counts{};
+
+    //! Number of latencies recorded
+    std::uint64_t count{0};
+
+    //! Sum of the latencies recorded [ns]
+    std::uint64_t sum_ns{0};
+};
+
+//! Non empty buckets of a log-linear latency histogram
+struct LatencyDistributionSnapshot
+{
+    /**
+     * @brief Latency [ns] under which there are at least the fraction \c quantile of the latencies recorded.
+     *
+     * It is the upper bound of the bucket where the quantile falls, so it may be slightly above the real one.
+     *
+     * @return 0 if no latency has been recorded
+     */
+    std::uint64_t percentile_ns(
+            const double quantile) const noexcept
+    {
+        const double threshold = quantile * static_cast<double>(count);
+        std::uint64_t accumulated = 0;
+
+        for (const auto& bucket : buckets)
+        {
+            accumulated += bucket.second;
+            if (static_cast<double>(accumulated) >= threshold)
+            {
+                return bucket.first < max_ns ? bucket.first : max_ns;
+            }
+        }
+
+        return max_ns;
+    }
+
+    //! Upper bound [ns] and number of latencies of every non empty bucket, in increasing order
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> buckets{};
+
+    //! Number of latencies recorded
+    std::uint64_t count{0};
+
+    //! Sum of the latencies recorded [ns]
+    std::uint64_t sum_ns{0};
+
+    //! Greatest latency recorded [ns]
+    std::uint64_t max_ns{0};
+};
+
+//! Latencies of the samples forwarded in a topic, split in the stages of the forwarding
+struct TopicLatencySnapshot
+{
+    //! Topic name
+    std::string name{};
+
+    //! Type name of the topic
+    std::string type_name{};
+
+    //! Time from the reception of a sample until a Track takes it (time waiting in the thread pool queue)
+    LatencyDistributionSnapshot queue_wait{};
+
+    //! Time from the take of a sample until each writer has written it
+    LatencyDistributionSnapshot forwarding{};
+
+    //! Time from the reception of a sample until each writer has written it
+    LatencyDistributionSnapshot end_to_end{};
+};
+
+//! Aggregated metrics of a topic or a participant
+struct EntityMetricsSnapshot
+{
+    //! Value of a counter
+    std::uint64_t value(
+            const MetricKind kind) const noexcept
+    {
+        return values[static_cast<unsigned int>(kind)];
+    }
+
+    //! Topic name or participant id
+    std::string name{};
+
+    //! Type name of the topic (empty for participants)
+    std::string type_name{};
+
+    //! Value of every counter, indexed by \c MetricKind
+    std::array<std::uint64_t, METRIC_KINDS_COUNT> values{};
+
+    //! Time from the reception of a sample to its write in each writer
+    LatencyHistogramSnapshot latency{};
+};
+
+//! State of the payload pool
+struct PayloadPoolMetricsSnapshot
+{
+    //! Payloads reserved and not released yet
+    std::uint64_t payloads_in_use{0};
+
+    //! Bytes reserved and not released yet
+    std::uint64_t bytes_in_use{0};
+
+    //! Payloads reserved since the pool was created
+    std::uint64_t payloads_reserved{0};
+};
+
+//! State of the thread pool that forwards the data
+struct ThreadPoolMetricsSnapshot
+{
+    //! Number of threads
+    std::uint32_t threads{0};
+
+    //! Threads executing a task
+    std::uint32_t busy_threads{0};
+
+    //! Tasks waiting for a free thread
+    std::uint64_t pending_tasks{0};
+
+    //! Time spent executing tasks [ns]
+    std::uint64_t busy_time_ns{0};
+};
+
+//! Metrics of a whole DDS Pipe at a given moment
+struct MetricsSnapshot
+{
+    //! Metrics of every topic forwarded
+    std::vector<EntityMetricsSnapshot> topics{};
+
+    //! Metrics of every participant
+    std::vector<EntityMetricsSnapshot> participants{};
+
+    //! Latencies of every topic forwarded
+    std::vector<TopicLatencySnapshot> latencies{};
+
+    //! State of the payload pool
+    PayloadPoolMetricsSnapshot payload_pool{};
+
+    //! State of the thread pool
+    ThreadPoolMetricsSnapshot thread_pool{};
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
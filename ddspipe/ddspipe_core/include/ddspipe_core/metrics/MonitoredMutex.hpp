@@ -0,0 +1,85 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Mutex that measures how long it is waited for and how long it is held every time it is locked.
+ *
+ * It meets the Lockable requirements, so it can be used with \c std::lock_guard and \c std::unique_lock .
+ * An uncontended lock costs one clock read more than a \c std::mutex , and every unlock another one, so it is meant
+ * for the mutexes of the control path (e.g. discovery), not for the ones taken for every sample.
+ */
+class MonitoredMutex
+{
+public:
+
+    DDSPIPE_CORE_DllAPI
+    MonitoredMutex() = default;
+
+    MonitoredMutex(
+            const MonitoredMutex&) = delete;
+
+    MonitoredMutex& operator =(
+            const MonitoredMutex&) = delete;
+
+    //! Lock the mutex, recording the time waited for it
+    DDSPIPE_CORE_DllAPI
+    void lock();
+
+    //! Lock the mutex if it is not locked, without waiting
+    DDSPIPE_CORE_DllAPI
+    bool try_lock();
+
+    //! Unlock the mutex, recording the time it has been held
+    DDSPIPE_CORE_DllAPI
+    void unlock();
+
+    //! Times [ns] the mutex has been held
+    DDSPIPE_CORE_DllAPI
+    LatencyDistributionSnapshot hold_times() const noexcept;
+
+    //! Times [ns] waited to lock the mutex
+    DDSPIPE_CORE_DllAPI
+    LatencyDistributionSnapshot wait_times() const noexcept;
+
+protected:
+
+    //! Mutex locked
+    std::mutex mutex_;
+
+    //! Time when the mutex was locked (only accessed by the thread that holds it)
+    std::chrono::steady_clock::time_point locked_at_;
+
+    //! Times the mutex has been held
+    LatencyHistogram hold_times_;
+
+    //! Times waited to lock the mutex
+    LatencyHistogram wait_times_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
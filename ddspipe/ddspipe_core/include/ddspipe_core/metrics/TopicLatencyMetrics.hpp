@@ -0,0 +1,94 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Latency histograms of the samples forwarded in a topic.
+ *
+ * A sample is timestamped when it is received (by the reader), when a Track takes it from the reader and when each
+ * writer has written it. These timestamps split its end to end latency in the time it has waited in the thread
+ * pool queue and the time spent forwarding it.
+ *
+ * Only RTPS data carries the timestamps, so any other data is not measured.
+ */
+class TopicLatencyMetrics
+{
+public:
+
+    /**
+     * @brief Construct the latency metrics of a topic.
+     *
+     * @param name : topic name
+     * @param type_name : type name of the topic
+     */
+    DDSPIPE_CORE_DllAPI
+    TopicLatencyMetrics(
+            const std::string& name,
+            const std::string& type_name);
+
+    /**
+     * @brief Set the take timestamp of \c data and record the time it has waited since it was received.
+     *
+     * Call it right after taking \c data from the reader.
+     */
+    DDSPIPE_CORE_DllAPI
+    void record_take(
+            IRoutingData& data) noexcept;
+
+    /**
+     * @brief Record the time since \c data was taken and since it was received.
+     *
+     * Call it each time a writer writes \c data .
+     */
+    DDSPIPE_CORE_DllAPI
+    void record_write(
+            const IRoutingData& data) noexcept;
+
+    //! Copy the histograms
+    DDSPIPE_CORE_DllAPI
+    TopicLatencySnapshot snapshot() const noexcept;
+
+protected:
+
+    //! Topic name
+    const std::string name_;
+
+    //! Type name of the topic
+    const std::string type_name_;
+
+    //! Time from the reception to the take
+    LatencyHistogram queue_wait_;
+
+    //! Time from the take to the write in a writer
+    LatencyHistogram forwarding_;
+
+    //! Time from the reception to the write in a writer
+    LatencyHistogram end_to_end_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
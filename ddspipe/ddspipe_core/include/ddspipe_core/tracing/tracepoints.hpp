@@ -0,0 +1,44 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file tracepoints.hpp
+ *
+ * Static tracepoints of the DDS Pipe (provider \c ddspipe ).
+ *
+ * They are compiled as USDT probes when available (see \c cpp_utils/macros/tracepoints.hpp ):
+ *
+ * - Forwarding (\c track is the address of the Track, \c data the address of the data taken):
+ *   - track_created(track, topic_name, participant_id): once per Track, to map its address to its topic and reader.
+ *   - track_wakeup(track): a thread of the pool starts transmitting the data of the Track.
+ *   - track_take(track, data): a data has been taken from the reader.
+ *   - track_write_begin(track, data, writer): a data starts being written in a writer.
+ *   - track_write_end(track, data, writer, ok): a data has been written in a writer (ok = 1) or it failed (ok = 0).
+ * - Payload pool (\c data is the address of the payload buffer):
+ *   - payload_reserve(pool, data, size)
+ *   - payload_release(pool, data, size)
+ * - Discovery (\c guid is the address of the 16 bytes of the endpoint guid):
+ *   - endpoint_discovered(guid, topic_name, is_reader)
+ *   - endpoint_updated(guid, topic_name, is_reader)
+ *   - endpoint_erased(guid, topic_name, is_reader)
+ *
+ * The thread pool tracepoints are in provider \c cpp_utils (thread_pool_dequeue and thread_pool_task_end).
+ */
+
+#pragma once
+
+#include <cpp_utils/macros/tracepoints.hpp>
+
+//! Static tracepoint \c name of the DDS Pipe
+#define DDSPIPE_TRACEPOINT(name, ...) CPP_UTILS_TRACEPOINT(ddspipe, name, ## __VA_ARGS__)
@@ -80,9 +80,24 @@ struct RtpsPayloadData : public core::IRoutingData
     //! Source time stamp of the message
     core::types::DataTime source_timestamp{};
 
+    //! Time stamp of the reception of the message in the Reader (unknown if not set)
+    core::types::DataTime reception_timestamp{};
+
+    //! Time stamp of the take of the message by the Track, once it has left the thread pool queue (unknown if not set)
+    core::types::DataTime take_timestamp{};
+
     //! Guid of the source entity that has transmit the data
     core::types::Guid source_guid{};
 
+    //! Sequence number of the data in the source entity (unknown if not set)
+    core::types::SequenceNumber sequence_number{};
+
+    //! Guid of the writer that originally published the data, kept through every proxy it crosses (unknown if not set)
+    core::types::Guid origin_guid{};
+
+    //! Sequence number of the data in the writer that originally published it (unknown if not set)
+    core::types::SequenceNumber origin_sequence_number{};
+
     //! Id of the participant from which the Reader has received the data.
     core::types::ParticipantId participant_receiver{};
 };
@@ -18,6 +18,7 @@
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/common/Time_t.h>
@@ -46,6 +47,9 @@ using ChangeKind = eprosima::fastrtps::rtps::ChangeKind_t;
 //! Fast DDS Time
 using DataTime = eprosima::fastrtps::rtps::Time_t;
 
+//! Sequence Number of a change
+using SequenceNumber = eprosima::fastrtps::rtps::SequenceNumber_t;
+
 //! Kind of every unit that creates a Payload
 using PayloadUnit = eprosima::fastrtps::rtps::octet;
 
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <mutex>
+#include <string>
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
 #include <cpp_utils/types/Fuzzy.hpp>
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
@@ -41,6 +45,14 @@ using OwnershipQosPolicyKind = eprosima::fastdds::dds::OwnershipQosPolicyKind;
 // TransportPriority kind enumeration
 using TransportPrioritykind = unsigned int;
 
+//! How the duplicated samples received through redundant routes are detected
+ENUMERATION_BUILDER(
+    DeduplicationKind,
+    NONE,       //! Duplicated samples are not discarded.
+    SEQUENCE,   //! Duplicated samples are detected by the guid and sequence number of their original writer.
+    HASH        //! Duplicated samples are detected by the hash of their payload (sequence numbers rewritten).
+    );
+
 /**
  * The collection of QoS related to a Topic.
  *
@@ -54,6 +66,9 @@ using TransportPrioritykind = unsigned int;
  *  - Max Transmission Rate
  *  - Max Reception Rate
  *  - Downsampling
+ *  - Conflate
+ *  - Max Age
+ *  - Deduplication
  *
  * @warning partitions are considered a Topic QoS. A Topic can then only either have partitions or not have them, but it
  * cannot support empty partitions.
@@ -110,6 +125,33 @@ TopicQoS
             const TopicQoS& qos,
             const utils::FuzzyLevelValues& fuzzy_level = utils::FuzzyLevelValues::fuzzy_level_fuzzy) noexcept;
 
+    /**
+     * @brief Set the Topic QoS that are set in \c qos , whatever the level of the current ones.
+     *
+     * Used to apply a new configured Topic QoS to a topic that already has the previous one.
+     */
+    DDSPIPE_CORE_DllAPI
+    void impose_qos(
+            const TopicQoS& qos,
+            const utils::FuzzyLevelValues& fuzzy_level = utils::FuzzyLevelValues::fuzzy_level_set) noexcept;
+
+    /**
+     * @brief Set the Topic QoS applied to every TopicQoS constructed from now on (i.e. the Topic QoS of specs).
+     *
+     * Thread safe, as the Participants construct TopicQoS in their discovery threads.
+     */
+    DDSPIPE_CORE_DllAPI
+    static void set_default_topic_qos(
+            const TopicQoS& qos) noexcept;
+
+    /**
+     * @brief Stop applying a default Topic QoS to the TopicQoS constructed from now on.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    static void unset_default_topic_qos() noexcept;
+
     /**
      * @brief Set the default Topic QoS.
      */
@@ -124,7 +166,11 @@ TopicQoS
             float max_tx_rate = DEFAULT_MAX_TX_RATE,
             float max_rx_rate = DEFAULT_MAX_RX_RATE,
             unsigned int downsampling = DEFAULT_DOWNSAMPLING,
-            TransportPrioritykind transport_priority = DEFAULT_TRANSPORT_PRIORITY) noexcept;
+            TransportPrioritykind transport_priority = DEFAULT_TRANSPORT_PRIORITY,
+            bool conflate = DEFAULT_CONFLATE,
+            float max_age = DEFAULT_MAX_AGE,
+            DeduplicationKind deduplication = DEFAULT_DEDUPLICATION,
+            const std::string& content_filter = DEFAULT_CONTENT_FILTER) noexcept;
 
     /////////////////////////
     // VARIABLES
@@ -160,14 +206,29 @@ TopicQoS
     //topic priority
     utils::Fuzzy<TransportPrioritykind> transport_priority;
 
+    //! Whether only the latest sample of each instance is kept pending while a writer is congested (state-like topics)
+    utils::Fuzzy<bool> conflate;
+
+    //! Discard msgs whose source timestamp is older than max_age seconds when forwarded [s]. Default: 0 (no limit)
+    utils::Fuzzy<float> max_age;
+
+    //! How the samples received more than once (i.e. through redundant routes) are discarded
+    utils::Fuzzy<DeduplicationKind> deduplication;
+
+    //! Expression on the data fields that a sample must match to be forwarded. Default: empty (no filter)
+    utils::Fuzzy<std::string> content_filter;
+
     /////////////////////////
     // GLOBAL VARIABLES
     /////////////////////////
 
-    //! Global value to store the default Topic QoS in this execution.
+    //! Global value to store the default Topic QoS in this execution (only modified through \c set_default_topic_qos )
     DDSPIPE_CORE_DllAPI
     static utils::Fuzzy<TopicQoS> default_topic_qos;
 
+    //! Protects \c default_topic_qos
+    static std::mutex default_topic_qos_mutex;
+
     /////////////////////////
     // DEFAULT VALUES
     /////////////////////////
@@ -211,6 +272,22 @@ TopicQoS
     //! TransportPrioritykind (Default = 0)
     DDSPIPE_CORE_DllAPI
     static constexpr const TransportPrioritykind DEFAULT_TRANSPORT_PRIORITY = 0;
+
+    //! Whether the topic is conflated (Default = False)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const bool DEFAULT_CONFLATE = false;
+
+    //! Max Age (Default = 0)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const float DEFAULT_MAX_AGE = 0;
+
+    //! Deduplication kind (Default = NONE)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const DeduplicationKind DEFAULT_DEDUPLICATION = DeduplicationKind::NONE;
+
+    //! Content filter expression (Default = empty)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const char* DEFAULT_CONTENT_FILTER = "";
 };
 
 /**
@@ -0,0 +1,212 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/dds/Payload.hpp>
+#include <ddspipe_core/types/dynamic_types/ContentFilterExpression.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+/**
+ * Content filter expression compiled against the DynamicType of a topic.
+ *
+ * Every field of the expression is resolved once into the chain of members that leads to it. When every member
+ * serialized before a field has a fixed size, the field is read straight from its offset in the payload. Otherwise,
+ * only the members that precede it are skipped, so payloads are never deserialized as a whole.
+ *
+ * Only plain CDR (XCDR1) payloads can be evaluated. Unions, maps, bitsets, bitmasks, wide characters and
+ * inheritance are not supported before a filtered field.
+ */
+class CompiledContentFilter
+{
+public:
+
+    /**
+     * @brief Compile \c expression against \c dynamic_type .
+     *
+     * @throw \c UnsupportedException if a field does not exist, its type cannot be compared with its literal or
+     * any member serialized before it is not supported.
+     */
+    DDSPIPE_CORE_DllAPI
+    CompiledContentFilter(
+            const ContentFilterExpression& expression,
+            const fastrtps::types::DynamicType_ptr& dynamic_type);
+
+    /**
+     * @brief Evaluate the expression over a serialized \c payload .
+     *
+     * @param [in] payload : serialized data of the topic type
+     * @param [out] error : whether \c payload could not be evaluated (unsupported encapsulation or malformed)
+     *
+     * @return whether \c payload passes the filter (meaningless if \c error is set)
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    bool evaluate(
+            const Payload& payload,
+            bool& error) const noexcept;
+
+protected:
+
+    //! Serialized layout of a type
+    struct CdrType
+    {
+        enum class Kind
+        {
+            boolean,
+            character,
+            signed_integer,
+            unsigned_integer,
+            floating,
+            string,
+            structure,
+            array,
+            sequence,
+            unsupported,
+        };
+
+        Kind kind {Kind::unsupported};
+
+        //! Serialized size of a primitive
+        std::uint32_t size {0};
+
+        //! Members of a structure, in serialization order
+        std::vector<std::pair<std::string, std::shared_ptr<const CdrType>>> members {};
+
+        //! Element of an array or a sequence
+        std::shared_ptr<const CdrType> element {};
+
+        //! Number of elements of an array
+        std::uint32_t length {0};
+
+        //! Name of the type (for error messages)
+        std::string name {};
+    };
+
+    //! How to reach a field inside the payload
+    struct FieldAccessor
+    {
+        //! Structure and index of the member taken at each level
+        std::vector<std::pair<const CdrType*, std::size_t>> steps {};
+
+        //! Type of the field
+        std::shared_ptr<const CdrType> type {};
+
+        //! Whether the field is always at \c offset
+        bool fixed_offset {false};
+
+        //! Offset of the field from the beginning of the serialized data (if \c fixed_offset )
+        std::uint32_t offset {0};
+    };
+
+    //! Node of the compiled expression
+    struct CompiledNode
+    {
+        ContentFilterExpression::Node::Kind kind {ContentFilterExpression::Node::Kind::comparison};
+
+        //! Index of the operands in \c nodes_
+        std::size_t left {0};
+        std::size_t right {0};
+
+        //! Index of the field in \c accessors_
+        std::size_t accessor {0};
+
+        ContentFilterExpression::Operator op {ContentFilterExpression::Operator::equal};
+
+        ContentFilterExpression::Literal literal {};
+    };
+
+    //! Serialized data being evaluated
+    struct CdrBuffer
+    {
+        const std::uint8_t* data {nullptr};
+        std::uint32_t size {0};
+        bool little_endian {true};
+    };
+
+    //! Build the serialized layout of \c dynamic_type
+    static std::shared_ptr<const CdrType> build_type_(
+            const fastrtps::types::DynamicType_ptr& dynamic_type,
+            const unsigned int depth);
+
+    //! CDR alignment of \c type (XCDR1 aligns primitives to their size, up to 8)
+    static std::uint32_t alignment_(
+            const CdrType& type) noexcept;
+
+    //! Whether \c type is a primitive
+    static bool is_primitive_(
+            const CdrType& type) noexcept;
+
+    //! Whether every part of \c type can be skipped
+    static bool is_skippable_(
+            const CdrType& type) noexcept;
+
+    //! Skip \c type when its size does not depend on the data (return false otherwise)
+    static bool skip_fixed_(
+            const CdrType& type,
+            std::uint32_t& position) noexcept;
+
+    //! Skip \c type in \c buffer (return false if malformed)
+    static bool skip_(
+            const CdrType& type,
+            const CdrBuffer& buffer,
+            std::uint32_t& position) noexcept;
+
+    //! Compile the expression tree under \c node and return its index in \c nodes_
+    std::size_t compile_node_(
+            const ContentFilterExpression::Node& node);
+
+    //! Resolve \c field in the root type
+    FieldAccessor compile_field_(
+            const std::vector<std::string>& field) const;
+
+    //! Evaluate the node \c index over \c buffer
+    bool evaluate_node_(
+            const std::size_t index,
+            const CdrBuffer& buffer,
+            bool& error) const noexcept;
+
+    //! Evaluate the comparison of \c node over \c buffer
+    bool evaluate_comparison_(
+            const CompiledNode& node,
+            const CdrBuffer& buffer,
+            bool& error) const noexcept;
+
+    //! Layout of the root type
+    std::shared_ptr<const CdrType> root_type_;
+
+    //! Every field compared in the expression
+    std::vector<FieldAccessor> accessors_;
+
+    //! Compiled expression tree (root is the last one)
+    std::vector<CompiledNode> nodes_;
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
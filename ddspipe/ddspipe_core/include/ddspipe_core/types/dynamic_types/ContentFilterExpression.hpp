@@ -0,0 +1,131 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+/**
+ * Parsed content filter expression of a topic.
+ *
+ * An expression combines comparisons between a field of the data type and a literal:
+ *  - Fields are referred by name, with \c . to access the fields of nested structures (e.g. \c header.frame_id ).
+ *  - Literals can be integers, floating point numbers, strings (between ' or ") and \c true or \c false .
+ *  - Comparison operators are \c == \c != \c < \c <= \c > and \c >= . A field alone is compared with \c true .
+ *  - Comparisons are combined with \c && , \c || , \c ! and parentheses.
+ *
+ * Example: \c "header.frame_id == 'lidar_front' && range < 50"
+ *
+ * The expression is only parsed here. It is compiled against the data type in \c CompiledContentFilter .
+ */
+class ContentFilterExpression
+{
+public:
+
+    //! Comparison operator
+    enum class Operator
+    {
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal,
+    };
+
+    //! Literal value of a comparison
+    struct Literal
+    {
+        enum class Kind
+        {
+            boolean,
+            integer,
+            floating,
+            string,
+        };
+
+        Kind kind {Kind::boolean};
+        bool boolean {false};
+        std::int64_t integer {0};
+        double floating {0};
+        std::string string {};
+    };
+
+    //! Node of the expression tree
+    struct Node
+    {
+        enum class Kind
+        {
+            logical_and,
+            logical_or,
+            logical_not,
+            comparison,
+        };
+
+        Kind kind {Kind::comparison};
+
+        //! Operands of \c logical_and and \c logical_or (only \c left in \c logical_not )
+        std::shared_ptr<const Node> left {};
+        std::shared_ptr<const Node> right {};
+
+        //! Path of the field compared (names of the nested members)
+        std::vector<std::string> field {};
+
+        //! Operator of the comparison
+        Operator op {Operator::equal};
+
+        //! Literal compared with the field
+        Literal literal {};
+    };
+
+    /**
+     * @brief Parse \c expression .
+     *
+     * @throw \c ConfigurationException if the expression is not well formed.
+     */
+    DDSPIPE_CORE_DllAPI
+    ContentFilterExpression(
+            const std::string& expression);
+
+    //! Expression as written by the user
+    DDSPIPE_CORE_DllAPI
+    const std::string& expression() const noexcept;
+
+    //! Root of the expression tree
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<const Node> root() const noexcept;
+
+protected:
+
+    //! Expression as written by the user
+    std::string expression_;
+
+    //! Root of the expression tree
+    std::shared_ptr<const Node> root_;
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,164 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include <cpp_utils/exception/Exception.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/communication/dds/ContentFilter.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+constexpr const std::chrono::milliseconds ContentFilter::TYPE_LOOKUP_PERIOD;
+
+ContentFilter::ContentFilter(
+        const std::shared_ptr<const ContentFilterExpression>& expression,
+        const std::string& type_name)
+    : type_name_(type_name)
+    , expression_(expression)
+    , resolved_(false)
+    , next_type_lookup_(std::chrono::steady_clock::now())
+    , evaluation_error_reported_(false)
+{
+    logDebug(DDSPIPE_CONTENT_FILTER,
+            "Creating ContentFilter <" << expression_->expression() << "> for type " << type_name_ << ".");
+}
+
+bool ContentFilter::is_filtered_out(
+        const IRoutingData& data) noexcept
+{
+    if (data.internal_type_discriminator() != INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return false;
+    }
+
+    const RtpsPayloadData& rtps_data = static_cast<const RtpsPayloadData&>(data);
+
+    if (rtps_data.kind != ChangeKind::ALIVE || rtps_data.payload.length == 0)
+    {
+        // Disposals and unregistrations do not carry the fields of the data
+        return false;
+    }
+
+    auto compiled = compiled_filter_();
+    if (!compiled)
+    {
+        return false;
+    }
+
+    bool error = false;
+    const bool match = compiled->evaluate(rtps_data.payload, error);
+
+    if (error)
+    {
+        if (!evaluation_error_reported_.exchange(true))
+        {
+            logWarning(DDSPIPE_CONTENT_FILTER,
+                    "Content filter <" << expression_->expression() << "> cannot evaluate a sample of type " <<
+                    type_name_ << " (not plain CDR or malformed). Samples that cannot be evaluated are forwarded.");
+        }
+        return false;
+    }
+
+    return !match;
+}
+
+std::shared_ptr<const CompiledContentFilter> ContentFilter::compiled_filter_() noexcept
+{
+    // Once resolved, compiled_ does not change, so it can be read without the mutex
+    if (resolved_.load(std::memory_order_acquire))
+    {
+        return compiled_;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        // Another Track is already compiling, so let this sample go
+        return nullptr;
+    }
+
+    if (resolved_.load(std::memory_order_acquire))
+    {
+        return compiled_;
+    }
+
+    // Do not look for the type in every sample
+    const auto now = std::chrono::steady_clock::now();
+    if (now < next_type_lookup_)
+    {
+        return nullptr;
+    }
+    next_type_lookup_ = now + TYPE_LOOKUP_PERIOD;
+
+    fastrtps::types::DynamicType_ptr dynamic_type = find_dynamic_type_();
+    if (!dynamic_type)
+    {
+        logDebug(DDSPIPE_CONTENT_FILTER,
+                "Type " << type_name_ << " is not known yet, so its content filter cannot be applied.");
+        return nullptr;
+    }
+
+    try
+    {
+        compiled_ = std::make_shared<CompiledContentFilter>(*expression_, dynamic_type);
+
+        logInfo(DDSPIPE_CONTENT_FILTER,
+                "Content filter <" << expression_->expression() << "> compiled for type " << type_name_ << ".");
+    }
+    catch (const utils::Exception& e)
+    {
+        logWarning(DDSPIPE_CONTENT_FILTER,
+                "Content filter <" << expression_->expression() << "> cannot be applied to type " << type_name_ <<
+                ": " << e.what() << " Every sample of this type is forwarded.");
+    }
+
+    resolved_.store(true, std::memory_order_release);
+    return compiled_;
+}
+
+fastrtps::types::DynamicType_ptr ContentFilter::find_dynamic_type_() const noexcept
+{
+    auto factory = fastrtps::types::TypeObjectFactory::get_instance();
+
+    // Complete type object first, minimal otherwise
+    for (const bool complete : {true, false})
+    {
+        const fastrtps::types::TypeIdentifier* type_identifier = factory->get_type_identifier(type_name_, complete);
+        if (!type_identifier)
+        {
+            continue;
+        }
+
+        const fastrtps::types::TypeObject* type_object = factory->get_type_object(type_name_, complete);
+        if (!type_object)
+        {
+            continue;
+        }
+
+        return factory->build_dynamic_type(type_name_, type_identifier, type_object);
+    }
+
+    return nullptr;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,88 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/communication/dds/ContentFilterRegistry.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+std::shared_ptr<const ContentFilterExpression> ContentFilterRegistry::expression(
+        const std::string& expression)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = expressions_.find(expression);
+    if (it != expressions_.end())
+    {
+        return it->second;
+    }
+
+    // Throws ConfigurationException if the expression is not well formed
+    auto parsed = std::make_shared<const ContentFilterExpression>(expression);
+    expressions_.emplace(expression, parsed);
+
+    return parsed;
+}
+
+std::shared_ptr<ContentFilter> ContentFilterRegistry::filter(
+        const std::string& expression,
+        const std::string& type_name) noexcept
+{
+    std::shared_ptr<const ContentFilterExpression> parsed;
+    try
+    {
+        parsed = this->expression(expression);
+    }
+    catch (const utils::ConfigurationException& e)
+    {
+        logError(DDSPIPE_CONTENT_FILTER, e.what() << " Every sample of type " << type_name << " is forwarded.");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& cached = filters_[{type_name, expression}];
+
+    auto filter = cached.lock();
+    if (!filter)
+    {
+        filter = std::make_shared<ContentFilter>(parsed, type_name);
+        cached = filter;
+
+        // Forget the filters that no bridge uses anymore
+        for (auto it = filters_.begin(); it != filters_.end();)
+        {
+            if (it->second.expired())
+            {
+                it = filters_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    return filter;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -15,6 +15,7 @@
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
 
+#include <ddspipe_core/communication/dds/ContentFilterRegistry.hpp>
 #include <ddspipe_core/communication/dds/DdsBridge.hpp>
 
 namespace eprosima {
@@ -198,6 +199,19 @@ void DdsBridge::change_master_flag(bool master_flag) noexcept
     }
 }
 
+std::uint64_t DdsBridge::samples_received() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::uint64_t received = 0;
+    for (const auto& it_track : tracks_)
+    {
+        received += it_track.second->samples_received();
+    }
+
+    return received;
+}
+
 void DdsBridge::add_writer_to_tracks_nts_(
         const ParticipantId& participant_id,
         std::shared_ptr<IWriter>& writer)
@@ -275,13 +289,31 @@ void DdsBridge::add_writers_to_tracks_nts_(
             const auto topic = create_topic_for_participant_nts_(participant);
             auto reader = participant->create_reader(*topic);
 
+            if (!duplicate_filter_ && topic->topic_qos.deduplication != DeduplicationKind::NONE)
+            {
+                // Every Track of the topic must share the same filter to detect data received by another reader
+                duplicate_filter_ = std::make_shared<DuplicateFilter>(topic->topic_qos.deduplication);
+            }
+
+            if (!content_filter_ && !topic->topic_qos.content_filter->empty())
+            {
+                // The filter is compiled once for the topic type and shared by every Track and bridge using it
+                content_filter_ = ProcessContentFilterRegistry::get_instance()->filter(
+                    topic->topic_qos.content_filter,
+                    topic->type_name);
+            }
+
+            // Only the conflate setting is taken from the participant's topic, the rest of its QoS is the bridge's
             tracks_[id] = std::make_unique<Track>(
                 topic_,
                 id,
                 std::move(reader),
                 std::move(writers_of_track),
                 payload_pool_,
-                thread_pool_);
+                thread_pool_,
+                topic->topic_qos.deduplication != DeduplicationKind::NONE ? duplicate_filter_ : nullptr,
+                !topic->topic_qos.content_filter->empty() ? content_filter_ : nullptr,
+                topic->topic_qos.conflate);
 
             tracks_[id]->change_master(master_flag_);
 
@@ -0,0 +1,231 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/communication/dds/DuplicateFilter.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+DuplicateFilter::DuplicateFilter(
+        const DeduplicationKind& kind,
+        const unsigned int window_size /* = DEFAULT_WINDOW_SIZE */,
+        const unsigned int max_sources /* = DEFAULT_MAX_SOURCES */)
+    : kind_(kind)
+    , window_size_(((std::max(window_size, 1u) + 63) / 64) * 64)
+    , max_sources_(std::max(max_sources, 1u))
+{
+    logDebug(DDSPIPE_DUPLICATE_FILTER,
+            "Creating DuplicateFilter of kind " << kind_ << " with window of " << window_size_ << " samples.");
+}
+
+bool DuplicateFilter::is_duplicate(
+        const IRoutingData& data) noexcept
+{
+    if (kind_ == DeduplicationKind::NONE || data.internal_type_discriminator() != INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return false;
+    }
+
+    const RtpsPayloadData& rtps_data = static_cast<const RtpsPayloadData&>(data);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (kind_ == DeduplicationKind::SEQUENCE)
+    {
+        if (!rtps_data.origin_guid.is_valid() ||
+                rtps_data.origin_sequence_number == SequenceNumber() ||
+                rtps_data.origin_sequence_number == SequenceNumber::unknown())
+        {
+            // The sample cannot be identified
+            return false;
+        }
+
+        return is_sequence_duplicate_nts_(
+            rtps_data.origin_guid,
+            rtps_data.origin_sequence_number.to64long());
+    }
+
+    if (rtps_data.payload.length == 0)
+    {
+        // The sample cannot be identified
+        return false;
+    }
+
+    return is_hash_duplicate_nts_(rtps_data.payload, rtps_data.source_timestamp);
+}
+
+bool DuplicateFilter::is_sequence_duplicate_nts_(
+        const Guid& source_guid,
+        const std::uint64_t sequence_number) noexcept
+{
+    SequenceWindow& window = sequence_window_nts_(source_guid);
+
+    if (window.bitmap.empty())
+    {
+        // First sample from this source
+        window.bitmap.assign(window_size_ / 64, 0);
+        window.highest = sequence_number;
+        set_bit_(window, sequence_number);
+        return false;
+    }
+
+    if (sequence_number > window.highest)
+    {
+        // Slide the window, forgetting the sequence numbers that fall out of it
+        if (sequence_number - window.highest >= window_size_)
+        {
+            std::fill(window.bitmap.begin(), window.bitmap.end(), 0);
+        }
+        else
+        {
+            for (std::uint64_t seq = window.highest + 1; seq < sequence_number; ++seq)
+            {
+                set_bit_(window, seq, false);
+            }
+        }
+
+        window.highest = sequence_number;
+        set_bit_(window, sequence_number);
+        return false;
+    }
+
+    if (window.highest - sequence_number >= window_size_)
+    {
+        // Too old to be known, so it cannot be told apart from a sample that is only late
+        return false;
+    }
+
+    if (test_bit_(window, sequence_number))
+    {
+        return true;
+    }
+
+    set_bit_(window, sequence_number);
+    return false;
+}
+
+DuplicateFilter::SequenceWindow& DuplicateFilter::sequence_window_nts_(
+        const Guid& source_guid) noexcept
+{
+    auto it = sequence_windows_.find(source_guid);
+    if (it != sequence_windows_.end())
+    {
+        // Mark the source as the most recently seen
+        sources_order_.splice(sources_order_.begin(), sources_order_, it->second.order_it);
+        return it->second;
+    }
+
+    if (sequence_windows_.size() >= max_sources_)
+    {
+        // Forget the least recently seen source, most likely a writer that is gone
+        logDebug(DDSPIPE_DUPLICATE_FILTER,
+                "Forgetting sequence window of source " << sources_order_.back() << ".");
+
+        sequence_windows_.erase(sources_order_.back());
+        sources_order_.pop_back();
+    }
+
+    sources_order_.push_front(source_guid);
+
+    SequenceWindow& window = sequence_windows_[source_guid];
+    window.order_it = sources_order_.begin();
+    return window;
+}
+
+bool DuplicateFilter::is_hash_duplicate_nts_(
+        const Payload& payload,
+        const DataTime& source_timestamp) noexcept
+{
+    const std::uint64_t hash = hash_payload_(payload, source_timestamp);
+
+    if (!hashes_.insert(hash).second)
+    {
+        return true;
+    }
+
+    hashes_order_.push_back(hash);
+
+    if (hashes_order_.size() > window_size_)
+    {
+        // Forget the oldest sample
+        hashes_.erase(hashes_order_.front());
+        hashes_order_.pop_front();
+    }
+
+    return false;
+}
+
+bool DuplicateFilter::test_bit_(
+        const SequenceWindow& window,
+        const std::uint64_t sequence_number) const noexcept
+{
+    const std::uint64_t bit = sequence_number % window_size_;
+    return (window.bitmap[bit / 64] >> (bit % 64)) & 1u;
+}
+
+void DuplicateFilter::set_bit_(
+        SequenceWindow& window,
+        const std::uint64_t sequence_number,
+        const bool value /* = true */) const noexcept
+{
+    const std::uint64_t bit = sequence_number % window_size_;
+    const std::uint64_t mask = std::uint64_t(1) << (bit % 64);
+
+    if (value)
+    {
+        window.bitmap[bit / 64] |= mask;
+    }
+    else
+    {
+        window.bitmap[bit / 64] &= ~mask;
+    }
+}
+
+std::uint64_t DuplicateFilter::hash_payload_(
+        const Payload& payload,
+        const DataTime& source_timestamp) noexcept
+{
+    constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+
+    for (std::uint32_t i = 0; i < payload.length; ++i)
+    {
+        hash ^= payload.data[i];
+        hash *= FNV_PRIME;
+    }
+
+    // The source timestamp is kept by every route, and tells apart equal payloads sent at different times
+    const std::int64_t timestamp = source_timestamp.to_ns();
+    for (unsigned int i = 0; i < sizeof(timestamp); ++i)
+    {
+        hash ^= static_cast<std::uint8_t>(timestamp >> (i * 8));
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
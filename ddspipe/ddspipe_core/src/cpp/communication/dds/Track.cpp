@@ -23,6 +23,9 @@
 #include <cpp_utils/thread_pool/task/TaskId.hpp>
 
 #include <ddspipe_core/communication/dds/Track.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
+#include <ddspipe_core/tracing/tracepoints.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 
 std::atomic<bool> master_flag;
 
@@ -33,6 +36,7 @@ namespace core {
 using namespace eprosima::ddspipe::core::types;
 
 const unsigned int Track::MAX_MESSAGES_TRANSMIT_LOOP_ = 100;
+const unsigned int Track::CONFLATE_FLUSH_PERIOD_MS_ = 10;
 
 Track::Track(
         const utils::Heritable<DistributedTopic>& topic,
@@ -40,7 +44,10 @@ Track::Track(
         const std::shared_ptr<IReader>& reader,
         std::map<ParticipantId, std::shared_ptr<IWriter>>&& writers,
         const std::shared_ptr<PayloadPool>& payload_pool,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool) noexcept
+        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const std::shared_ptr<DuplicateFilter>& duplicate_filter /* = nullptr */,
+        const std::shared_ptr<ContentFilter>& content_filter /* = nullptr */,
+        const bool conflate /* = false */) noexcept
     : topic_(topic)
     , reader_participant_id_(reader_participant_id)
     , reader_(std::move(reader))
@@ -52,6 +59,15 @@ Track::Track(
     , transmit_task_id_(utils::new_unique_task_id())
     , thread_pool_(thread_pool)
     , transport_priority_id_(topic->topic_qos.transport_priority)
+    , conflate_(conflate)
+    , conflated_pending_(0)
+    , max_age_ns_(static_cast<std::int64_t>(topic->topic_qos.max_age * 1e9))
+    , samples_received_(0)
+    , duplicate_filter_(duplicate_filter)
+    , content_filter_(content_filter)
+    , topic_metrics_(ProcessMetricsRegistry::get_instance()->topic_metrics(*topic))
+    , participant_metrics_(ProcessMetricsRegistry::get_instance()->participant_metrics(reader_participant_id))
+    , topic_latency_metrics_(ProcessMetricsRegistry::get_instance()->topic_latency_metrics(*topic))
 {
     logDebug(DDSPIPE_TRACK, "Creating Track " << *this << ".");
 
@@ -63,6 +79,16 @@ Track::Track(
         transmit_task_id_,
         std::bind(&Track::transmit_, this));
 
+    if (conflate_)
+    {
+        // Retry the samples that the writers could not accept even if no new data arrives
+        conflate_flush_handler_ = std::make_unique<utils::event::PeriodicEventHandler>(
+            std::bind(&Track::retry_conflated_data_, this),
+            CONFLATE_FLUSH_PERIOD_MS_);
+    }
+
+    DDSPIPE_TRACEPOINT(track_created, this, topic_->m_topic_name.c_str(), reader_participant_id_.c_str());
+
     logDebug(DDSPIPE_TRACK, "Track " << *this << " created.");
 }
 
@@ -70,6 +96,9 @@ Track::~Track()
 {
     logDebug(DDSPIPE_TRACK, "Destroying Track " << *this << ".");
 
+    // Stop retrying the conflated samples before the Track is destroyed
+    conflate_flush_handler_.reset();
+
     // Disable reader and writers
     disable();
 
@@ -128,6 +157,10 @@ void Track::disable() noexcept
         {
             // Stop if there is a transmission in course till the data is sent
             std::unique_lock<std::mutex> lock(on_transmission_mutex_);
+
+            // Pending conflated samples are not sent once the Track is disabled
+            conflated_data_.clear();
+            conflated_pending_.store(0);
         }
 
         // Disabling Reader
@@ -162,6 +195,13 @@ void Track::remove_writer(
     std::lock_guard<std::mutex> track_lock(track_mutex_);
     std::lock_guard<std::mutex> transmission_lock(on_transmission_mutex_);
     writers_.erase(id);
+
+    auto it = conflated_data_.find(id);
+    if (it != conflated_data_.end())
+    {
+        conflated_pending_.fetch_sub(it->second.size());
+        conflated_data_.erase(it);
+    }
 }
 
 bool Track::has_writer(
@@ -188,6 +228,11 @@ void Track::change_master(bool flag) noexcept
     logDebug(DDSPIPE_TRACK, "Track " << *this << "master_flag:" << master_flag_);
 }
 
+std::uint64_t Track::samples_received() const noexcept
+{
+    return samples_received_.load(std::memory_order_relaxed);
+}
+
 void Track::data_available_() noexcept
 {
     // Only hear callback if it is enabled
@@ -218,6 +263,8 @@ void Track::transmit_() noexcept
     // enabled_ will be set to false before taking the mutex, so the track will finish after current iteration
     std::unique_lock<std::mutex> lock(on_transmission_mutex_);
 
+    DDSPIPE_TRACEPOINT(track_wakeup, this);
+
     // TODO: Count the times it loops to break it at some point if needed
     while (should_transmit_())
     {
@@ -234,6 +281,9 @@ void Track::transmit_() noexcept
 
         if (ret == utils::ReturnCode::RETCODE_NO_DATA)
         {
+            // The writers may have room now for the samples they could not accept before
+            flush_conflated_data_();
+
             // There is no more data, so reduce in 1 the status
             unsigned int previous_status = data_available_status_.fetch_sub(DataAvailableStatus::transmitting_data);
             if (previous_status == DataAvailableStatus::transmitting_data)
@@ -258,35 +308,238 @@ void Track::transmit_() noexcept
             continue;
         }
 
+        DDSPIPE_TRACEPOINT(track_take, this, data.get());
+
+        samples_received_.fetch_add(1, std::memory_order_relaxed);
+        topic_latency_metrics_->record_take(*data);
+
+        if (is_data_stale_(*data))
+        {
+            // Data is too old to be forwarded
+            add_dropped_metric_(MetricKind::dropped_stale);
+            logDebug(DDSPIPE_TRACK,
+                    "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
+                    " discarding data older than max age at take time.");
+            continue;
+        }
+
+        if (duplicate_filter_ && duplicate_filter_->is_duplicate(*data))
+        {
+            // Data has already been forwarded by a redundant route
+            add_dropped_metric_(MetricKind::dropped_duplicate);
+            logDebug(DDSPIPE_TRACK,
+                    "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
+                    " discarding duplicated data.");
+            continue;
+        }
+
+        if (content_filter_ && content_filter_->is_filtered_out(*data))
+        {
+            // Data does not match the content filter, so it is not sent to any writer
+            add_dropped_metric_(MetricKind::dropped_filtered);
+            logDebug(DDSPIPE_TRACK,
+                    "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
+                    " discarding data filtered out by content.");
+            continue;
+        }
+
+        if (conflate_)
+        {
+            // Keep only the latest sample of its instance until each writer can accept it
+            conflate_data_(std::move(data));
+            continue;
+        }
+
         logDebug(DDSPIPE_TRACK,
                 "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
                 " transmitting data from remote endpoint.");
 
         // Send data through writers
+        write_data_(*data);
+
+        // Let the data to be removed by itself
+    }
+}
+
+void Track::write_data_(
+        IRoutingData& data) noexcept
+{
+    for (auto& writer_it : writers_)
+    {
+        if (!write_data_(writer_it.first, *writer_it.second, data))
+        {
+            return;
+        }
+    }
+}
+
+bool Track::write_data_(
+        const ParticipantId& writer_id,
+        IWriter& writer,
+        IRoutingData& data) noexcept
+{
+    // Previous writes could have taken long enough for the data to become too old
+    if (is_data_stale_(data))
+    {
+        add_dropped_metric_(MetricKind::dropped_stale);
+        logDebug(DDSPIPE_TRACK,
+                "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
+                " discarding data older than max age at write time.");
+        return false;
+    }
+
+    logDebug(
+        DDSPIPE_TRACK,
+        "Forwarding data to writer " << writer_id << ".");
+
+    DDSPIPE_TRACEPOINT(track_write_begin, this, &data, &writer);
+
+    utils::ReturnCode ret = writer.write(data);
+
+    DDSPIPE_TRACEPOINT(track_write_end, this, &data, &writer,
+            ret == utils::ReturnCode::RETCODE_OK ? 1 : 0);
+
+    if (!ret)
+    {
+        logWarning(
+            DDSPIPE_TRACK,
+            "Error writting data in Track " << topic_->serialize()
+                                            << " for writer " << &writer
+                                            << ". Error code " << ret
+                                            << ". Skipping data for this writer and continue.");
+        return true;
+    }
+
+    topic_latency_metrics_->record_write(data);
+    return true;
+}
+
+void Track::conflate_data_(
+        std::unique_ptr<IRoutingData>&& data) noexcept
+{
+    if (data->internal_type_discriminator() != INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        // Only RTPS data knows its instance, so any other data is forwarded as it is
+        write_data_(*data);
+        return;
+    }
+
+    const InstanceHandle instance = static_cast<RtpsPayloadData*>(data.get())->instanceHandle;
+
+    {
+        // Only the writers pending for the sample must own it, so the last of them knows it is the last one
+        std::shared_ptr<IRoutingData> shared_data(std::move(data));
+
         for (auto& writer_it : writers_)
         {
-            logDebug(
-                DDSPIPE_TRACK,
-                "Forwarding data to writer " << writer_it.first << ".");
+            auto& pending = conflated_data_[writer_it.first][instance];
+            if (!pending)
+            {
+                conflated_pending_.fetch_add(1);
+            }
+
+            // Any previous pending sample of this instance is released here, as it is already stale
+            pending = shared_data;
+        }
+    }
+
+    flush_conflated_data_();
+}
+
+void Track::flush_conflated_data_() noexcept
+{
+    if (conflated_pending_.load() == 0)
+    {
+        return;
+    }
+
+    for (auto& writer_pending_it : conflated_data_)
+    {
+        auto& pending = writer_pending_it.second;
+        if (pending.empty())
+        {
+            continue;
+        }
 
-            ret = writer_it.second->write(*data);
+        auto writer_it = writers_.find(writer_pending_it.first);
+        if (writer_it == writers_.end())
+        {
+            conflated_pending_.fetch_sub(pending.size());
+            pending.clear();
+            continue;
+        }
 
-            if (!ret)
+        // Write only what the writer can accept, so its history does not evict samples not yet delivered
+        while (!pending.empty() && writer_it->second->can_accept())
+        {
+            auto instance_it = pending.begin();
+            if (is_data_stale_(*instance_it->second))
             {
-                logWarning(
-                    DDSPIPE_TRACK,
-                    "Error writting data in Track " << topic_->serialize()
-                                                    << " for writer " << writer_it.second.get()
-                                                    << ". Error code " << ret
-                                                    << ". Skipping data for this writer and continue.");
-                continue;
+                // The sample is pending for several writers, so it is counted only by the last one releasing it
+                if (instance_it->second.use_count() == 1)
+                {
+                    add_dropped_metric_(MetricKind::dropped_stale);
+                }
+                logDebug(DDSPIPE_TRACK,
+                        "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
+                        " discarding conflated data older than max age for writer " << writer_it->first << ".");
             }
+            else
+            {
+                write_data_(writer_it->first, *writer_it->second, *instance_it->second);
+            }
+            pending.erase(instance_it);
+            conflated_pending_.fetch_sub(1);
         }
 
-        // Let the data to be removed by itself
+        if (!pending.empty())
+        {
+            logDebug(DDSPIPE_TRACK,
+                    "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
+                    " keeping latest data of " << pending.size() << " instances for writer " <<
+                    writer_it->first << " until it can accept them.");
+        }
+    }
+}
+
+void Track::retry_conflated_data_() noexcept
+{
+    if (conflated_pending_.load() > 0)
+    {
+        // Awake the Track as if new data had arrived, so it flushes the pending samples in its transmission thread
+        data_available_();
     }
 }
 
+void Track::add_dropped_metric_(
+        const MetricKind kind) noexcept
+{
+    topic_metrics_->add(kind);
+    participant_metrics_->add(kind);
+}
+
+bool Track::is_data_stale_(
+        const IRoutingData& data) const noexcept
+{
+    if (max_age_ns_ <= 0 || data.internal_type_discriminator() != INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return false;
+    }
+
+    const DataTime& source_timestamp = static_cast<const RtpsPayloadData&>(data).source_timestamp;
+
+    if (source_timestamp == DataTime())
+    {
+        // The source did not set a timestamp, so its age is unknown
+        return false;
+    }
+
+    DataTime now;
+    DataTime::now(now);
+
+    return (now.to_ns() - source_timestamp.to_ns()) > max_age_ns_;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const Track& track)
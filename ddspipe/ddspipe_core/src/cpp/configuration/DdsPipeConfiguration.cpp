@@ -35,6 +35,13 @@ bool DdsPipeConfiguration::is_valid(
         return false;
     }
 
+    if (!discovery_snapshot_file.empty() &&
+            (discovery_snapshot_period == 0 || discovery_snapshot_reconcile_timeout == 0))
+    {
+        error_msg << "The discovery snapshot period and reconcile timeout must be positive.";
+        return false;
+    }
+
     return routes.is_valid(error_msg) && topic_routes.is_valid(error_msg);
 }
 
@@ -0,0 +1,161 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/configuration/DdsPipeConfigurationDiff.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+namespace {
+
+//! Whether two lists of manual topics are the same, including the QoS they set
+bool same_manual_topics(
+        const std::vector<types::ManualTopic>& lhs,
+        const std::vector<types::ManualTopic>& rhs) noexcept
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        // The filter comparison only takes into account its name and type
+        if (!(lhs[i].first == rhs[i].first) ||
+                !(lhs[i].first->topic_qos == rhs[i].first->topic_qos) ||
+                lhs[i].second != rhs[i].second)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//! Whether two routes configurations are the same
+bool same_routes(
+        const RoutesConfiguration& lhs,
+        const RoutesConfiguration& rhs) noexcept
+{
+    return lhs() == rhs();
+}
+
+//! Whether two topic routes configurations are the same
+bool same_topic_routes(
+        const TopicRoutesConfiguration& lhs,
+        const TopicRoutesConfiguration& rhs) noexcept
+{
+    const auto lhs_routes = lhs();
+    const auto rhs_routes = rhs();
+
+    if (lhs_routes.size() != rhs_routes.size())
+    {
+        return false;
+    }
+
+    for (const auto& it : lhs_routes)
+    {
+        auto it_rhs = rhs_routes.find(it.first);
+        if (it_rhs == rhs_routes.end() || !same_routes(it.second, it_rhs->second))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace */
+
+DdsPipeConfigurationDiff::DdsPipeConfigurationDiff(
+        const DdsPipeConfiguration& old_configuration,
+        const DdsPipeConfiguration& new_configuration) noexcept
+{
+    allowed_topics =
+            old_configuration.allowlist != new_configuration.allowlist ||
+            old_configuration.blocklist != new_configuration.blocklist;
+    master_flag = old_configuration.master_flag != new_configuration.master_flag;
+    routes = !same_routes(old_configuration.routes, new_configuration.routes);
+    topic_routes = !same_topic_routes(old_configuration.topic_routes, new_configuration.topic_routes);
+    manual_topics = !same_manual_topics(old_configuration.manual_topics, new_configuration.manual_topics);
+    topic_qos = !(old_configuration.topic_qos == new_configuration.topic_qos);
+
+    if (old_configuration.builtin_topics != new_configuration.builtin_topics)
+    {
+        not_reloadable.push_back("builtin-topics");
+    }
+
+    if (old_configuration.remove_unused_entities != new_configuration.remove_unused_entities)
+    {
+        not_reloadable.push_back("remove-unused-entities");
+    }
+
+    if (old_configuration.discovery_trigger != new_configuration.discovery_trigger)
+    {
+        not_reloadable.push_back("discovery-trigger");
+    }
+
+    if (old_configuration.bridge_creation_threads != new_configuration.bridge_creation_threads)
+    {
+        not_reloadable.push_back("bridge-creation-threads");
+    }
+
+    if (old_configuration.discovery_snapshot_file != new_configuration.discovery_snapshot_file ||
+            old_configuration.discovery_snapshot_period != new_configuration.discovery_snapshot_period ||
+            old_configuration.discovery_snapshot_reconcile_timeout !=
+            new_configuration.discovery_snapshot_reconcile_timeout)
+    {
+        not_reloadable.push_back("discovery-snapshot");
+    }
+
+    if (old_configuration.idle_bridge_ttl != new_configuration.idle_bridge_ttl)
+    {
+        not_reloadable.push_back("idle-bridge-ttl");
+    }
+}
+
+bool DdsPipeConfigurationDiff::empty() const noexcept
+{
+    return !allowed_topics && !master_flag && !affects_bridges() && not_reloadable.empty();
+}
+
+bool DdsPipeConfigurationDiff::affects_bridges() const noexcept
+{
+    return routes || topic_routes || manual_topics || topic_qos;
+}
+
+bool DdsPipeConfigurationDiff::affects_topic(
+        const DdsPipeConfiguration& old_configuration,
+        const DdsPipeConfiguration& new_configuration,
+        const utils::Heritable<types::DistributedTopic>& topic) noexcept
+{
+    if (!(old_configuration.topic_qos == new_configuration.topic_qos))
+    {
+        return true;
+    }
+
+    if (!same_routes(old_configuration.get_routes_config(topic), new_configuration.get_routes_config(topic)))
+    {
+        return true;
+    }
+
+    return !same_manual_topics(
+        old_configuration.get_manual_topics(*topic),
+        new_configuration.get_manual_topics(*topic));
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
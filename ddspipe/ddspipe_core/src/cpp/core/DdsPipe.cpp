@@ -12,7 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/exception/ConfigurationException.hpp>
@@ -22,6 +29,8 @@
 #include <cpp_utils/utils.hpp>
 
 #include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/dynamic/DiscoverySnapshot.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -40,6 +49,7 @@ DdsPipe::DdsPipe(
     , payload_pool_(payload_pool)
     , participants_database_(participants_database)
     , thread_pool_(thread_pool)
+    , bridge_tasks_(std::make_unique<SerialTaskPool>(configuration.bridge_creation_threads))
     , enabled_(false)
 {
     logDebug(DDSPIPE, "Creating DDS Pipe.");
@@ -54,24 +64,43 @@ DdsPipe::DdsPipe(
                       "Configuration for DDS Pipe is invalid: " << error_msg);
     }
 
+    // Every topic discovered from now on takes the configured Topic QoS as default
+    TopicQoS::set_default_topic_qos(configuration_.topic_qos);
+
     // Initialize the allowed topics
     init_allowed_topics_();
 
-    // Add callback to be called by the discovery database when an Endpoint is discovered
-    discovery_database_->add_endpoint_discovered_callback(std::bind(&DdsPipe::discovered_endpoint_, this,
-            std::placeholders::_1));
-
-    // Add callback to be called by the discovery database when an Endpoint is updated
-    discovery_database_->add_endpoint_updated_callback(std::bind(&DdsPipe::updated_endpoint_, this,
-            std::placeholders::_1));
-
-    // Add callback to be called by the discovery database when an Endpoint is removed/dropped
-    discovery_database_->add_endpoint_erased_callback(std::bind(&DdsPipe::removed_endpoint_, this,
+    // Add callback to be called by the discovery database when a batch of Endpoints has been discovered, updated
+    // or removed/dropped, so bursts of discovery events are processed at once
+    discovery_database_->add_batch_processed_callback(std::bind(&DdsPipe::processed_batch_, this,
             std::placeholders::_1));
 
     // Create Bridges for builtin topics
     init_bridges_nts_(configuration_.builtin_topics);
 
+    if (!configuration_.discovery_snapshot_file.empty())
+    {
+        // Add the topics discovered in the previous execution, and persist the ones discovered in this one
+        init_snapshot_topics_nts_();
+        discovery_database_->enable_snapshot(
+            configuration_.discovery_snapshot_file,
+            configuration_.discovery_snapshot_period);
+    }
+
+    if (configuration_.idle_bridge_ttl > 0)
+    {
+        // Check twice per TTL, so a bridge is removed at most 1.5 TTL after becoming idle
+        idle_bridges_handler_ = std::make_unique<utils::event::PeriodicEventHandler>(
+            [this]()
+            {
+                reclaim_idle_bridges_();
+            },
+            std::max(configuration_.idle_bridge_ttl / 2, 1u));
+
+        // The metrics of the topics whose bridge has been reclaimed are forgotten after the same time
+        ProcessMetricsRegistry::get_instance()->unused_ttl(configuration_.idle_bridge_ttl);
+    }
+
     // Enable thread pool
     thread_pool_->enable();
 
@@ -91,6 +120,14 @@ DdsPipe::~DdsPipe()
 {
     logDebug(DDSPIPE, "Destroying DDS Pipe.");
 
+    // Stop reconciling the snapshot topics and reclaiming idle bridges, as they could remove topics while destroying
+    if (snapshot_reconcile_thread_.joinable())
+    {
+        snapshot_reconcile_cancel_.set_value();
+        snapshot_reconcile_thread_.join();
+    }
+    idle_bridges_handler_.reset();
+
     // Stop Discovery Database
     discovery_database_->stop();
 
@@ -100,6 +137,9 @@ DdsPipe::~DdsPipe()
     // Stop all communications
     disable();
 
+    // Wait for the bridges being created, enabled or disabled
+    bridge_tasks_->wait_all();
+
     // Destroy Bridges, so Writers and Readers are destroyed before the Databases
     bridges_.clear();
 
@@ -123,19 +163,98 @@ utils::ReturnCode DdsPipe::reload_configuration(
                   utils::Formatter() <<
                       "Configuration for Reload DDS Pipe is invalid: " << error_msg);
     }
-    reload_master_flag(new_configuration.master_flag);
 
-    auto allowed_topics = std::make_shared<ddspipe::core::AllowedTopicList>(
-        new_configuration.allowlist,
-        new_configuration.blocklist);
+    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+    logDebug(DDSPIPE, "Reloading DDS Pipe configuration...");
+
+    const DdsPipeConfigurationDiff diff(configuration_, new_configuration);
+
+    for (const auto& attribute : diff.not_reloadable)
+    {
+        logWarning(DDSPIPE, "Attribute " << attribute << " cannot be reloaded. Restart to apply its new value.");
+    }
+
+    if (diff.empty())
+    {
+        logDebug(DDSPIPE, "Same configuration, do nothing in reload.");
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    // Apply only the attributes that can be reloaded, keeping the old ones to know which topics are affected
+    const DdsPipeConfiguration old_configuration = configuration_;
+
+    configuration_.allowlist = new_configuration.allowlist;
+    configuration_.blocklist = new_configuration.blocklist;
+    configuration_.routes = new_configuration.routes;
+    configuration_.topic_routes = new_configuration.topic_routes;
+    configuration_.manual_topics = new_configuration.manual_topics;
+    configuration_.topic_qos = new_configuration.topic_qos;
+
+    // Only once the new configuration is accepted, the topics discovered from now on take its Topic QoS as default
+    TopicQoS::set_default_topic_qos(configuration_.topic_qos);
+
+    if (diff.master_flag)
+    {
+        reload_master_flag_nts_(new_configuration.master_flag);
+    }
+
+    if (diff.allowed_topics)
+    {
+        reload_allowed_topics_nts_(std::make_shared<ddspipe::core::AllowedTopicList>(
+                    configuration_.allowlist,
+                    configuration_.blocklist));
+    }
+
+    if (diff.affects_bridges())
+    {
+        // Copy the topics affected, as rebuilding them modifies current_topics_
+        std::vector<utils::Heritable<DistributedTopic>> affected_topics;
+
+        for (const auto& topic_it : current_topics_)
+        {
+            if (DdsPipeConfigurationDiff::affects_topic(old_configuration, configuration_, topic_it.first))
+            {
+                affected_topics.push_back(topic_it.first);
+            }
+        }
+
+        for (const auto& topic : affected_topics)
+        {
+            rebuild_topic_nts_(topic);
+        }
+
+        logInfo(DDSPIPE, "Configuration reload rebuilds " << affected_topics.size() << " bridges.");
+    }
 
-    return reload_allowed_topics_(allowed_topics);
+    return utils::ReturnCode::RETCODE_OK;
 }
 
 void DdsPipe::reload_master_flag(bool master_flag) noexcept
 {
-    // change_master(new_configuration.master_flag);
+    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+    reload_master_flag_nts_(master_flag);
+}
+
+LatencyDistributionSnapshot DdsPipe::mutex_hold_times() const noexcept
+{
+    return mutex_.hold_times();
+}
+
+LatencyDistributionSnapshot DdsPipe::mutex_wait_times() const noexcept
+{
+    return mutex_.wait_times();
+}
+
+void DdsPipe::reload_master_flag_nts_(
+        bool master_flag) noexcept
+{
     logDebug(DDSPIPE, "change the master_flag:"<<master_flag);
+
+    // Store it so the bridges being created get it as well
+    configuration_.master_flag = master_flag;
+
     for(auto &it_bridge : bridges_)
     {
         it_bridge.second->change_master_flag(master_flag);
@@ -145,7 +264,7 @@ void DdsPipe::reload_master_flag(bool master_flag) noexcept
 
 utils::ReturnCode DdsPipe::enable() noexcept
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<MonitoredMutex> lock(mutex_);
 
     if (!enabled_)
     {
@@ -176,7 +295,7 @@ utils::ReturnCode DdsPipe::enable() noexcept
 
 utils::ReturnCode DdsPipe::disable() noexcept
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<MonitoredMutex> lock(mutex_);
 
     if (enabled_)
     {
@@ -204,13 +323,9 @@ void DdsPipe::init_allowed_topics_()
     logInfo(DDSPROXY, "DDS Proxy configured with allowed topics: " << *allowed_topics_);
 }
 
-utils::ReturnCode DdsPipe::reload_allowed_topics_(
+utils::ReturnCode DdsPipe::reload_allowed_topics_nts_(
         const std::shared_ptr<AllowedTopicList>& allowed_topics)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    logDebug(DDSPIPE, "Reloading DDS Pipe configuration...");
-
     // Check if it should change or is the same configuration
     if (*allowed_topics == *allowed_topics_)
     {
@@ -267,25 +382,87 @@ utils::ReturnCode DdsPipe::reload_allowed_topics_(
     return utils::ReturnCode::RETCODE_OK;
 }
 
-void DdsPipe::discovered_endpoint_(
-        const Endpoint& endpoint) noexcept
+void DdsPipe::processed_batch_(
+        const std::vector<DatabaseEvent>& batch) noexcept
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    discovered_endpoint_nts_(endpoint);
+    std::lock_guard<MonitoredMutex> lock(mutex_);
+    processed_batch_nts_(batch);
 }
 
-void DdsPipe::updated_endpoint_(
-        const Endpoint& endpoint) noexcept
+void DdsPipe::processed_batch_nts_(
+        const std::vector<DatabaseEvent>& batch) noexcept
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    updated_endpoint_nts_(endpoint);
-}
+    logDebug(DDSPIPE, "Processing a batch of " << batch.size() << " discovery events in DDS Pipe core.");
 
-void DdsPipe::removed_endpoint_(
-        const Endpoint& endpoint) noexcept
-{
-    std::lock_guard<std::mutex> lock(mutex_);
-    removed_endpoint_nts_(endpoint);
+    // Net change in the number of relevant active endpoints of each topic and discoverer participant
+    struct RouteChange
+    {
+        Endpoint endpoint;
+        int active_endpoints_delta;
+    };
+
+    std::map<std::pair<std::string, ParticipantId>, RouteChange> route_changes;
+
+    for (const auto& event : batch)
+    {
+        const Endpoint& endpoint = event.endpoint;
+
+        if (RpcTopic::is_service_topic(endpoint.topic))
+        {
+            // Services are not coalesced, as each server is handled individually by its RpcBridge
+            if (event.operation == DatabaseOperation::add)
+            {
+                discovered_endpoint_nts_(endpoint);
+            }
+            else if (event.operation == DatabaseOperation::erase)
+            {
+                removed_endpoint_nts_(endpoint);
+            }
+            continue;
+        }
+
+        if (!is_endpoint_kind_relevant_(endpoint))
+        {
+            continue;
+        }
+
+        const bool is_active = event.operation != DatabaseOperation::erase && endpoint.active;
+
+        auto it = route_changes.emplace(
+            std::make_pair(endpoint.topic.topic_unique_name(), endpoint.discoverer_participant_id),
+            RouteChange{endpoint, 0}).first;
+
+        it->second.endpoint = endpoint;
+        it->second.active_endpoints_delta += (is_active ? 1 : 0) - (event.was_active ? 1 : 0);
+    }
+
+    for (const auto& route_change : route_changes)
+    {
+        const Endpoint& endpoint = route_change.second.endpoint;
+
+        if (route_change.second.active_endpoints_delta == 0)
+        {
+            // Every change in this topic and participant has been undone in the same batch
+            continue;
+        }
+
+        // The database already holds the state after the batch
+        const std::size_t active_endpoints = count_relevant_endpoints_(endpoint.topic,
+                        endpoint.discoverer_participant_id);
+        const std::int64_t previous_active_endpoints =
+                static_cast<std::int64_t>(active_endpoints) - route_change.second.active_endpoints_delta;
+
+        if (previous_active_endpoints == 0 && active_endpoints > 0)
+        {
+            // First relevant endpoint of the topic discovered by this participant
+            discovered_topic_nts_(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
+        }
+        else if (previous_active_endpoints > 0 && active_endpoints == 0 && configuration_.remove_unused_entities)
+        {
+            // Last relevant endpoint of the topic discovered by this participant
+            removed_topic_nts_(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
+        }
+    }
 }
 
 void DdsPipe::discovered_endpoint_nts_(
@@ -325,37 +502,60 @@ void DdsPipe::removed_endpoint_nts_(
     }
     else if (configuration_.remove_unused_entities && is_endpoint_relevant_(endpoint))
     {
-        const auto& topic = utils::Heritable<DdsTopic>::make_heritable(endpoint.topic);
-
-        // Remove the subscriber from the topic.
-        auto it_bridge = bridges_.find(topic);
-
-        if (it_bridge != bridges_.end() && endpoint.discoverer_participant_id != DEFAULT_PARTICIPANT_ID)
-        {
-            it_bridge->second->remove_writer(endpoint.discoverer_participant_id);
-        }
+        removed_topic_nts_(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
     }
 }
 
-void DdsPipe::updated_endpoint_nts_(
-        const Endpoint& endpoint) noexcept
+void DdsPipe::remove_topic_nts_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
 {
-    logDebug(DDSPIPE, "Endpoint updated in DDS Pipe core: " << endpoint << ".");
+    logInfo(DDSPIPE, "Removing topic: " << topic << ".");
 
-    // Don't send updated information to service topics.
-    if (RpcTopic::is_service_topic(endpoint.topic))
+    current_topics_.erase(topic);
+    bridges_activity_.erase(topic);
+
+    // Destroy the bridge after any previous operation over it
+    emit_bridge_task_nts_(topic, [this, topic]()
+            {
+                std::shared_ptr<DdsBridge> bridge;
+
+                {
+                    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+                    auto it_bridge = bridges_.find(topic);
+                    if (it_bridge == bridges_.end())
+                    {
+                        return;
+                    }
+
+                    bridge = std::move(it_bridge->second);
+                    bridges_.erase(it_bridge);
+                }
+
+                // Destroy its entities without the mutex locked
+                bridge->disable();
+                bridge.reset();
+            });
+}
+
+void DdsPipe::removed_topic_nts_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
+{
+    if (topic->topic_discoverer() == DEFAULT_PARTICIPANT_ID)
     {
         return;
     }
 
-    if (endpoint.active)
-    {
-        discovered_endpoint_nts_(endpoint);
-    }
-    else
-    {
-        removed_endpoint_nts_(endpoint);
-    }
+    // Remove the subscriber from the topic, after any pending creation of its writer.
+    emit_bridge_task_nts_(topic, [this, topic]()
+            {
+                auto bridge = find_bridge_(topic);
+
+                if (bridge)
+                {
+                    bridge->remove_writer(topic->topic_discoverer());
+                }
+            });
 }
 
 bool DdsPipe::is_endpoint_kind_relevant_(
@@ -381,6 +581,51 @@ bool DdsPipe::is_endpoint_kind_relevant_(
     }
 }
 
+std::size_t DdsPipe::count_relevant_endpoints_(
+        const ITopic& topic,
+        const ParticipantId& discoverer_participant_id) noexcept
+{
+    // Count the active endpoints through the database indexes,
+    // so the whole database is neither iterated nor copied in every discovery event.
+    std::size_t relevant_endpoints = 0;
+
+    if (configuration_.discovery_trigger == DiscoveryTrigger::READER ||
+            configuration_.discovery_trigger == DiscoveryTrigger::ANY)
+    {
+        relevant_endpoints += discovery_database_->count_active_endpoints(
+            topic, discoverer_participant_id, EndpointKind::reader);
+    }
+
+    if (configuration_.discovery_trigger == DiscoveryTrigger::WRITER ||
+            configuration_.discovery_trigger == DiscoveryTrigger::ANY)
+    {
+        relevant_endpoints += discovery_database_->count_active_endpoints(
+            topic, discoverer_participant_id, EndpointKind::writer);
+    }
+
+    return relevant_endpoints;
+}
+
+std::size_t DdsPipe::count_relevant_endpoints_(
+        const ITopic& topic) noexcept
+{
+    std::size_t relevant_endpoints = 0;
+
+    if (configuration_.discovery_trigger == DiscoveryTrigger::READER ||
+            configuration_.discovery_trigger == DiscoveryTrigger::ANY)
+    {
+        relevant_endpoints += discovery_database_->count_active_endpoints(topic, EndpointKind::reader);
+    }
+
+    if (configuration_.discovery_trigger == DiscoveryTrigger::WRITER ||
+            configuration_.discovery_trigger == DiscoveryTrigger::ANY)
+    {
+        relevant_endpoints += discovery_database_->count_active_endpoints(topic, EndpointKind::writer);
+    }
+
+    return relevant_endpoints;
+}
+
 bool DdsPipe::is_endpoint_relevant_(
         const Endpoint& endpoint) noexcept
 {
@@ -389,27 +634,20 @@ bool DdsPipe::is_endpoint_relevant_(
         return false;
     }
 
-    auto is_endpoint_relevant = [&](const Endpoint& entity)
-            {
-                return entity.active &&
-                       is_endpoint_kind_relevant_(entity) &&
-                       entity.topic == endpoint.topic &&
-                       entity.discoverer_participant_id == endpoint.discoverer_participant_id;
-            };
-
-    const auto& relevant_endpoints = discovery_database_->get_endpoints(is_endpoint_relevant);
+    const std::size_t relevant_endpoints = count_relevant_endpoints_(endpoint.topic,
+                    endpoint.discoverer_participant_id);
 
     if (endpoint.active)
     {
         // An active reader is relevant when it is the only active reader in a topic
         // with a discoverer participant id.
-        return relevant_endpoints.size() == 1 && relevant_endpoints.count(endpoint.guid);
+        return relevant_endpoints == 1 && discovery_database_->endpoint_active(endpoint.guid);
     }
     else
     {
         // An inactive reader is relevant when there aren't any active readers in a topic
         // with a discoverer participant id.
-        return relevant_endpoints.size() == 0;
+        return relevant_endpoints == 0;
     }
 }
 
@@ -423,15 +661,156 @@ void DdsPipe::init_bridges_nts_(
     }
 }
 
+void DdsPipe::init_snapshot_topics_nts_() noexcept
+{
+    if (configuration_.remove_unused_entities)
+    {
+        // Writers are only created in the participants that discover each topic, so there is nothing to anticipate
+        logWarning(DDSPIPE,
+                "Discovery snapshot topics are not created in advance when remove-unused-entities is enabled.");
+        return;
+    }
+
+    const auto entries = DiscoverySnapshot::load(configuration_.discovery_snapshot_file);
+
+    for (const auto& entry : entries)
+    {
+        bool relevant = false;
+
+        switch (configuration_.discovery_trigger)
+        {
+            case DiscoveryTrigger::READER:
+                relevant = entry.has_readers;
+                break;
+
+            case DiscoveryTrigger::WRITER:
+                relevant = entry.has_writers;
+                break;
+
+            case DiscoveryTrigger::ANY:
+                relevant = entry.has_readers || entry.has_writers;
+                break;
+
+            default:
+                break;
+        }
+
+        if (!relevant || !allowed_topics_->is_topic_allowed(entry.topic))
+        {
+            continue;
+        }
+
+        const auto topic = utils::Heritable<DdsTopic>::make_heritable(entry.topic);
+
+        if (current_topics_.find(topic) != current_topics_.end())
+        {
+            continue;
+        }
+
+        logDebug(DDSPIPE, "Adding topic " << topic << " from discovery snapshot.");
+
+        discovered_topic_nts_(topic);
+        snapshot_topics_.insert(topic);
+    }
+
+    if (snapshot_topics_.empty())
+    {
+        return;
+    }
+
+    logInfo(DDSPIPE,
+            snapshot_topics_.size() << " topics added from discovery snapshot " <<
+            configuration_.discovery_snapshot_file << ".");
+
+    // Reconcile only once, unless the DdsPipe is destroyed before the timeout
+    snapshot_reconcile_thread_ = std::thread(
+        [this, cancelled = snapshot_reconcile_cancel_.get_future()]()
+        {
+            const auto timeout = std::chrono::milliseconds(configuration_.discovery_snapshot_reconcile_timeout);
+
+            if (cancelled.wait_for(timeout) == std::future_status::timeout)
+            {
+                reconcile_snapshot_topics_();
+            }
+        });
+}
+
+void DdsPipe::reconcile_snapshot_topics_() noexcept
+{
+    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+    for (const auto& topic : snapshot_topics_)
+    {
+        if (count_relevant_endpoints_(*topic) == 0)
+        {
+            // Not discovered again since the restart, so it is not in use anymore
+            remove_topic_nts_(topic);
+        }
+    }
+
+    snapshot_topics_.clear();
+}
+
+void DdsPipe::reclaim_idle_bridges_() noexcept
+{
+    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto ttl = std::chrono::milliseconds(configuration_.idle_bridge_ttl);
+
+    std::vector<utils::Heritable<DistributedTopic>> idle_topics;
+
+    for (const auto& it_bridge : bridges_)
+    {
+        const auto& topic = it_bridge.first;
+
+        if (configuration_.builtin_topics.find(topic) != configuration_.builtin_topics.end())
+        {
+            // Builtin topics are kept even if they are not used
+            continue;
+        }
+
+        const std::uint64_t samples_received = it_bridge.second->samples_received();
+
+        auto it_activity = bridges_activity_.emplace(topic, BridgeActivity{samples_received, now});
+
+        if (it_activity.second)
+        {
+            // First check of this bridge
+            continue;
+        }
+
+        BridgeActivity& activity = it_activity.first->second;
+
+        if (samples_received != activity.samples_received || count_relevant_endpoints_(*topic) > 0)
+        {
+            activity.samples_received = samples_received;
+            activity.last_activity = now;
+        }
+        else if (now - activity.last_activity >= ttl)
+        {
+            idle_topics.push_back(topic);
+        }
+    }
+
+    // The bridges are removed in the bridge tasks pool, so bridges_ is not modified while iterating it
+    for (const auto& topic : idle_topics)
+    {
+        logInfo(DDSPIPE, "Topic " << topic << " has been idle for longer than " << ttl.count() << " ms.");
+
+        remove_topic_nts_(topic);
+    }
+}
+
 void DdsPipe::discovered_topic_nts_(
         const utils::Heritable<DistributedTopic>& topic) noexcept
 {
     logInfo(DDSPIPE, "Discovered topic: " << topic << " by: " << topic->topic_discoverer() << ".");
 
-    // Check if the bridge (and the topic) already exist.
-    auto it_bridge = bridges_.find(topic);
+    // Check if the topic already exists. Its bridge may still be being created.
+    auto it_topic = current_topics_.find(topic);
 
-    if (it_bridge == bridges_.end())
+    if (it_topic == current_topics_.end())
     {
         // Add topic to current_topics as not activated
         current_topics_.emplace(topic, false);
@@ -444,8 +823,27 @@ void DdsPipe::discovered_topic_nts_(
     }
     else if (configuration_.remove_unused_entities && topic->topic_discoverer() != DEFAULT_PARTICIPANT_ID)
     {
-        // The bridge already exists. Create a writer in the participant who discovered it.
-        it_bridge->second->create_writer(topic->topic_discoverer());
+        // The topic already exists. Create a writer in the participant who discovered it (once its bridge exists).
+        emit_bridge_task_nts_(topic, [this, topic]()
+                {
+                    auto bridge = find_bridge_(topic);
+
+                    if (!bridge)
+                    {
+                        return;
+                    }
+
+                    try
+                    {
+                        bridge->create_writer(topic->topic_discoverer());
+                    }
+                    catch (const utils::InitializationException& e)
+                    {
+                        logError(DDSPIPE,
+                                "Error creating Writer in " << topic->topic_discoverer() << " for topic " << topic <<
+                                ". Error code:" << e.what() << ".");
+                    }
+                });
     }
 }
 
@@ -499,29 +897,44 @@ void DdsPipe::create_new_bridge_nts_(
         const utils::Heritable<DistributedTopic>& topic,
         bool enabled /*= false*/) noexcept
 {
-    logInfo(DDSPIPE, "Creating Bridge for topic: " << topic << ".");
+    auto new_bridge = create_bridge_(
+        topic,
+        configuration_.master_flag,
+        configuration_.get_routes_config(topic),
+        configuration_.get_manual_topics(dynamic_cast<const core::ITopic&>(*topic)));
 
-    try
+    if (!new_bridge)
     {
-        auto routes_config = configuration_.get_routes_config(topic);
-        auto manual_topics = configuration_.get_manual_topics(dynamic_cast<const core::ITopic&>(*topic));
+        return;
+    }
 
-        // Create bridge instance
-        auto new_bridge = std::make_unique<DdsBridge>(topic,
-                        participants_database_,
-                        payload_pool_,
-                        thread_pool_,
-                        routes_config,
-                        configuration_.remove_unused_entities,
-                        configuration_.master_flag,
-                        manual_topics);   
+    if (enabled)
+    {
+        new_bridge->enable();
+    }
 
-        if (enabled)
-        {
-            new_bridge->enable();
-        }
+    bridges_[topic] = std::move(new_bridge);
+}
+
+std::shared_ptr<DdsBridge> DdsPipe::create_bridge_(
+        const utils::Heritable<DistributedTopic>& topic,
+        const bool master_flag,
+        const RoutesConfiguration& routes_config,
+        const std::vector<ManualTopic>& manual_topics) noexcept
+{
+    logInfo(DDSPIPE, "Creating Bridge for topic: " << topic << ".");
 
-        bridges_[topic] = std::move(new_bridge);
+    try
+    {
+        // Create bridge instance
+        return std::make_shared<DdsBridge>(topic,
+                       participants_database_,
+                       payload_pool_,
+                       thread_pool_,
+                       routes_config,
+                       configuration_.remove_unused_entities,
+                       master_flag,
+                       manual_topics);
     }
     catch (const utils::InitializationException& e)
     {
@@ -529,6 +942,158 @@ void DdsPipe::create_new_bridge_nts_(
                 "Error creating Bridge for topic " << topic <<
                 ". Error code:" << e.what() << ".");
     }
+
+    return nullptr;
+}
+
+std::shared_ptr<DdsBridge> DdsPipe::find_bridge_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
+{
+    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+    auto it_bridge = bridges_.find(topic);
+    return it_bridge == bridges_.end() ? nullptr : it_bridge->second;
+}
+
+void DdsPipe::emit_bridge_task_nts_(
+        const utils::Heritable<DistributedTopic>& topic,
+        SerialTaskPool::Task&& task) noexcept
+{
+    bridge_tasks_->emit(topic->topic_unique_name(), std::move(task));
+}
+
+void DdsPipe::activate_bridge_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
+{
+    bool master_flag;
+    RoutesConfiguration routes_config;
+    std::vector<ManualTopic> manual_topics;
+    std::shared_ptr<DdsBridge> bridge;
+
+    {
+        std::lock_guard<MonitoredMutex> lock(mutex_);
+
+        auto it_bridge = bridges_.find(topic);
+        if (it_bridge != bridges_.end())
+        {
+            bridge = it_bridge->second;
+        }
+        else
+        {
+            // The configuration may be reloaded meanwhile, so copy what the Bridge needs
+            master_flag = configuration_.master_flag;
+            routes_config = configuration_.get_routes_config(topic);
+            manual_topics = configuration_.get_manual_topics(dynamic_cast<const core::ITopic&>(*topic));
+        }
+    }
+
+    if (!bridge)
+    {
+        // The Bridge did not exist. Create it (and its entities) without the mutex locked.
+        bridge = create_bridge_(topic, master_flag, routes_config, manual_topics);
+
+        if (!bridge)
+        {
+            return;
+        }
+
+        std::lock_guard<MonitoredMutex> lock(mutex_);
+
+        if (configuration_.master_flag != master_flag)
+        {
+            // The master flag has been reloaded while the Bridge was being created
+            bridge->change_master_flag(configuration_.master_flag);
+        }
+
+        bridges_[topic] = bridge;
+    }
+
+    // Enable bridge. In case it is already enabled nothing should happen
+    bridge->enable();
+}
+
+void DdsPipe::create_discovered_writers_(
+        const utils::Heritable<DistributedTopic>& topic,
+        const std::shared_ptr<DdsBridge>& bridge) noexcept
+{
+    for (const auto& participant_id : participants_database_->get_participants_ids())
+    {
+        if (participant_id == topic->topic_discoverer() || count_relevant_endpoints_(*topic, participant_id) == 0)
+        {
+            continue;
+        }
+
+        try
+        {
+            bridge->create_writer(participant_id);
+        }
+        catch (const utils::InitializationException& e)
+        {
+            logError(DDSPIPE,
+                    "Error creating writer in Participant " << participant_id << " for topic " << topic <<
+                    ". Error code:" << e.what() << ".");
+        }
+    }
+}
+
+void DdsPipe::rebuild_topic_nts_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
+{
+    logInfo(DDSPIPE, "Rebuilding Bridge for topic: " << topic << ".");
+
+    // Apply the configured Topic QoS over a copy of the topic, so the topic used as key keeps being the same
+    utils::Heritable<DistributedTopic> new_topic = topic->copy();
+    new_topic->topic_qos.impose_qos(configuration_.topic_qos);
+
+    auto it_topic = current_topics_.find(topic);
+    const bool active = it_topic != current_topics_.end() && it_topic->second;
+    if (it_topic != current_topics_.end())
+    {
+        current_topics_.erase(it_topic);
+    }
+    current_topics_[new_topic] = active;
+
+    // Destroy the old bridge and create the new one after any previous operation over it
+    emit_bridge_task_nts_(new_topic, [this, new_topic, active]()
+            {
+                std::shared_ptr<DdsBridge> bridge;
+
+                {
+                    std::lock_guard<MonitoredMutex> lock(mutex_);
+
+                    auto it_bridge = bridges_.find(new_topic);
+                    if (it_bridge != bridges_.end())
+                    {
+                        bridge = std::move(it_bridge->second);
+                        bridges_.erase(it_bridge);
+                    }
+                }
+
+                // Destroy its entities without the mutex locked
+                if (bridge)
+                {
+                    bridge->disable();
+                    bridge.reset();
+                }
+
+                if (!active)
+                {
+                    // It is created again once the topic is activated
+                    return;
+                }
+
+                activate_bridge_(new_topic);
+
+                if (configuration_.remove_unused_entities)
+                {
+                    bridge = find_bridge_(new_topic);
+
+                    if (bridge)
+                    {
+                        create_discovered_writers_(new_topic, bridge);
+                    }
+                }
+            });
 }
 
 void DdsPipe::create_new_service_nts_(
@@ -548,19 +1113,11 @@ void DdsPipe::activate_topic_nts_(
     // Modify current_topics_ and set this topic as active
     current_topics_[topic] = true;
 
-    // Enable bridge. In case it is already enabled nothing should happen
-    auto it_bridge = bridges_.find(topic);
-
-    if (it_bridge == bridges_.end())
-    {
-        // The Bridge did not exist
-        create_new_bridge_nts_(topic, true);
-    }
-    else
-    {
-        // The Bridge already exists
-        it_bridge->second->enable();
-    }
+    // Create (if it did not exist) and enable the bridge in the pool, after any previous operation over it
+    emit_bridge_task_nts_(topic, [this, topic]()
+            {
+                activate_bridge_(topic);
+            });
 }
 
 void DdsPipe::deactivate_topic_nts_(
@@ -571,15 +1128,17 @@ void DdsPipe::deactivate_topic_nts_(
     // Modify current_topics_ and set this topic as not active
     current_topics_[topic] = false;
 
-    // Disable bridge. In case it is already disabled nothing should happen
-    auto it_bridge = bridges_.find(topic);
-
-    if (it_bridge != bridges_.end())
-    {
-        // The Bridge already exists
-        it_bridge->second->disable();
-    }
-    // If the Bridge does not exist, there is no need to create it
+    // Disable bridge after any previous operation over it. In case it is already disabled nothing should happen
+    emit_bridge_task_nts_(topic, [this, topic]()
+            {
+                auto bridge = find_bridge_(topic);
+
+                // If the Bridge does not exist, there is no need to create it
+                if (bridge)
+                {
+                    bridge->disable();
+                }
+            });
 }
 
 void DdsPipe::activate_all_topics_nts_() noexcept
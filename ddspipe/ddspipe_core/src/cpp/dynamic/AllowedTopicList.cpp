@@ -17,28 +17,49 @@
  *
  */
 
+#include <functional>
+#include <thread>
+
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
+#include <cpp_utils/types/cast.hpp>
 #include <cpp_utils/utils.hpp>
 
 #include <dynamic/AllowedTopicList.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 
 namespace eprosima {
 namespace ddspipe {
 namespace core {
 
+constexpr const std::size_t AllowedTopicList::DecisionCache::NUMBER_OF_SLOTS;
+constexpr const std::size_t AllowedTopicList::DecisionCache::MAX_PROBES;
+
 AllowedTopicList::AllowedTopicList()
+    : compiled_(nullptr)
+    , epoch_(0)
 {
+    readers_[0].store(0);
+    readers_[1].store(0);
+
+    compile_nts_();
 }
 
 // TODO: Add logs
 AllowedTopicList::AllowedTopicList(
         const std::set<utils::Heritable<types::IFilterTopic>>& allowlist,
         const std::set<utils::Heritable<types::IFilterTopic>>& blocklist) noexcept
+    : compiled_(nullptr)
+    , epoch_(0)
 {
+    readers_[0].store(0);
+    readers_[1].store(0);
+
     allowlist_ = AllowedTopicList::get_topic_list_without_repetition_(allowlist);
     blocklist_ = AllowedTopicList::get_topic_list_without_repetition_(blocklist);
 
+    compile_nts_();
+
     logDebug(DDSPIPE_ALLOWEDTOPICLIST, "New Allowed topic list created:");
     logDebug(DDSPIPE_ALLOWEDTOPICLIST, "New Allowed topic list created: " << *this << ".");
 }
@@ -46,9 +67,13 @@ AllowedTopicList::AllowedTopicList(
 AllowedTopicList& AllowedTopicList::operator =(
         const AllowedTopicList& other)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
     this->allowlist_ = other.allowlist_;
     this->blocklist_ = other.blocklist_;
 
+    compile_nts_();
+
     return *this;
 }
 
@@ -56,6 +81,9 @@ AllowedTopicList::~AllowedTopicList()
 {
     // Eliminate all topics
     clear();
+
+    // No check can be running while the object is destroyed
+    delete compiled_.load();
 }
 
 void AllowedTopicList::clear() noexcept
@@ -64,58 +92,200 @@ void AllowedTopicList::clear() noexcept
 
     blocklist_.clear();
     allowlist_.clear();
+
+    compile_nts_();
 }
 
 bool AllowedTopicList::is_topic_allowed(
         const ITopic& topic) const noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    const std::size_t reader_counter = begin_read_();
 
-    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
-    bool accepted = allowlist_.empty();
+    const bool allowed = is_topic_allowed_(*compiled_.load(), topic);
+
+    end_read_(reader_counter);
+
+    return allowed;
+}
+
+bool AllowedTopicList::is_service_allowed(
+        const types::RpcTopic& topic) const noexcept
+{
+    const std::size_t reader_counter = begin_read_();
+
+    // Check both topics with the same lists, so the verification is atomic
+    const CompiledLists* compiled = compiled_.load();
+    const bool allowed =
+            is_topic_allowed_(*compiled, topic.request_topic()) && is_topic_allowed_(*compiled, topic.reply_topic());
+
+    end_read_(reader_counter);
+
+    return allowed;
+}
+
+bool AllowedTopicList::operator ==(
+        const AllowedTopicList& other) const noexcept
+{
+    return allowlist_ == other.allowlist_ && blocklist_ == other.blocklist_;
+}
 
-    // Check if allowlist filter it (this will do anything if empty and accepted will be true)
-    for (const auto& filter : allowlist_)
+AllowedTopicList::DecisionCache::DecisionCache() noexcept
+{
+    for (auto& slot : slots_)
     {
-        if (filter->matches(topic))
-        {
-            accepted = true;
-            break;
-        }
+        slot.store(nullptr, std::memory_order_relaxed);
     }
+}
 
-    // Check if it has not passed the allowlist so blocklist is skipped
-    if (!accepted)
+AllowedTopicList::DecisionCache::~DecisionCache()
+{
+    for (auto& slot : slots_)
     {
-        return false;
+        delete slot.load(std::memory_order_relaxed);
     }
+}
+
+bool AllowedTopicList::DecisionCache::find(
+        const std::string& key,
+        bool& allowed) const noexcept
+{
+    const std::size_t position = std::hash<std::string>()(key);
 
-    // Allowlist passed, check blocklist
-    for (const auto& filter : blocklist_)
+    for (std::size_t probe = 0; probe < MAX_PROBES; ++probe)
     {
-        if (filter->matches(topic))
+        const Decision* decision = slots_[(position + probe) % NUMBER_OF_SLOTS].load(std::memory_order_acquire);
+
+        if (!decision)
         {
+            // Decisions are never removed, so it would have been stored here
             return false;
         }
+
+        if (decision->key == key)
+        {
+            allowed = decision->allowed;
+            return true;
+        }
     }
 
-    // Blocklist passed, the topic is allowed
-    return true;
+    return false;
 }
 
-bool AllowedTopicList::is_service_allowed(
-        const types::RpcTopic& topic) const noexcept
+void AllowedTopicList::DecisionCache::insert(
+        const std::string& key,
+        const bool allowed) noexcept
 {
-    // Lock mutex to perform the verification atomically
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    const std::size_t position = std::hash<std::string>()(key);
+    std::unique_ptr<Decision> new_decision(new Decision{key, allowed});
+
+    for (std::size_t probe = 0; probe < MAX_PROBES; ++probe)
+    {
+        auto& slot = slots_[(position + probe) % NUMBER_OF_SLOTS];
+        const Decision* decision = slot.load(std::memory_order_acquire);
+
+        if (!decision && slot.compare_exchange_strong(decision, new_decision.get(), std::memory_order_acq_rel))
+        {
+            new_decision.release();
+            return;
+        }
 
-    return is_topic_allowed(topic.request_topic()) && is_topic_allowed(topic.reply_topic());
+        // The slot is taken (decision holds its content), maybe by another check of the same topic meanwhile
+        if (decision->key == key)
+        {
+            return;
+        }
+    }
+
+    // No free slot near, so this topic is checked against the lists every time
 }
 
-bool AllowedTopicList::operator ==(
-        const AllowedTopicList& other) const noexcept
+AllowedTopicList::CompiledLists::CompiledLists(
+        const std::set<utils::Heritable<types::IFilterTopic>>& allowlist,
+        const std::set<utils::Heritable<types::IFilterTopic>>& blocklist)
+    : allowlist(allowlist)
+    , blocklist(blocklist)
 {
-    return allowlist_ == other.allowlist_ && blocklist_ == other.blocklist_;
+}
+
+bool AllowedTopicList::CompiledLists::is_topic_allowed(
+        const ITopic& topic) const noexcept
+{
+    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
+    if (!allowlist.empty() && !allowlist.matches(topic))
+    {
+        return false;
+    }
+
+    // Allowlist passed, the topic is allowed if it does not pass the blocklist
+    return !blocklist.matches(topic);
+}
+
+void AllowedTopicList::compile_nts_()
+{
+    const CompiledLists* replaced = compiled_.exchange(new CompiledLists(allowlist_, blocklist_));
+
+    if (replaced)
+    {
+        // The checks that began before the exchange could still be reading the replaced lists
+        wait_for_readers_nts_();
+        delete replaced;
+    }
+}
+
+std::size_t AllowedTopicList::begin_read_() const noexcept
+{
+    // Register before loading compiled_, so the lists loaded are not released until end_read_
+    const std::size_t reader_counter = epoch_.load() % 2;
+    readers_[reader_counter].fetch_add(1);
+
+    return reader_counter;
+}
+
+void AllowedTopicList::end_read_(
+        const std::size_t reader_counter) const noexcept
+{
+    readers_[reader_counter].fetch_sub(1);
+}
+
+void AllowedTopicList::wait_for_readers_nts_() const noexcept
+{
+    // A check may register in the counter of an epoch already finished, so both counters must be seen empty.
+    // Advancing the epoch before each wait makes the new checks register in the other counter, so it empties.
+    for (int i = 0; i < 2; ++i)
+    {
+        const std::size_t reader_counter = epoch_.fetch_add(1) % 2;
+
+        while (readers_[reader_counter].load() != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool AllowedTopicList::is_topic_allowed_(
+        const CompiledLists& compiled,
+        const ITopic& topic) noexcept
+{
+    // Only DDS topics are cached, as the wildcard filters depend on the kind of topic and not only on its name
+    if (!utils::can_cast<types::DdsTopic>(topic))
+    {
+        return compiled.is_topic_allowed(topic);
+    }
+
+    // The unique name concatenates name and type without separator, so build a key that cannot collide
+    const auto& dds_topic = static_cast<const types::DdsTopic&>(topic);
+    const std::string key = dds_topic.topic_name() + '\0' + dds_topic.type_name;
+
+    bool allowed;
+    if (compiled.decisions.find(key, allowed))
+    {
+        return allowed;
+    }
+
+    allowed = compiled.is_topic_allowed(topic);
+    compiled.decisions.insert(key, allowed);
+
+    return allowed;
 }
 
 std::set<utils::Heritable<types::IFilterTopic>> AllowedTopicList::get_topic_list_without_repetition_(
@@ -20,6 +20,7 @@
 #include <cpp_utils/exception/InconsistencyException.hpp>
 #include <cpp_utils/Log.hpp>
 
+#include <ddspipe_core/tracing/tracepoints.hpp>
 #include <dynamic/DiscoveryDatabase.hpp>
 
 namespace eprosima {
@@ -31,6 +32,7 @@ using namespace eprosima::ddspipe::core::types;
 DiscoveryDatabase::DiscoveryDatabase() noexcept
     : exit_(false)
     , enabled_(false)
+    , snapshot_outdated_(false)
 {
     logDebug(DDSPIPE_DISCOVERY_DATABASE, "Creating queue processing thread.");
 }
@@ -58,6 +60,13 @@ void DiscoveryDatabase::start() noexcept
 
 void DiscoveryDatabase::stop() noexcept
 {
+    if (snapshot_handler_)
+    {
+        // Stop the periodic snapshots and write the last one
+        snapshot_handler_.reset();
+        save_snapshot_();
+    }
+
     if (enabled_.load())
     {
         clear_all_callbacks();
@@ -82,24 +91,83 @@ bool DiscoveryDatabase::topic_exists(
         const DdsTopic& topic) const noexcept
 {
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return topic_index_.find(topic.topic_unique_name()) != topic_index_.end();
+}
+
+bool DiscoveryDatabase::endpoint_exists(
+        const Guid& guid) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return entities_.find(guid) != entities_.end();
+}
+
+bool DiscoveryDatabase::endpoint_active(
+        const Guid& guid) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
 
-    // Loop over every Endpoint checking if topic matches
-    // It is not required to be reference
-    for (const auto& entity : entities_)
+    auto it = entities_.find(guid);
+    return it != entities_.end() && it->second.active;
+}
+
+std::size_t DiscoveryDatabase::count_endpoints(
+        const DdsTopic& topic) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = topic_index_.find(topic.topic_unique_name());
+    return it == topic_index_.end() ? 0 : it->second.size();
+}
+
+std::size_t DiscoveryDatabase::count_active_endpoints(
+        const ITopic& topic,
+        const ParticipantId& discoverer_participant_id,
+        const EndpointKind kind) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = active_endpoints_index_.find(
+        ActiveEndpointsKey(topic.topic_unique_name(), discoverer_participant_id, kind));
+    return it == active_endpoints_index_.end() ? 0 : it->second.size();
+}
+
+std::size_t DiscoveryDatabase::count_active_endpoints(
+        const ITopic& topic,
+        const EndpointKind kind) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    const std::string topic_name = topic.topic_unique_name();
+    std::size_t count = 0;
+
+    // The keys of a topic are contiguous, as it is the first element of the key
+    for (auto it = active_endpoints_index_.lower_bound(ActiveEndpointsKey(topic_name, ParticipantId(), kind));
+            it != active_endpoints_index_.end() && std::get<0>(it->first) == topic_name;
+            ++it)
     {
-        if (entity.second.topic == topic)
+        if (std::get<2>(it->first) == kind)
         {
-            return true;
+            count += it->second.size();
         }
     }
-    return false;
+
+    return count;
 }
 
-bool DiscoveryDatabase::endpoint_exists(
-        const Guid& guid) const noexcept
+void DiscoveryDatabase::enable_snapshot(
+        const std::string& file_path,
+        const utils::Duration_ms period) noexcept
 {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    return entities_.find(guid) != entities_.end();
+    logInfo(DDSPIPE_DISCOVERY_DATABASE,
+            "Writing discovery snapshots to " << file_path << " every " << period << " ms.");
+
+    snapshot_file_path_ = file_path;
+    snapshot_handler_ = std::make_unique<utils::event::PeriodicEventHandler>(
+        [this]()
+        {
+            save_snapshot_();
+        },
+        period);
 }
 
 bool DiscoveryDatabase::add_endpoint_(
@@ -121,11 +189,16 @@ bool DiscoveryDatabase::add_endpoint_(
             else
             {
                 // If exists but inactive, modify entry
+                unindex_endpoint_nts_(it->second);
                 it->second = new_endpoint;
+                index_endpoint_nts_(it->second);
 
                 logInfo(DDSPIPE_DISCOVERY_DATABASE,
                         "Modifying an already discovered (inactive) Endpoint " << new_endpoint << ".");
 
+                DDSPIPE_TRACEPOINT(endpoint_updated, &new_endpoint.guid, new_endpoint.topic.m_topic_name.c_str(),
+                        new_endpoint.is_reader() ? 1 : 0);
+
                 return true;
             }
         }
@@ -135,9 +208,13 @@ bool DiscoveryDatabase::add_endpoint_(
 
             // Add it to the dictionary
             entities_.insert(std::pair<Guid, Endpoint>(new_endpoint.guid, new_endpoint));
+            index_endpoint_nts_(new_endpoint);
         }
     }
 
+    DDSPIPE_TRACEPOINT(endpoint_discovered, &new_endpoint.guid, new_endpoint.topic.m_topic_name.c_str(),
+            new_endpoint.is_reader() ? 1 : 0);
+
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     for (auto added_endpoint_callback : added_endpoint_callbacks_)
     {
@@ -166,12 +243,17 @@ bool DiscoveryDatabase::update_endpoint_(
             logInfo(DDSPIPE_DISCOVERY_DATABASE,
                     "Modifying an already discovered Endpoint " << endpoint_to_update << ".");
 
-            // Modify entry
+            // Modify entry (its activity may change, so it is reindexed)
+            unindex_endpoint_nts_(it->second);
             it->second = endpoint_to_update;
+            index_endpoint_nts_(it->second);
             // It is assumed a topic cannot change, otherwise further actions may be taken
         }
     }
 
+    DDSPIPE_TRACEPOINT(endpoint_updated, &endpoint_to_update.guid, endpoint_to_update.topic.m_topic_name.c_str(),
+            endpoint_to_update.is_reader() ? 1 : 0);
+
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     for (auto updated_endpoint_callback : updated_endpoint_callbacks_)
     {
@@ -189,17 +271,23 @@ utils::ReturnCode DiscoveryDatabase::erase_endpoint_(
 
         logInfo(DDSPIPE_DISCOVERY_DATABASE, "Erasing Endpoint " << endpoint_to_erase << ".");
 
-        auto erased = entities_.erase(endpoint_to_erase.guid);
+        auto it = entities_.find(endpoint_to_erase.guid);
 
-        if (erased == 0)
+        if (it == entities_.end())
         {
             throw utils::InconsistencyException(
                       utils::Formatter() <<
                           "Error erasing Endpoint " << endpoint_to_erase <<
                           " from database. Endpoint entry not found.");
         }
+
+        unindex_endpoint_nts_(it->second);
+        entities_.erase(it);
     }
 
+    DDSPIPE_TRACEPOINT(endpoint_erased, &endpoint_to_erase.guid, endpoint_to_erase.topic.m_topic_name.c_str(),
+            endpoint_to_erase.is_reader() ? 1 : 0);
+
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     for (auto erased_endpoint_callback : erased_endpoint_callbacks_)
     {
@@ -289,6 +377,14 @@ void DiscoveryDatabase::add_endpoint_erased_callback(
     erased_endpoint_callbacks_.push_back(endpoint_erased_callback);
 }
 
+void DiscoveryDatabase::add_batch_processed_callback(
+        std::function<void(const std::vector<DatabaseEvent>&)> batch_processed_callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+
+    batch_processed_callbacks_.push_back(batch_processed_callback);
+}
+
 void DiscoveryDatabase::clear_all_callbacks() noexcept
 {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
@@ -296,6 +392,7 @@ void DiscoveryDatabase::clear_all_callbacks() noexcept
     added_endpoint_callbacks_.clear();
     updated_endpoint_callbacks_.clear();
     erased_endpoint_callbacks_.clear();
+    batch_processed_callbacks_.clear();
 }
 
 void DiscoveryDatabase::queue_processing_thread_routine_() noexcept
@@ -333,6 +430,9 @@ void DiscoveryDatabase::push_item_to_queue_(
 
 void DiscoveryDatabase::process_queue_() noexcept
 {
+    // Operations applied in this batch, to notify them all at once
+    std::vector<DatabaseEvent> batch;
+
     entities_to_process_.Swap();
     while (!entities_to_process_.Empty())
     {
@@ -341,6 +441,9 @@ void DiscoveryDatabase::process_queue_() noexcept
         Endpoint entity = std::get<1>(queue_item);
         try
         {
+            // Only this thread modifies the database, so its state does not change until the operation is applied
+            const bool was_active = endpoint_active(entity.guid);
+
             if (db_operation == DatabaseOperation::add)
             {
                 add_endpoint_(entity);
@@ -353,6 +456,8 @@ void DiscoveryDatabase::process_queue_() noexcept
             {
                 erase_endpoint_(entity);
             }
+
+            batch.push_back({db_operation, entity, was_active});
         }
         catch (const utils::InconsistencyException& e)
         {
@@ -361,6 +466,124 @@ void DiscoveryDatabase::process_queue_() noexcept
         }
         entities_to_process_.Pop();
     }
+
+    if (batch.empty())
+    {
+        return;
+    }
+
+    logDebug(DDSPIPE_DISCOVERY_DATABASE, "Processed a batch of " << batch.size() << " database operations.");
+
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    for (auto batch_processed_callback : batch_processed_callbacks_)
+    {
+        batch_processed_callback(batch);
+    }
+}
+
+std::vector<DiscoverySnapshot::Entry> DiscoveryDatabase::snapshot_entries_() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    std::vector<DiscoverySnapshot::Entry> entries;
+
+    for (const auto& it : active_endpoints_index_)
+    {
+        const std::string& topic_name = std::get<0>(it.first);
+        const EndpointKind kind = std::get<2>(it.first);
+
+        if (entries.empty() || entries.back().topic.topic_unique_name() != topic_name)
+        {
+            // First key of a new topic (the keys of a topic are contiguous)
+            const Endpoint& endpoint = entities_.at(*it.second.begin());
+
+            if (RpcTopic::is_service_topic(endpoint.topic))
+            {
+                // Services require their servers to be discovered
+                continue;
+            }
+
+            DiscoverySnapshot::Entry entry;
+            entry.topic = endpoint.topic;
+            entry.has_readers = false;
+            entry.has_writers = false;
+            entries.push_back(std::move(entry));
+        }
+
+        entries.back().has_readers |= kind == EndpointKind::reader;
+        entries.back().has_writers |= kind == EndpointKind::writer;
+    }
+
+    return entries;
+}
+
+void DiscoveryDatabase::save_snapshot_() noexcept
+{
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+
+    if (!snapshot_outdated_.exchange(false))
+    {
+        return;
+    }
+
+    if (!DiscoverySnapshot::save(snapshot_file_path_, snapshot_entries_()))
+    {
+        // Try again in the next period
+        snapshot_outdated_.store(true);
+    }
+}
+
+void DiscoveryDatabase::index_endpoint_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    const std::string topic_name = endpoint.topic.topic_unique_name();
+
+    topic_index_[topic_name].insert(endpoint.guid);
+
+    if (endpoint.active)
+    {
+        const ActiveEndpointsKey key(topic_name, endpoint.discoverer_participant_id, endpoint.kind);
+        auto& guids = active_endpoints_index_[key];
+
+        if (guids.empty())
+        {
+            // A new kind of endpoint of this topic, so the snapshot must be updated
+            snapshot_outdated_.store(true);
+        }
+
+        guids.insert(endpoint.guid);
+    }
+}
+
+void DiscoveryDatabase::unindex_endpoint_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    const std::string topic_name = endpoint.topic.topic_unique_name();
+
+    auto it_topic = topic_index_.find(topic_name);
+    if (it_topic != topic_index_.end())
+    {
+        it_topic->second.erase(endpoint.guid);
+
+        // Remove empty entries so the topic does not exist anymore
+        if (it_topic->second.empty())
+        {
+            topic_index_.erase(it_topic);
+        }
+    }
+
+    auto it_active = active_endpoints_index_.find(
+        ActiveEndpointsKey(topic_name, endpoint.discoverer_participant_id, endpoint.kind));
+    if (it_active != active_endpoints_index_.end())
+    {
+        it_active->second.erase(endpoint.guid);
+
+        if (it_active->second.empty())
+        {
+            active_endpoints_index_.erase(it_active);
+            snapshot_outdated_.store(true);
+        }
+    }
 }
 
 } /* namespace core */
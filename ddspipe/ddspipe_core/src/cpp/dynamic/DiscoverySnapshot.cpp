@@ -0,0 +1,261 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <limits>
+#include <fstream>
+#include <sstream>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/dynamic/DiscoverySnapshot.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+constexpr const char* DiscoverySnapshot::HEADER;
+constexpr const char* DiscoverySnapshot::HEADER_V1;
+
+namespace {
+
+//! Number of fields of each line
+constexpr const std::size_t NUMBER_OF_FIELDS = 10;
+
+//! Number of fields of each line in the previous version (without history depth)
+constexpr const std::size_t NUMBER_OF_FIELDS_V1 = 9;
+
+//! Escape the characters that separate fields and lines
+std::string escape(
+        const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                escaped += "\\\\";
+                break;
+
+            case '\t':
+                escaped += "\\t";
+                break;
+
+            case '\n':
+                escaped += "\\n";
+                break;
+
+            default:
+                escaped += c;
+                break;
+        }
+    }
+
+    return escaped;
+}
+
+//! Undo \c escape
+std::string unescape(
+        const std::string& value)
+{
+    std::string unescaped;
+    unescaped.reserve(value.size());
+
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+        if (value[i] == '\\' && i + 1 < value.size())
+        {
+            ++i;
+            unescaped += value[i] == 't' ? '\t' : (value[i] == 'n' ? '\n' : value[i]);
+        }
+        else
+        {
+            unescaped += value[i];
+        }
+    }
+
+    return unescaped;
+}
+
+//! Parse a field with an integer in [0, max]
+bool parse_enumeration(
+        const std::string& field,
+        const int max,
+        int& value)
+{
+    if (field.size() != 1 || field[0] < '0' || field[0] - '0' > max)
+    {
+        return false;
+    }
+
+    value = field[0] - '0';
+    return true;
+}
+
+//! Parse a field with a history depth
+bool parse_history_depth(
+        const std::string& field,
+        HistoryDepthType& value)
+{
+    if (field.empty() || field.size() > std::numeric_limits<HistoryDepthType>::digits10 ||
+            field.find_first_not_of("0123456789") != std::string::npos)
+    {
+        return false;
+    }
+
+    value = static_cast<HistoryDepthType>(std::stoul(field));
+    return true;
+}
+
+} /* namespace */
+
+bool DiscoverySnapshot::save(
+        const std::string& file_path,
+        const std::vector<Entry>& entries) noexcept
+{
+    const std::string tmp_file_path = file_path + ".tmp";
+
+    {
+        std::ofstream file(tmp_file_path, std::ios::out | std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            logWarning(DDSPIPE_DISCOVERY_SNAPSHOT, "Cannot open discovery snapshot file " << tmp_file_path << ".");
+            return false;
+        }
+
+        file << HEADER << "\n";
+
+        for (const auto& entry : entries)
+        {
+            const TopicQoS& qos = entry.topic.topic_qos;
+
+            file <<
+                escape(entry.topic.m_topic_name) << "\t" <<
+                escape(entry.topic.type_name) << "\t" <<
+                static_cast<int>(qos.durability_qos.get_value()) << "\t" <<
+                static_cast<int>(qos.reliability_qos.get_value()) << "\t" <<
+                static_cast<int>(qos.ownership_qos.get_value()) << "\t" <<
+                (qos.keyed ? 1 : 0) << "\t" <<
+                (qos.use_partitions ? 1 : 0) << "\t" <<
+                (entry.has_readers ? 1 : 0) << "\t" <<
+                (entry.has_writers ? 1 : 0) << "\t" <<
+                qos.history_depth.get_value() << "\n";
+        }
+
+        if (!file.good())
+        {
+            logWarning(DDSPIPE_DISCOVERY_SNAPSHOT, "Error writing discovery snapshot file " << tmp_file_path << ".");
+            return false;
+        }
+    }
+
+    if (std::rename(tmp_file_path.c_str(), file_path.c_str()) != 0)
+    {
+        logWarning(DDSPIPE_DISCOVERY_SNAPSHOT, "Cannot replace discovery snapshot file " << file_path << ".");
+        return false;
+    }
+
+    logDebug(DDSPIPE_DISCOVERY_SNAPSHOT,
+            "Discovery snapshot with " << entries.size() << " topics written to " << file_path << ".");
+
+    return true;
+}
+
+std::vector<DiscoverySnapshot::Entry> DiscoverySnapshot::load(
+        const std::string& file_path) noexcept
+{
+    std::vector<Entry> entries;
+
+    std::ifstream file(file_path);
+
+    if (!file.is_open())
+    {
+        logInfo(DDSPIPE_DISCOVERY_SNAPSHOT, "No discovery snapshot found in " << file_path << ".");
+        return entries;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || (line != HEADER && line != HEADER_V1))
+    {
+        logWarning(DDSPIPE_DISCOVERY_SNAPSHOT,
+                "File " << file_path << " is not a discovery snapshot of a supported version. Ignoring it.");
+        return entries;
+    }
+
+    const std::size_t number_of_fields = line == HEADER ? NUMBER_OF_FIELDS : NUMBER_OF_FIELDS_V1;
+
+    unsigned int line_number = 1;
+    while (std::getline(file, line))
+    {
+        ++line_number;
+
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, '\t'))
+        {
+            fields.push_back(field);
+        }
+
+        int durability, reliability, ownership, keyed, partitions, readers, writers;
+        HistoryDepthType history_depth;
+
+        if (fields.size() != number_of_fields ||
+                !parse_enumeration(fields[2], 3, durability) ||
+                !parse_enumeration(fields[3], 1, reliability) ||
+                !parse_enumeration(fields[4], 1, ownership) ||
+                !parse_enumeration(fields[5], 1, keyed) ||
+                !parse_enumeration(fields[6], 1, partitions) ||
+                !parse_enumeration(fields[7], 1, readers) ||
+                !parse_enumeration(fields[8], 1, writers) ||
+                (number_of_fields == NUMBER_OF_FIELDS && !parse_history_depth(fields[9], history_depth)))
+        {
+            logWarning(DDSPIPE_DISCOVERY_SNAPSHOT,
+                    "Skipping malformed line " << line_number << " of discovery snapshot " << file_path << ".");
+            continue;
+        }
+
+        Entry entry;
+        entry.topic.m_topic_name = unescape(fields[0]);
+        entry.topic.type_name = unescape(fields[1]);
+        entry.topic.topic_qos.durability_qos.set_value(static_cast<DurabilityKind>(durability));
+        entry.topic.topic_qos.reliability_qos.set_value(static_cast<ReliabilityKind>(reliability));
+        entry.topic.topic_qos.ownership_qos.set_value(static_cast<OwnershipQosPolicyKind>(ownership));
+        entry.topic.topic_qos.keyed.set_value(keyed == 1);
+        entry.topic.topic_qos.use_partitions.set_value(partitions == 1);
+        if (number_of_fields == NUMBER_OF_FIELDS)
+        {
+            entry.topic.topic_qos.history_depth.set_value(history_depth);
+        }
+        entry.has_readers = readers == 1;
+        entry.has_writers = writers == 1;
+
+        entries.push_back(std::move(entry));
+    }
+
+    logInfo(DDSPIPE_DISCOVERY_SNAPSHOT,
+            "Discovery snapshot with " << entries.size() << " topics read from " << file_path << ".");
+
+    return entries;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
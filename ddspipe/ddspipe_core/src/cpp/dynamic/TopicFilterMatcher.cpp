@@ -0,0 +1,339 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <typeinfo>
+#include <vector>
+
+#include <cpp_utils/types/cast.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <ddspipe_core/dynamic/TopicFilterMatcher.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+namespace {
+
+//! Characters that start a wildcard in a pattern
+constexpr const char* WILDCARD_CHARACTERS = "*?[";
+
+} /* namespace */
+
+GlobPattern::GlobPattern(
+        const std::string& pattern)
+{
+    std::size_t i = 0;
+
+    while (i < pattern.size())
+    {
+        Token token;
+        token.kind = Token::Kind::literal;
+        token.character = pattern[i];
+        token.negated = false;
+
+        if (pattern[i] == '*')
+        {
+            // Consecutive stars are equivalent to one
+            if (tokens_.empty() || tokens_.back().kind != Token::Kind::star)
+            {
+                token.kind = Token::Kind::star;
+                tokens_.push_back(std::move(token));
+            }
+            ++i;
+            continue;
+        }
+
+        if (pattern[i] == '?')
+        {
+            token.kind = Token::Kind::any;
+            tokens_.push_back(std::move(token));
+            ++i;
+            continue;
+        }
+
+        if (pattern[i] == '[')
+        {
+            std::size_t j = i + 1;
+
+            if (j < pattern.size() && (pattern[j] == '!' || pattern[j] == '^'))
+            {
+                token.negated = true;
+                ++j;
+            }
+
+            // A closing bracket right after the opening one is part of the set
+            const std::size_t set_begin = j;
+            while (j < pattern.size() && (pattern[j] != ']' || j == set_begin))
+            {
+                if (pattern[j] == '[' && j + 1 < pattern.size() &&
+                        (pattern[j + 1] == ':' || pattern[j + 1] == '=' || pattern[j + 1] == '.'))
+                {
+                    // POSIX classes ([:alpha:], [=a=], [.a.]) are not compiled, as if the set were not closed
+                    j = pattern.size();
+                    break;
+                }
+
+                const unsigned char first = static_cast<unsigned char>(pattern[j]);
+
+                if (j + 2 < pattern.size() && pattern[j + 1] == '-' && pattern[j + 2] != ']')
+                {
+                    token.ranges.emplace_back(first, static_cast<unsigned char>(pattern[j + 2]));
+                    j += 3;
+                }
+                else
+                {
+                    token.ranges.emplace_back(first, first);
+                    ++j;
+                }
+            }
+
+            if (j < pattern.size())
+            {
+                token.kind = Token::Kind::set;
+                tokens_.push_back(std::move(token));
+                i = j + 1;
+                continue;
+            }
+
+            // Without closing bracket (or with POSIX classes) the pattern is left to fnmatch, as its behaviour
+            // depends on the platform and locale
+            tokens_.clear();
+            unsupported_pattern_ = pattern;
+            return;
+        }
+
+        tokens_.push_back(std::move(token));
+        ++i;
+    }
+}
+
+bool GlobPattern::Token::accepts(
+        const char c) const noexcept
+{
+    switch (kind)
+    {
+        case Kind::literal:
+            return c == character;
+
+        case Kind::any:
+            return true;
+
+        case Kind::set:
+        {
+            const unsigned char uc = static_cast<unsigned char>(c);
+            bool in_set = false;
+
+            for (const auto& range : ranges)
+            {
+                if (range.first <= uc && uc <= range.second)
+                {
+                    in_set = true;
+                    break;
+                }
+            }
+
+            return in_set != negated;
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool GlobPattern::matches(
+        const std::string& str,
+        const std::size_t from /* = 0 */) const noexcept
+{
+    if (!unsupported_pattern_.empty())
+    {
+        return utils::match_pattern(unsupported_pattern_, str.substr(from));
+    }
+
+    const std::size_t final_state = tokens_.size();
+
+    // State i means that the first i tokens have been matched
+    std::vector<char> current(final_state + 1, 0);
+    std::vector<char> next(final_state + 1, 0);
+
+    // A star may match an empty sequence, so the state after it is reached at the same time
+    auto close = [this, final_state](std::vector<char>& states)
+            {
+                for (std::size_t state = 0; state < final_state; ++state)
+                {
+                    if (states[state] && tokens_[state].kind == Token::Kind::star)
+                    {
+                        states[state + 1] = 1;
+                    }
+                }
+            };
+
+    current[0] = 1;
+    close(current);
+
+    for (std::size_t i = from; i < str.size(); ++i)
+    {
+        std::fill(next.begin(), next.end(), 0);
+        bool alive = false;
+
+        for (std::size_t state = 0; state < final_state; ++state)
+        {
+            if (!current[state])
+            {
+                continue;
+            }
+
+            if (tokens_[state].kind == Token::Kind::star)
+            {
+                next[state] = 1;
+                alive = true;
+            }
+            else if (tokens_[state].accepts(str[i]))
+            {
+                next[state + 1] = 1;
+                alive = true;
+            }
+        }
+
+        if (!alive)
+        {
+            return false;
+        }
+
+        close(next);
+        current.swap(next);
+    }
+
+    return current[final_state] != 0;
+}
+
+TopicFilterMatcher::TopicFilterMatcher(
+        const std::set<utils::Heritable<types::IFilterTopic>>& filters)
+    : empty_(filters.empty())
+{
+    for (const auto& filter : filters)
+    {
+        if (typeid(*filter) != typeid(types::WildcardDdsFilterTopic))
+        {
+            other_filters_.push_back(filter);
+            continue;
+        }
+
+        const auto& wildcard_filter = static_cast<const types::WildcardDdsFilterTopic&>(*filter);
+
+        const std::string name_pattern =
+                wildcard_filter.topic_name.is_set() ? wildcard_filter.topic_name.get_reference() : "*";
+
+        const std::size_t prefix_size = std::min(name_pattern.find_first_of(WILDCARD_CHARACTERS), name_pattern.size());
+
+        // Store the filter in the node of its literal prefix
+        TrieNode* node = &root_;
+        for (std::size_t i = 0; i < prefix_size; ++i)
+        {
+            auto& child = node->children[name_pattern[i]];
+            if (!child)
+            {
+                child.reset(new TrieNode());
+            }
+            node = child.get();
+        }
+
+        CompiledFilter compiled_filter;
+        if (prefix_size < name_pattern.size())
+        {
+            compiled_filter.name_suffix = std::make_shared<GlobPattern>(name_pattern.substr(prefix_size));
+        }
+        if (wildcard_filter.type_name.is_set())
+        {
+            compiled_filter.type_name = std::make_shared<GlobPattern>(wildcard_filter.type_name.get_reference());
+        }
+
+        node->filters.push_back(std::move(compiled_filter));
+    }
+}
+
+bool TopicFilterMatcher::empty() const noexcept
+{
+    return empty_;
+}
+
+bool TopicFilterMatcher::matches(
+        const ITopic& topic) const noexcept
+{
+    // Wildcard filters only match DDS topics
+    if (utils::can_cast<types::DdsTopic>(topic))
+    {
+        const auto& dds_topic = static_cast<const types::DdsTopic&>(topic);
+
+        if (matches_wildcard_(dds_topic.topic_name(), dds_topic.type_name))
+        {
+            return true;
+        }
+    }
+
+    for (const auto& filter : other_filters_)
+    {
+        if (filter->matches(topic))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TopicFilterMatcher::matches_wildcard_(
+        const std::string& topic_name,
+        const std::string& type_name) const noexcept
+{
+    const TrieNode* node = &root_;
+    std::size_t position = 0;
+
+    while (true)
+    {
+        // Evaluate the filters whose literal prefix is the name until this position
+        for (const auto& filter : node->filters)
+        {
+            const bool name_matches = filter.name_suffix ?
+                    filter.name_suffix->matches(topic_name, position) :
+                    position == topic_name.size();
+
+            if (name_matches && (!filter.type_name || filter.type_name->matches(type_name)))
+            {
+                return true;
+            }
+        }
+
+        if (position == topic_name.size())
+        {
+            return false;
+        }
+
+        auto it_child = node->children.find(topic_name[position]);
+        if (it_child == node->children.end())
+        {
+            return false;
+        }
+
+        node = it_child->second.get();
+        ++position;
+    }
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
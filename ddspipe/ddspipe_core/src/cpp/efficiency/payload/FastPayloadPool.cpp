@@ -22,6 +22,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/tracing/tracepoints.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -126,7 +127,9 @@ bool FastPayloadPool::reserve_(
     payload.data = reinterpret_cast<eprosima::fastrtps::rtps::octet*>(reference_place + 1);
     payload.max_size = size;
 
-    add_reserved_payload_();
+    DDSPIPE_TRACEPOINT(payload_reserve, this, payload.data, size);
+
+    add_reserved_payload_(size);
 
     logDebug(DDSPIPE_PAYLOADPOOL_FAST, "Reserved payload ptr: " << static_cast<void*>(payload.data) << ".");
 
@@ -138,6 +141,10 @@ bool FastPayloadPool::release_(
 {
     logDebug(DDSPIPE_PAYLOADPOOL_FAST, "Releasing payload ptr: " << static_cast<void*>(payload.data) << ".");
 
+    const uint32_t size = payload.max_size;
+
+    DDSPIPE_TRACEPOINT(payload_release, this, payload.data, size);
+
     // Free memory from the initial allocation, 4 bytes before
     MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(payload.data);
     reference_place--;
@@ -149,7 +156,7 @@ bool FastPayloadPool::release_(
     payload.data = nullptr;
     payload.pos = 0;
 
-    add_release_payload_();
+    add_release_payload_(size);
 
     return true;
 }
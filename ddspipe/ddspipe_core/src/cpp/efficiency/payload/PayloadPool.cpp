@@ -21,6 +21,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/tracing/tracepoints.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -31,6 +32,8 @@ using namespace eprosima::ddspipe::core::types;
 PayloadPool::PayloadPool()
     : reserve_count_(0)
     , release_count_(0)
+    , reserved_bytes_(0)
+    , released_bytes_(0)
 {
 }
 
@@ -116,16 +119,38 @@ bool PayloadPool::is_clean() const noexcept
     return reserve_count_ == release_count_;
 }
 
+uint64_t PayloadPool::payloads_in_use() const noexcept
+{
+    // Read the releases first so the result never underflows
+    const uint64_t released = release_count_.load();
+    return reserve_count_.load() - released;
+}
+
+uint64_t PayloadPool::bytes_in_use() const noexcept
+{
+    const uint64_t released = released_bytes_.load();
+    return reserved_bytes_.load() - released;
+}
+
+uint64_t PayloadPool::payloads_reserved() const noexcept
+{
+    return reserve_count_.load();
+}
+
 /////
 // INTERNAL PART
 
-void PayloadPool::add_reserved_payload_()
+void PayloadPool::add_reserved_payload_(
+        uint32_t size /* = 0 */)
 {
+    reserved_bytes_ += size;
     ++reserve_count_;
 }
 
-void PayloadPool::add_release_payload_()
+void PayloadPool::add_release_payload_(
+        uint32_t size /* = 0 */)
 {
+    released_bytes_ += size;
     ++release_count_;
     if (release_count_ > reserve_count_)
     {
@@ -148,9 +173,11 @@ bool PayloadPool::reserve_(
 
     payload.reserve(size);
 
+    DDSPIPE_TRACEPOINT(payload_reserve, this, payload.data, size);
+
     logDebug(DDSPIPE_PAYLOADPOOL, "Reserved payload ptr: " << payload.data << ".");
 
-    add_reserved_payload_();
+    add_reserved_payload_(size);
 
     return true;
 }
@@ -160,6 +187,10 @@ bool PayloadPool::release_(
 {
     logDebug(DDSPIPE_PAYLOADPOOL, "Releasing payload ptr: " << payload.data << ".");
 
+    const uint32_t size = payload.max_size;
+
+    DDSPIPE_TRACEPOINT(payload_release, this, payload.data, size);
+
     payload.empty();
 
     if (payload.data != nullptr)
@@ -167,7 +198,7 @@ bool PayloadPool::release_(
         return false;
     }
 
-    add_release_payload_();
+    add_release_payload_(size);
 
     return true;
 }
@@ -0,0 +1,156 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <exception>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/tasks/SerialTaskPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+SerialTaskPool::SerialTaskPool(
+        const unsigned int number_of_threads)
+    : stop_(false)
+{
+    unsigned int threads = number_of_threads;
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    logDebug(DDSPIPE_SERIAL_TASK_POOL, "Creating SerialTaskPool with " << threads << " threads.");
+
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+        workers_.emplace_back(&SerialTaskPool::worker_routine_, this);
+    }
+}
+
+SerialTaskPool::~SerialTaskPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_cv_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+
+    logDebug(DDSPIPE_SERIAL_TASK_POOL, "SerialTaskPool destroyed.");
+}
+
+void SerialTaskPool::emit(
+        const std::string& key,
+        Task&& task) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = pending_tasks_.find(key);
+        if (it != pending_tasks_.end())
+        {
+            // The key is already scheduled, the task is executed after the previous ones
+            it->second.push_back(std::move(task));
+            return;
+        }
+
+        pending_tasks_[key].push_back(std::move(task));
+        ready_keys_.push_back(key);
+    }
+    ready_cv_.notify_one();
+}
+
+void SerialTaskPool::wait_all() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(
+        lock,
+        [&]
+        {
+            return pending_tasks_.empty();
+        });
+}
+
+unsigned int SerialTaskPool::number_of_threads() const noexcept
+{
+    return static_cast<unsigned int>(workers_.size());
+}
+
+void SerialTaskPool::worker_routine_() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        ready_cv_.wait(
+            lock,
+            [&]
+            {
+                return !ready_keys_.empty() || stop_;
+            });
+
+        if (ready_keys_.empty())
+        {
+            // Stopped and every task has been executed
+            break;
+        }
+
+        const std::string key = std::move(ready_keys_.front());
+        ready_keys_.pop_front();
+
+        auto& tasks = pending_tasks_[key];
+        Task task = std::move(tasks.front());
+        tasks.pop_front();
+
+        // Execute the task without the lock, so other keys progress meanwhile
+        lock.unlock();
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            logDevError(DDSPIPE_SERIAL_TASK_POOL, "Task of " << key << " failed: " << e.what() << ".");
+        }
+        lock.lock();
+
+        // References to map elements are not invalidated by other insertions or erasures
+        if (tasks.empty())
+        {
+            pending_tasks_.erase(key);
+
+            if (pending_tasks_.empty())
+            {
+                idle_cv_.notify_all();
+            }
+        }
+        else
+        {
+            // Let the other keys progress before the next task of this one
+            ready_keys_.push_back(key);
+            ready_cv_.notify_one();
+        }
+    }
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,177 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/metrics/EntityMetrics.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+EntityMetrics::EntityMetrics(
+        const std::string& name,
+        const std::string& type_name /* = "" */)
+    : name_(name)
+    , type_name_(type_name)
+{
+    for (auto& shard : shards_)
+    {
+        for (auto& counter : shard.counters)
+        {
+            counter.store(0, std::memory_order_relaxed);
+        }
+
+        for (auto& bucket : shard.latency_buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void EntityMetrics::add(
+        const MetricKind kind,
+        const std::uint64_t value /* = 1 */) noexcept
+{
+    shards_[shard_index_()].counters[static_cast<unsigned int>(kind)].fetch_add(value, std::memory_order_relaxed);
+}
+
+void EntityMetrics::record_latency(
+        const std::uint64_t latency_ns) noexcept
+{
+    Shard& shard = shards_[shard_index_()];
+    shard.latency_buckets[latency_bucket_(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+    shard.latency_sum_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+}
+
+EntityMetricsSnapshot EntityMetrics::snapshot() const noexcept
+{
+    EntityMetricsSnapshot snapshot;
+    snapshot.name = name_;
+    snapshot.type_name = type_name_;
+    snapshot.latency = empty_latency_histogram_();
+
+    for (const auto& shard : shards_)
+    {
+        for (unsigned int i = 0; i < METRIC_KINDS_COUNT; ++i)
+        {
+            snapshot.values[i] += shard.counters[i].load(std::memory_order_relaxed);
+        }
+
+        for (unsigned int i = 0; i <= LATENCY_BOUNDED_BUCKETS; ++i)
+        {
+            const std::uint64_t count = shard.latency_buckets[i].load(std::memory_order_relaxed);
+            snapshot.latency.counts[i] += count;
+            snapshot.latency.count += count;
+        }
+
+        snapshot.latency.sum_ns += shard.latency_sum_ns.load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+LatencyHistogramSnapshot EntityMetrics::latency_histogram(
+        const LatencyDistributionSnapshot& distribution) noexcept
+{
+    LatencyHistogramSnapshot histogram = empty_latency_histogram_();
+
+    for (const auto& bucket : distribution.buckets)
+    {
+        histogram.counts[latency_bucket_(bucket.first)] += bucket.second;
+    }
+
+    histogram.count = distribution.count;
+    histogram.sum_ns = distribution.sum_ns;
+
+    return histogram;
+}
+
+std::uint64_t EntityMetrics::data_size(
+        const IRoutingData& data) noexcept
+{
+    if (data.internal_type_discriminator() != types::INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return 0;
+    }
+
+    return static_cast<const types::RtpsPayloadData&>(data).payload.length;
+}
+
+bool EntityMetrics::data_latency(
+        const IRoutingData& data,
+        std::uint64_t& latency_ns) noexcept
+{
+    if (data.internal_type_discriminator() != types::INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return false;
+    }
+
+    const types::DataTime& reception_timestamp =
+            static_cast<const types::RtpsPayloadData&>(data).reception_timestamp;
+
+    if (reception_timestamp == types::DataTime())
+    {
+        return false;
+    }
+
+    types::DataTime now;
+    types::DataTime::now(now);
+
+    const std::int64_t latency = now.to_ns() - reception_timestamp.to_ns();
+    if (latency < 0)
+    {
+        return false;
+    }
+
+    latency_ns = static_cast<std::uint64_t>(latency);
+    return true;
+}
+
+unsigned int EntityMetrics::shard_index_() noexcept
+{
+    static std::atomic<unsigned int> next_index{0};
+    thread_local const unsigned int index = next_index.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+    return index;
+}
+
+unsigned int EntityMetrics::latency_bucket_(
+        const std::uint64_t latency_ns) noexcept
+{
+    // Bucket i holds the latencies in (2^(i-1), 2^i] us
+    std::uint64_t latency_us = (latency_ns + 999) / 1000;
+    unsigned int bucket = 0;
+    while (bucket < LATENCY_BOUNDED_BUCKETS && (std::uint64_t(1) << bucket) < latency_us)
+    {
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+LatencyHistogramSnapshot EntityMetrics::empty_latency_histogram_() noexcept
+{
+    LatencyHistogramSnapshot histogram;
+
+    for (unsigned int i = 0; i < LATENCY_BOUNDED_BUCKETS; ++i)
+    {
+        histogram.upper_bounds_us.push_back(std::uint64_t(1) << i);
+    }
+    histogram.counts.resize(LATENCY_BOUNDED_BUCKETS + 1, 0);
+
+    return histogram;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+namespace {
+
+//! Position of the most significant bit set in \c value (value must not be 0)
+unsigned int most_significant_bit(
+        std::uint64_t value) noexcept
+{
+    unsigned int bit = 0;
+    while (value >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+}
+
+} /* namespace */
+
+LatencyHistogram::LatencyHistogram()
+    : sum_ns_(0)
+    , max_ns_(0)
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(
+        const std::uint64_t latency_ns) noexcept
+{
+    buckets_[bucket_index(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+    sum_ns_.fetch_add(latency_ns, std::memory_order_relaxed);
+
+    // The maximum only changes a few times, so the loop barely ever iterates
+    std::uint64_t max = max_ns_.load(std::memory_order_relaxed);
+    while (latency_ns > max && !max_ns_.compare_exchange_weak(max, latency_ns, std::memory_order_relaxed))
+    {
+        // max has been updated with the current value, try again
+    }
+}
+
+LatencyDistributionSnapshot LatencyHistogram::snapshot() const noexcept
+{
+    LatencyDistributionSnapshot snapshot;
+
+    for (unsigned int i = 0; i < BUCKETS; ++i)
+    {
+        const std::uint64_t count = buckets_[i].load(std::memory_order_relaxed);
+        if (count > 0)
+        {
+            snapshot.buckets.emplace_back(bucket_upper_bound(i), count);
+            snapshot.count += count;
+        }
+    }
+
+    snapshot.sum_ns = sum_ns_.load(std::memory_order_relaxed);
+    snapshot.max_ns = max_ns_.load(std::memory_order_relaxed);
+
+    return snapshot;
+}
+
+unsigned int LatencyHistogram::bucket_index(
+        const std::uint64_t latency_ns) noexcept
+{
+    // Latencies under SUB_BUCKETS ns have a bucket each
+    if (latency_ns < SUB_BUCKETS)
+    {
+        return static_cast<unsigned int>(latency_ns);
+    }
+
+    // Drop the bits under the SUB_BUCKET_BITS + 1 most significant ones, that give the linear part of the index
+    const unsigned int shift = most_significant_bit(latency_ns) - SUB_BUCKET_BITS;
+    if (shift > MAX_EXPONENT - SUB_BUCKET_BITS)
+    {
+        return BUCKETS - 1;
+    }
+
+    return shift * SUB_BUCKETS + static_cast<unsigned int>(latency_ns >> shift);
+}
+
+std::uint64_t LatencyHistogram::bucket_upper_bound(
+        const unsigned int index) noexcept
+{
+    if (index < 2 * SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    const unsigned int shift = index / SUB_BUCKETS - 1;
+    const std::uint64_t sub_bucket = index - shift * SUB_BUCKETS;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
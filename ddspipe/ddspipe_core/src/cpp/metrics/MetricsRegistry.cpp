@@ -0,0 +1,170 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+constexpr const utils::Duration_ms MetricsRegistry::DEFAULT_UNUSED_TTL;
+
+std::shared_ptr<EntityMetrics> MetricsRegistry::topic_metrics(
+        const std::string& topic_name,
+        const std::string& type_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& entry = topics_[{topic_name, type_name}];
+    if (!entry.metrics)
+    {
+        entry.metrics = std::make_shared<EntityMetrics>(topic_name, type_name);
+    }
+
+    // Used again, so the time it was unused starts over on the next snapshot
+    entry.unused = false;
+
+    return entry.metrics;
+}
+
+std::shared_ptr<EntityMetrics> MetricsRegistry::topic_metrics(
+        const ITopic& topic)
+{
+    const types::DdsTopic* dds_topic = dynamic_cast<const types::DdsTopic*>(&topic);
+
+    return topic_metrics(topic.topic_name(), dds_topic ? dds_topic->type_name : "");
+}
+
+std::shared_ptr<TopicLatencyMetrics> MetricsRegistry::topic_latency_metrics(
+        const ITopic& topic)
+{
+    const types::DdsTopic* dds_topic = dynamic_cast<const types::DdsTopic*>(&topic);
+    const std::string type_name = dds_topic ? dds_topic->type_name : "";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& entry = topic_latencies_[{topic.topic_name(), type_name}];
+    if (!entry.metrics)
+    {
+        entry.metrics = std::make_shared<TopicLatencyMetrics>(topic.topic_name(), type_name);
+    }
+
+    // Used again, so the time it was unused starts over on the next snapshot
+    entry.unused = false;
+
+    return entry.metrics;
+}
+
+std::shared_ptr<EntityMetrics> MetricsRegistry::participant_metrics(
+        const types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& entry = participants_[participant_id];
+    if (!entry.metrics)
+    {
+        entry.metrics = std::make_shared<EntityMetrics>(participant_id);
+    }
+
+    // Used again, so the time it was unused starts over on the next snapshot
+    entry.unused = false;
+
+    return entry.metrics;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot()
+{
+    MetricsSnapshot snapshot;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    purge_unused_nts_();
+
+    for (const auto& it : topics_)
+    {
+        snapshot.topics.push_back(it.second.metrics->snapshot());
+
+        // The end to end latency of a topic is only measured by its latency metrics
+        auto latency_it = topic_latencies_.find(it.first);
+        if (latency_it != topic_latencies_.end())
+        {
+            snapshot.topics.back().latency =
+                    EntityMetrics::latency_histogram(latency_it->second.metrics->snapshot().end_to_end);
+        }
+    }
+
+    for (const auto& it : participants_)
+    {
+        snapshot.participants.push_back(it.second.metrics->snapshot());
+    }
+
+    for (const auto& it : topic_latencies_)
+    {
+        snapshot.latencies.push_back(it.second.metrics->snapshot());
+    }
+
+    return snapshot;
+}
+
+void MetricsRegistry::unused_ttl(
+        const utils::Duration_ms ttl) noexcept
+{
+    unused_ttl_.store(ttl);
+}
+
+template <typename Key, typename T>
+void MetricsRegistry::purge_unused_nts_(
+        std::map<Key, Entry<T>>& entries,
+        const std::chrono::steady_clock::time_point& now) noexcept
+{
+    const auto ttl = std::chrono::milliseconds(unused_ttl_.load());
+
+    for (auto it = entries.begin(); it != entries.end();)
+    {
+        Entry<T>& entry = it->second;
+
+        // Every entity gets its metrics from the registry with the mutex taken, so only the registry owning them
+        // means that no entity uses them (and none can start using them concurrently)
+        if (entry.metrics.use_count() > 1)
+        {
+            entry.unused = false;
+        }
+        else if (!entry.unused)
+        {
+            entry.unused = true;
+            entry.unused_since = now;
+        }
+        else if (now - entry.unused_since >= ttl)
+        {
+            it = entries.erase(it);
+            continue;
+        }
+
+        ++it;
+    }
+}
+
+void MetricsRegistry::purge_unused_nts_() noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    purge_unused_nts_(topics_, now);
+    purge_unused_nts_(topic_latencies_, now);
+    purge_unused_nts_(participants_, now);
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,79 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/metrics/MonitoredMutex.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+namespace {
+
+//! Nanoseconds between \c start and \c end
+std::uint64_t elapsed_ns(
+        const std::chrono::steady_clock::time_point& start,
+        const std::chrono::steady_clock::time_point& end) noexcept
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+} /* namespace */
+
+void MonitoredMutex::lock()
+{
+    if (mutex_.try_lock())
+    {
+        // Not contended, so nothing has been waited
+        locked_at_ = std::chrono::steady_clock::now();
+        wait_times_.record(0);
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    mutex_.lock();
+    locked_at_ = std::chrono::steady_clock::now();
+    wait_times_.record(elapsed_ns(start, locked_at_));
+}
+
+bool MonitoredMutex::try_lock()
+{
+    if (!mutex_.try_lock())
+    {
+        return false;
+    }
+
+    locked_at_ = std::chrono::steady_clock::now();
+    return true;
+}
+
+void MonitoredMutex::unlock()
+{
+    const std::uint64_t held = elapsed_ns(locked_at_, std::chrono::steady_clock::now());
+    mutex_.unlock();
+    hold_times_.record(held);
+}
+
+LatencyDistributionSnapshot MonitoredMutex::hold_times() const noexcept
+{
+    return hold_times_.snapshot();
+}
+
+LatencyDistributionSnapshot MonitoredMutex::wait_times() const noexcept
+{
+    return wait_times_.snapshot();
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,102 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/metrics/TopicLatencyMetrics.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+namespace {
+
+//! Record in \c histogram the time from \c start to \c end , if \c start is set and not after \c end
+void record_interval(
+        LatencyHistogram& histogram,
+        const types::DataTime& start,
+        const types::DataTime& end) noexcept
+{
+    if (start == types::DataTime())
+    {
+        return;
+    }
+
+    const std::int64_t interval = end.to_ns() - start.to_ns();
+    if (interval >= 0)
+    {
+        histogram.record(static_cast<std::uint64_t>(interval));
+    }
+}
+
+} /* namespace */
+
+TopicLatencyMetrics::TopicLatencyMetrics(
+        const std::string& name,
+        const std::string& type_name)
+    : name_(name)
+    , type_name_(type_name)
+{
+    // Do nothing
+}
+
+void TopicLatencyMetrics::record_take(
+        IRoutingData& data) noexcept
+{
+    if (data.internal_type_discriminator() != types::INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return;
+    }
+
+    types::RtpsPayloadData& rtps_data = static_cast<types::RtpsPayloadData&>(data);
+    types::DataTime::now(rtps_data.take_timestamp);
+
+    record_interval(queue_wait_, rtps_data.reception_timestamp, rtps_data.take_timestamp);
+}
+
+void TopicLatencyMetrics::record_write(
+        const IRoutingData& data) noexcept
+{
+    if (data.internal_type_discriminator() != types::INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        return;
+    }
+
+    const types::RtpsPayloadData& rtps_data = static_cast<const types::RtpsPayloadData&>(data);
+    if (rtps_data.take_timestamp == types::DataTime())
+    {
+        return;
+    }
+
+    types::DataTime now;
+    types::DataTime::now(now);
+
+    record_interval(forwarding_, rtps_data.take_timestamp, now);
+    record_interval(end_to_end_, rtps_data.reception_timestamp, now);
+}
+
+TopicLatencySnapshot TopicLatencyMetrics::snapshot() const noexcept
+{
+    TopicLatencySnapshot snapshot;
+    snapshot.name = name_;
+    snapshot.type_name = type_name_;
+    snapshot.queue_wait = queue_wait_.snapshot();
+    snapshot.forwarding = forwarding_.snapshot();
+    snapshot.end_to_end = end_to_end_.snapshot();
+
+    return snapshot;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
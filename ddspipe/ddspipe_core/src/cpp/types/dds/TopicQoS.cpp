@@ -25,12 +25,33 @@ namespace ddspipe {
 namespace core {
 namespace types {
 
+// The mutex must be initialized before the default Topic QoS, whose construction locks it
+std::mutex TopicQoS::default_topic_qos_mutex;
 utils::Fuzzy<TopicQoS> TopicQoS::default_topic_qos{};
 
+namespace {
+
+//! Set \c value with \c fuzzy_level if \c imposed is set
+template <typename T>
+void impose_value(
+        utils::Fuzzy<T>& value,
+        const utils::Fuzzy<T>& imposed,
+        const utils::FuzzyLevelValues& fuzzy_level)
+{
+    if (imposed.is_set())
+    {
+        value.set_value(imposed.get_value(), fuzzy_level);
+    }
+}
+
+} /* namespace */
+
 TopicQoS::TopicQoS()
 {
     set_default_qos();
 
+    std::lock_guard<std::mutex> lock(default_topic_qos_mutex);
+
     // This check must be done. If not, the constructor of the default Topic QoS would enter into a loop.
     if (default_topic_qos.is_set())
     {
@@ -39,6 +60,19 @@ TopicQoS::TopicQoS()
     }
 }
 
+void TopicQoS::set_default_topic_qos(
+        const TopicQoS& qos) noexcept
+{
+    std::lock_guard<std::mutex> lock(default_topic_qos_mutex);
+    default_topic_qos.set_value(qos);
+}
+
+void TopicQoS::unset_default_topic_qos() noexcept
+{
+    std::lock_guard<std::mutex> lock(default_topic_qos_mutex);
+    default_topic_qos.unset();
+}
+
 bool TopicQoS::operator ==(
         const TopicQoS& other) const noexcept
 {
@@ -52,7 +86,11 @@ bool TopicQoS::operator ==(
         this->max_tx_rate == other.max_tx_rate &&
         this->max_rx_rate == other.max_rx_rate &&
         this->downsampling == other.downsampling &&
-        this->transport_priority == other.transport_priority;
+        this->transport_priority == other.transport_priority &&
+        this->conflate == other.conflate &&
+        this->max_age == other.max_age &&
+        this->deduplication == other.deduplication &&
+        this->content_filter == other.content_filter;
 }
 
 bool TopicQoS::is_reliable() const noexcept
@@ -128,6 +166,46 @@ void TopicQoS::set_qos(
     {
         transport_priority.set_value(qos.transport_priority.get_value(), fuzzy_level);
     }
+
+    if (conflate.get_level() < fuzzy_level && qos.conflate.is_set())
+    {
+        conflate.set_value(qos.conflate.get_value(), fuzzy_level);
+    }
+
+    if (max_age.get_level() < fuzzy_level && qos.max_age.is_set())
+    {
+        max_age.set_value(qos.max_age.get_value(), fuzzy_level);
+    }
+
+    if (deduplication.get_level() < fuzzy_level && qos.deduplication.is_set())
+    {
+        deduplication.set_value(qos.deduplication.get_value(), fuzzy_level);
+    }
+
+    if (content_filter.get_level() < fuzzy_level && qos.content_filter.is_set())
+    {
+        content_filter.set_value(qos.content_filter.get_value(), fuzzy_level);
+    }
+}
+
+void TopicQoS::impose_qos(
+        const TopicQoS& qos,
+        const utils::FuzzyLevelValues& fuzzy_level /*= utils::FuzzyLevelValues::fuzzy_level_set*/) noexcept
+{
+    impose_value(durability_qos, qos.durability_qos, fuzzy_level);
+    impose_value(reliability_qos, qos.reliability_qos, fuzzy_level);
+    impose_value(ownership_qos, qos.ownership_qos, fuzzy_level);
+    impose_value(use_partitions, qos.use_partitions, fuzzy_level);
+    impose_value(history_depth, qos.history_depth, fuzzy_level);
+    impose_value(keyed, qos.keyed, fuzzy_level);
+    impose_value(max_tx_rate, qos.max_tx_rate, fuzzy_level);
+    impose_value(max_rx_rate, qos.max_rx_rate, fuzzy_level);
+    impose_value(downsampling, qos.downsampling, fuzzy_level);
+    impose_value(transport_priority, qos.transport_priority, fuzzy_level);
+    impose_value(conflate, qos.conflate, fuzzy_level);
+    impose_value(max_age, qos.max_age, fuzzy_level);
+    impose_value(deduplication, qos.deduplication, fuzzy_level);
+    impose_value(content_filter, qos.content_filter, fuzzy_level);
 }
 
 void TopicQoS::set_default_qos(
@@ -140,7 +218,11 @@ void TopicQoS::set_default_qos(
         float max_tx_rate /*= DEFAULT_MAX_TX_RATE */,
         float max_rx_rate /*= DEFAULT_MAX_RX_RATE */,
         unsigned int downsampling /*= DEFAULT_DOWNSAMPLING */,
-        TransportPrioritykind transport_priority /*= DEFAULT_TRANSPORT_PRIORITY*/) noexcept
+        TransportPrioritykind transport_priority /*= DEFAULT_TRANSPORT_PRIORITY*/,
+        bool conflate /*= DEFAULT_CONFLATE */,
+        float max_age /*= DEFAULT_MAX_AGE */,
+        DeduplicationKind deduplication /*= DEFAULT_DEDUPLICATION */,
+        const std::string& content_filter /*= DEFAULT_CONTENT_FILTER */) noexcept
 {
     // The default values must be received as arguments. Otherwise, Ubuntu 20.04 Debug does not compile.
     this->durability_qos.set_value(durability_qos, utils::FuzzyLevelValues::fuzzy_level_default);
@@ -153,6 +235,10 @@ void TopicQoS::set_default_qos(
     this->max_rx_rate.set_value(max_rx_rate, utils::FuzzyLevelValues::fuzzy_level_default);
     this->downsampling.set_value(downsampling, utils::FuzzyLevelValues::fuzzy_level_default);
     this->transport_priority.set_value(transport_priority, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->conflate.set_value(conflate, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->max_age.set_value(max_age, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->deduplication.set_value(deduplication, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->content_filter.set_value(content_filter, utils::FuzzyLevelValues::fuzzy_level_default);
 }
 
 std::ostream& operator <<(
@@ -269,6 +355,10 @@ std::ostream& operator <<(
         ";max_rx_rate(" << qos.max_rx_rate << ")" <<
         ";downsampling(" << qos.downsampling << ")" <<
         ";transport_priority(" <<qos.transport_priority << ")" <<
+        (qos.conflate ? ";conflate" : "") <<
+        ";max_age(" << qos.max_age << ")" <<
+        ";deduplication(" << qos.deduplication << ")" <<
+        (qos.content_filter->empty() ? "" : ";content_filter(" + qos.content_filter.get_reference() + ")") <<
         "}";
 
     return os;
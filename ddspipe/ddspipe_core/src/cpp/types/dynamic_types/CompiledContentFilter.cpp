@@ -0,0 +1,777 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/TypeDescriptor.h>
+
+#include <cpp_utils/exception/UnsupportedException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/types/dynamic_types/CompiledContentFilter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+namespace {
+
+using Node = ContentFilterExpression::Node;
+using Literal = ContentFilterExpression::Literal;
+using Operator = ContentFilterExpression::Operator;
+
+//! Maximum nesting of types compiled (protection against malformed type objects)
+constexpr const unsigned int MAX_TYPE_DEPTH = 64;
+
+//! Size of the encapsulation header at the beginning of every serialized payload
+constexpr const std::uint32_t ENCAPSULATION_SIZE = 4;
+
+//! Encapsulation identifiers of plain CDR (XCDR1)
+constexpr const std::uint8_t CDR_BE = 0x00;
+constexpr const std::uint8_t CDR_LE = 0x01;
+
+//! Result of a three way comparison
+int compare_numbers(
+        const double a,
+        const double b) noexcept
+{
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+bool apply_operator(
+        const Operator op,
+        const int comparison) noexcept
+{
+    switch (op)
+    {
+        case Operator::equal:
+            return comparison == 0;
+        case Operator::not_equal:
+            return comparison != 0;
+        case Operator::less:
+            return comparison < 0;
+        case Operator::less_equal:
+            return comparison <= 0;
+        case Operator::greater:
+            return comparison > 0;
+        case Operator::greater_equal:
+            return comparison >= 0;
+    }
+
+    return false;
+}
+
+bool read_unsigned(
+        const std::uint8_t* data,
+        const std::uint32_t data_size,
+        const bool little_endian,
+        const std::uint32_t position,
+        const std::uint32_t size,
+        std::uint64_t& value) noexcept
+{
+    if (position > data_size || data_size - position < size)
+    {
+        return false;
+    }
+
+    value = 0;
+    for (std::uint32_t i = 0; i < size; ++i)
+    {
+        const std::uint32_t byte = little_endian ? i : size - 1 - i;
+        value |= static_cast<std::uint64_t>(data[position + byte]) << (i * 8);
+    }
+
+    return true;
+}
+
+//! Align \c position to \c alignment
+std::uint32_t align(
+        const std::uint32_t position,
+        const std::uint32_t alignment) noexcept
+{
+    return (position + alignment - 1) / alignment * alignment;
+}
+
+std::string field_to_string(
+        const std::vector<std::string>& field)
+{
+    std::string result;
+    for (const auto& name : field)
+    {
+        result += (result.empty() ? "" : ".") + name;
+    }
+    return result;
+}
+
+} /* namespace */
+
+/////////////////////////
+// CDR LAYOUT
+/////////////////////////
+
+std::uint32_t CompiledContentFilter::alignment_(
+        const CdrType& type) noexcept
+{
+    switch (type.kind)
+    {
+        case CdrType::Kind::string:
+        case CdrType::Kind::sequence:
+            return 4;
+        default:
+            return type.size > 8 ? 8 : (type.size == 0 ? 1 : type.size);
+    }
+}
+
+bool CompiledContentFilter::is_primitive_(
+        const CdrType& type) noexcept
+{
+    return type.kind == CdrType::Kind::boolean ||
+           type.kind == CdrType::Kind::character ||
+           type.kind == CdrType::Kind::signed_integer ||
+           type.kind == CdrType::Kind::unsigned_integer ||
+           type.kind == CdrType::Kind::floating;
+}
+
+bool CompiledContentFilter::is_skippable_(
+        const CdrType& type) noexcept
+{
+    switch (type.kind)
+    {
+        case CdrType::Kind::unsupported:
+            return false;
+
+        case CdrType::Kind::structure:
+            for (const auto& member : type.members)
+            {
+                if (!is_skippable_(*member.second))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        case CdrType::Kind::array:
+        case CdrType::Kind::sequence:
+            return is_skippable_(*type.element);
+
+        default:
+            return true;
+    }
+}
+
+bool CompiledContentFilter::skip_fixed_(
+        const CdrType& type,
+        std::uint32_t& position) noexcept
+{
+    if (is_primitive_(type))
+    {
+        position = align(position, alignment_(type)) + type.size;
+        return true;
+    }
+
+    switch (type.kind)
+    {
+        case CdrType::Kind::structure:
+            for (const auto& member : type.members)
+            {
+                if (!skip_fixed_(*member.second, position))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        case CdrType::Kind::array:
+            for (std::uint32_t i = 0; i < type.length; ++i)
+            {
+                if (!skip_fixed_(*type.element, position))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/////////////////////////
+// COMPILATION
+/////////////////////////
+
+CompiledContentFilter::CompiledContentFilter(
+        const ContentFilterExpression& expression,
+        const fastrtps::types::DynamicType_ptr& dynamic_type)
+    : root_type_(build_type_(dynamic_type, 0))
+{
+    if (root_type_->kind != CdrType::Kind::structure)
+    {
+        throw utils::UnsupportedException(
+                  utils::Formatter() << "Content filter can only be applied to structures, not to " <<
+                      root_type_->name << ".");
+    }
+
+    compile_node_(*expression.root());
+}
+
+std::shared_ptr<const CompiledContentFilter::CdrType> CompiledContentFilter::build_type_(
+        const fastrtps::types::DynamicType_ptr& dynamic_type,
+        const unsigned int depth)
+{
+    auto type = std::make_shared<CdrType>();
+
+    if (!dynamic_type || depth > MAX_TYPE_DEPTH)
+    {
+        return type;
+    }
+
+    type->name = dynamic_type->get_name();
+
+    switch (dynamic_type->get_kind())
+    {
+        case fastrtps::types::TK_ALIAS:
+            return build_type_(dynamic_type->get_descriptor()->get_base_type(), depth + 1);
+
+        case fastrtps::types::TK_BOOLEAN:
+            type->kind = CdrType::Kind::boolean;
+            type->size = 1;
+            break;
+
+        case fastrtps::types::TK_CHAR8:
+            type->kind = CdrType::Kind::character;
+            type->size = 1;
+            break;
+
+        case fastrtps::types::TK_BYTE:
+            type->kind = CdrType::Kind::unsigned_integer;
+            type->size = 1;
+            break;
+
+        case fastrtps::types::TK_INT16:
+            type->kind = CdrType::Kind::signed_integer;
+            type->size = 2;
+            break;
+
+        case fastrtps::types::TK_INT32:
+            type->kind = CdrType::Kind::signed_integer;
+            type->size = 4;
+            break;
+
+        case fastrtps::types::TK_INT64:
+            type->kind = CdrType::Kind::signed_integer;
+            type->size = 8;
+            break;
+
+        case fastrtps::types::TK_UINT16:
+            type->kind = CdrType::Kind::unsigned_integer;
+            type->size = 2;
+            break;
+
+        case fastrtps::types::TK_UINT32:
+        case fastrtps::types::TK_ENUM:
+            // Enumerations are serialized as 32 bits unsigned integers
+            type->kind = CdrType::Kind::unsigned_integer;
+            type->size = 4;
+            break;
+
+        case fastrtps::types::TK_UINT64:
+            type->kind = CdrType::Kind::unsigned_integer;
+            type->size = 8;
+            break;
+
+        case fastrtps::types::TK_FLOAT32:
+            type->kind = CdrType::Kind::floating;
+            type->size = 4;
+            break;
+
+        case fastrtps::types::TK_FLOAT64:
+            type->kind = CdrType::Kind::floating;
+            type->size = 8;
+            break;
+
+        case fastrtps::types::TK_FLOAT128:
+            type->kind = CdrType::Kind::floating;
+            type->size = 16;
+            break;
+
+        case fastrtps::types::TK_STRING8:
+            type->kind = CdrType::Kind::string;
+            break;
+
+        case fastrtps::types::TK_STRUCTURE:
+        {
+            if (dynamic_type->get_descriptor()->get_base_type())
+            {
+                // Inherited members are not supported
+                break;
+            }
+
+            type->kind = CdrType::Kind::structure;
+
+            // Members are serialized in the order of their ids
+            std::map<fastrtps::types::MemberId, fastrtps::types::DynamicTypeMember*> members;
+            dynamic_type->get_all_members(members);
+
+            for (const auto& member : members)
+            {
+                type->members.emplace_back(
+                    member.second->get_name(),
+                    build_type_(member.second->get_descriptor()->get_type(), depth + 1));
+            }
+            break;
+        }
+
+        case fastrtps::types::TK_ARRAY:
+            type->kind = CdrType::Kind::array;
+            type->element = build_type_(dynamic_type->get_descriptor()->get_element_type(), depth + 1);
+            type->length = dynamic_type->get_descriptor()->get_total_bounds();
+            break;
+
+        case fastrtps::types::TK_SEQUENCE:
+            type->kind = CdrType::Kind::sequence;
+            type->element = build_type_(dynamic_type->get_descriptor()->get_element_type(), depth + 1);
+            break;
+
+        default:
+            // Unions, maps, bitsets, bitmasks and wide characters and strings
+            break;
+    }
+
+    return type;
+}
+
+std::size_t CompiledContentFilter::compile_node_(
+        const ContentFilterExpression::Node& node)
+{
+    CompiledNode compiled;
+    compiled.kind = node.kind;
+
+    switch (node.kind)
+    {
+        case Node::Kind::logical_and:
+        case Node::Kind::logical_or:
+            compiled.left = compile_node_(*node.left);
+            compiled.right = compile_node_(*node.right);
+            break;
+
+        case Node::Kind::logical_not:
+            compiled.left = compile_node_(*node.left);
+            break;
+
+        case Node::Kind::comparison:
+        {
+            FieldAccessor accessor = compile_field_(node.field);
+            const CdrType& type = *accessor.type;
+
+            bool compatible = false;
+            switch (type.kind)
+            {
+                case CdrType::Kind::boolean:
+                    compatible = node.literal.kind == Literal::Kind::boolean &&
+                            (node.op == Operator::equal || node.op == Operator::not_equal);
+                    break;
+
+                case CdrType::Kind::character:
+                case CdrType::Kind::string:
+                    compatible = node.literal.kind == Literal::Kind::string;
+                    break;
+
+                case CdrType::Kind::floating:
+                    // Long doubles are not comparable
+                    compatible = type.size <= 8 &&
+                            (node.literal.kind == Literal::Kind::integer ||
+                            node.literal.kind == Literal::Kind::floating);
+                    break;
+
+                case CdrType::Kind::signed_integer:
+                case CdrType::Kind::unsigned_integer:
+                    compatible = node.literal.kind == Literal::Kind::integer ||
+                            node.literal.kind == Literal::Kind::floating;
+                    break;
+
+                default:
+                    break;
+            }
+
+            if (!compatible)
+            {
+                throw utils::UnsupportedException(
+                          utils::Formatter() << "Field " << field_to_string(node.field) << " of type " <<
+                              type.name << " cannot be compared with the literal given.");
+            }
+
+            compiled.accessor = accessors_.size();
+            compiled.op = node.op;
+            compiled.literal = node.literal;
+            accessors_.push_back(std::move(accessor));
+            break;
+        }
+    }
+
+    nodes_.push_back(compiled);
+    return nodes_.size() - 1;
+}
+
+CompiledContentFilter::FieldAccessor CompiledContentFilter::compile_field_(
+        const std::vector<std::string>& field) const
+{
+    FieldAccessor accessor;
+    std::shared_ptr<const CdrType> current = root_type_;
+
+    for (const auto& name : field)
+    {
+        if (current->kind != CdrType::Kind::structure)
+        {
+            throw utils::UnsupportedException(
+                      utils::Formatter() << "Field " << field_to_string(field) << " does not exist: " <<
+                          current->name << " is not a structure.");
+        }
+
+        std::size_t index = 0;
+        while (index < current->members.size() && current->members[index].first != name)
+        {
+            ++index;
+        }
+
+        if (index == current->members.size())
+        {
+            throw utils::UnsupportedException(
+                      utils::Formatter() << "Field " << field_to_string(field) << " does not exist: " <<
+                          current->name << " has no member " << name << ".");
+        }
+
+        // Every member before the field must be skipped to reach it
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            if (!is_skippable_(*current->members[i].second))
+            {
+                throw utils::UnsupportedException(
+                          utils::Formatter() << "Field " << field_to_string(field) << " follows member " <<
+                              current->members[i].first << " whose type is not supported.");
+            }
+        }
+
+        accessor.steps.emplace_back(current.get(), index);
+        current = current->members[index].second;
+    }
+    accessor.type = current;
+
+    // Calculate the offset of the field if every member before it has a fixed size
+    std::uint32_t position = 0;
+    accessor.fixed_offset = true;
+    for (const auto& step : accessor.steps)
+    {
+        for (std::size_t i = 0; i < step.second && accessor.fixed_offset; ++i)
+        {
+            accessor.fixed_offset = skip_fixed_(*step.first->members[i].second, position);
+        }
+    }
+    accessor.offset = align(position, alignment_(*accessor.type));
+
+    return accessor;
+}
+
+/////////////////////////
+// EVALUATION
+/////////////////////////
+
+bool CompiledContentFilter::skip_(
+        const CdrType& type,
+        const CdrBuffer& buffer,
+        std::uint32_t& position) noexcept
+{
+    const std::uint32_t size = buffer.size;
+
+    if (is_primitive_(type))
+    {
+        position = align(position, alignment_(type));
+        if (position > size || size - position < type.size)
+        {
+            return false;
+        }
+        position += type.size;
+        return true;
+    }
+
+    switch (type.kind)
+    {
+        case CdrType::Kind::string:
+        {
+            std::uint64_t length = 0;
+            position = align(position, 4);
+            if (!read_unsigned(buffer.data, size, buffer.little_endian, position, 4, length) || size - position - 4 < length)
+            {
+                return false;
+            }
+            position += 4 + static_cast<std::uint32_t>(length);
+            return true;
+        }
+
+        case CdrType::Kind::structure:
+            for (const auto& member : type.members)
+            {
+                if (!skip_(*member.second, buffer, position))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        case CdrType::Kind::array:
+        case CdrType::Kind::sequence:
+        {
+            std::uint64_t length = type.length;
+            if (type.kind == CdrType::Kind::sequence)
+            {
+                position = align(position, 4);
+                if (!read_unsigned(buffer.data, size, buffer.little_endian, position, 4, length))
+                {
+                    return false;
+                }
+                position += 4;
+            }
+
+            if (is_primitive_(*type.element))
+            {
+                // Consecutive primitives are already aligned
+                position = align(position, alignment_(*type.element));
+                const std::uint64_t bytes = length * type.element->size;
+                if (position > size || size - position < bytes)
+                {
+                    return false;
+                }
+                position += static_cast<std::uint32_t>(bytes);
+                return true;
+            }
+
+            for (std::uint64_t i = 0; i < length; ++i)
+            {
+                // Every element takes at least one byte, so a malformed length is detected before looping too long
+                const std::uint32_t previous = position;
+                if (!skip_(*type.element, buffer, position) ||
+                        (position == previous && i > size))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool CompiledContentFilter::evaluate(
+        const Payload& payload,
+        bool& error) const noexcept
+{
+    error = false;
+
+    if (payload.length < ENCAPSULATION_SIZE ||
+            payload.data[0] != 0 ||
+            (payload.data[1] != CDR_BE && payload.data[1] != CDR_LE))
+    {
+        // Only plain CDR can be evaluated (no parameter lists or XCDR2)
+        error = true;
+        return false;
+    }
+
+    CdrBuffer buffer;
+    buffer.data = payload.data + ENCAPSULATION_SIZE;
+    buffer.size = payload.length - ENCAPSULATION_SIZE;
+    buffer.little_endian = payload.data[1] == CDR_LE;
+
+    return evaluate_node_(nodes_.size() - 1, buffer, error);
+}
+
+bool CompiledContentFilter::evaluate_node_(
+        const std::size_t index,
+        const CdrBuffer& buffer,
+        bool& error) const noexcept
+{
+    const CompiledNode& node = nodes_[index];
+
+    switch (node.kind)
+    {
+        case Node::Kind::logical_and:
+            return evaluate_node_(node.left, buffer, error) && !error && evaluate_node_(node.right, buffer, error);
+
+        case Node::Kind::logical_or:
+            return (evaluate_node_(node.left, buffer, error) || error) ?
+                   !error : evaluate_node_(node.right, buffer, error);
+
+        case Node::Kind::logical_not:
+            return !evaluate_node_(node.left, buffer, error);
+
+        case Node::Kind::comparison:
+            return evaluate_comparison_(node, buffer, error);
+    }
+
+    return false;
+}
+
+bool CompiledContentFilter::evaluate_comparison_(
+        const CompiledNode& node,
+        const CdrBuffer& buffer,
+        bool& error) const noexcept
+{
+    const FieldAccessor& accessor = accessors_[node.accessor];
+    const CdrType& type = *accessor.type;
+    const Literal& literal = node.literal;
+
+    // Locate the field
+    std::uint32_t position = accessor.offset;
+    if (!accessor.fixed_offset)
+    {
+        position = 0;
+        for (const auto& step : accessor.steps)
+        {
+            for (std::size_t i = 0; i < step.second; ++i)
+            {
+                if (!skip_(*step.first->members[i].second, buffer, position))
+                {
+                    error = true;
+                    return false;
+                }
+            }
+        }
+        position = align(position, alignment_(type));
+    }
+
+    // Read and compare the field
+    int comparison = 0;
+
+    if (type.kind == CdrType::Kind::string || type.kind == CdrType::Kind::character)
+    {
+        std::uint64_t length = 1;
+        if (type.kind == CdrType::Kind::string)
+        {
+            if (!read_unsigned(buffer.data, buffer.size, buffer.little_endian, position, 4, length))
+            {
+                error = true;
+                return false;
+            }
+            position += 4;
+
+            // Serialized length includes the null terminator
+            length = length > 0 ? length - 1 : 0;
+        }
+
+        if (position > buffer.size || buffer.size - position < length)
+        {
+            error = true;
+            return false;
+        }
+
+        const std::size_t common = std::min<std::size_t>(length, literal.string.size());
+        comparison = std::memcmp(buffer.data + position, literal.string.data(), common);
+        if (comparison == 0)
+        {
+            comparison = compare_numbers(static_cast<double>(length), static_cast<double>(literal.string.size()));
+        }
+
+        return apply_operator(node.op, comparison);
+    }
+
+    std::uint64_t raw = 0;
+    if (!read_unsigned(buffer.data, buffer.size, buffer.little_endian, position, type.size, raw))
+    {
+        error = true;
+        return false;
+    }
+
+    switch (type.kind)
+    {
+        case CdrType::Kind::boolean:
+            comparison = ((raw != 0) == literal.boolean) ? 0 : 1;
+            break;
+
+        case CdrType::Kind::signed_integer:
+        {
+            // Sign extension
+            std::int64_t value = static_cast<std::int64_t>(raw);
+            if (type.size < 8 && (raw >> (type.size * 8 - 1)) & 1)
+            {
+                value = static_cast<std::int64_t>(raw | (~std::uint64_t(0) << (type.size * 8)));
+            }
+
+            comparison = literal.kind == Literal::Kind::integer ?
+                    (value < literal.integer ? -1 : (value > literal.integer ? 1 : 0)) :
+                    compare_numbers(static_cast<double>(value), literal.floating);
+            break;
+        }
+
+        case CdrType::Kind::unsigned_integer:
+            if (literal.kind == Literal::Kind::floating)
+            {
+                comparison = compare_numbers(static_cast<double>(raw), literal.floating);
+            }
+            else if (literal.integer < 0)
+            {
+                comparison = 1;
+            }
+            else
+            {
+                const std::uint64_t value = static_cast<std::uint64_t>(literal.integer);
+                comparison = raw < value ? -1 : (raw > value ? 1 : 0);
+            }
+            break;
+
+        case CdrType::Kind::floating:
+        {
+            double value = 0;
+            if (type.size == 4)
+            {
+                std::uint32_t bits = static_cast<std::uint32_t>(raw);
+                float value_32 = 0;
+                std::memcpy(&value_32, &bits, sizeof(value_32));
+                value = value_32;
+            }
+            else
+            {
+                std::memcpy(&value, &raw, sizeof(value));
+            }
+
+            if (std::isnan(value))
+            {
+                // NaN is only different from anything
+                return node.op == Operator::not_equal;
+            }
+
+            comparison = compare_numbers(
+                value,
+                literal.kind == Literal::Kind::integer ? static_cast<double>(literal.integer) : literal.floating);
+            break;
+        }
+
+        default:
+            error = true;
+            return false;
+    }
+
+    return apply_operator(node.op, comparison);
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
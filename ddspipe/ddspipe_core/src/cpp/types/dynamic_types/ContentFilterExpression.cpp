@@ -0,0 +1,403 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/types/dynamic_types/ContentFilterExpression.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+namespace {
+
+using Node = ContentFilterExpression::Node;
+using Literal = ContentFilterExpression::Literal;
+using Operator = ContentFilterExpression::Operator;
+
+/**
+ * Recursive descent parser of a content filter expression.
+ *
+ * expression := and ( '||' and )*
+ * and        := unary ( '&&' unary )*
+ * unary      := '!' unary | '(' expression ')' | comparison
+ * comparison := field [ operator literal ] | literal operator field
+ */
+class Parser
+{
+public:
+
+    Parser(
+            const std::string& expression)
+        : expression_(expression)
+        , position_(0)
+    {
+    }
+
+    std::shared_ptr<const Node> parse()
+    {
+        auto root = parse_or_();
+
+        skip_spaces_();
+        if (position_ != expression_.size())
+        {
+            fail_("unexpected character");
+        }
+
+        return root;
+    }
+
+protected:
+
+    std::shared_ptr<const Node> parse_or_()
+    {
+        auto left = parse_and_();
+
+        while (consume_("||"))
+        {
+            auto node = std::make_shared<Node>();
+            node->kind = Node::Kind::logical_or;
+            node->left = left;
+            node->right = parse_and_();
+            left = node;
+        }
+
+        return left;
+    }
+
+    std::shared_ptr<const Node> parse_and_()
+    {
+        auto left = parse_unary_();
+
+        while (consume_("&&"))
+        {
+            auto node = std::make_shared<Node>();
+            node->kind = Node::Kind::logical_and;
+            node->left = left;
+            node->right = parse_unary_();
+            left = node;
+        }
+
+        return left;
+    }
+
+    std::shared_ptr<const Node> parse_unary_()
+    {
+        skip_spaces_();
+
+        // Do not mistake != for a negation
+        if (peek_("!") && !peek_("!="))
+        {
+            consume_("!");
+            auto node = std::make_shared<Node>();
+            node->kind = Node::Kind::logical_not;
+            node->left = parse_unary_();
+            return node;
+        }
+
+        if (consume_("("))
+        {
+            auto node = parse_or_();
+            if (!consume_(")"))
+            {
+                fail_("expected )");
+            }
+            return node;
+        }
+
+        return parse_comparison_();
+    }
+
+    std::shared_ptr<const Node> parse_comparison_()
+    {
+        auto node = std::make_shared<Node>();
+        node->kind = Node::Kind::comparison;
+
+        skip_spaces_();
+        if (is_identifier_start_() && !peek_keyword_("true") && !peek_keyword_("false"))
+        {
+            node->field = parse_field_();
+
+            if (!parse_operator_(node->op))
+            {
+                // A field alone must be true
+                node->op = Operator::equal;
+                node->literal.kind = Literal::Kind::boolean;
+                node->literal.boolean = true;
+                return node;
+            }
+
+            node->literal = parse_literal_();
+            return node;
+        }
+
+        // Literal on the left: mirror the operator so the field is always on the left
+        node->literal = parse_literal_();
+        if (!parse_operator_(node->op))
+        {
+            fail_("expected comparison operator");
+        }
+
+        skip_spaces_();
+        if (!is_identifier_start_())
+        {
+            fail_("expected field name");
+        }
+        node->field = parse_field_();
+
+        switch (node->op)
+        {
+            case Operator::less:
+                node->op = Operator::greater;
+                break;
+            case Operator::less_equal:
+                node->op = Operator::greater_equal;
+                break;
+            case Operator::greater:
+                node->op = Operator::less;
+                break;
+            case Operator::greater_equal:
+                node->op = Operator::less_equal;
+                break;
+            default:
+                break;
+        }
+
+        return node;
+    }
+
+    std::vector<std::string> parse_field_()
+    {
+        std::vector<std::string> field;
+
+        do
+        {
+            skip_spaces_();
+            if (!is_identifier_start_())
+            {
+                fail_("expected field name");
+            }
+
+            const std::size_t start = position_;
+            while (position_ < expression_.size() &&
+                    (std::isalnum(static_cast<unsigned char>(expression_[position_])) ||
+                    expression_[position_] == '_'))
+            {
+                ++position_;
+            }
+            field.push_back(expression_.substr(start, position_ - start));
+        } while (consume_("."));
+
+        return field;
+    }
+
+    bool parse_operator_(
+            Operator& op)
+    {
+        // Two character operators first
+        if (consume_("=="))
+        {
+            op = Operator::equal;
+        }
+        else if (consume_("!="))
+        {
+            op = Operator::not_equal;
+        }
+        else if (consume_("<="))
+        {
+            op = Operator::less_equal;
+        }
+        else if (consume_(">="))
+        {
+            op = Operator::greater_equal;
+        }
+        else if (consume_("<"))
+        {
+            op = Operator::less;
+        }
+        else if (consume_(">"))
+        {
+            op = Operator::greater;
+        }
+        else
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    Literal parse_literal_()
+    {
+        Literal literal;
+
+        skip_spaces_();
+        if (position_ >= expression_.size())
+        {
+            fail_("expected literal");
+        }
+
+        const char c = expression_[position_];
+
+        if (c == '\'' || c == '"')
+        {
+            // String literal (backslash escapes the next character)
+            literal.kind = Literal::Kind::string;
+            ++position_;
+            while (position_ < expression_.size() && expression_[position_] != c)
+            {
+                if (expression_[position_] == '\\' && position_ + 1 < expression_.size())
+                {
+                    ++position_;
+                }
+                literal.string.push_back(expression_[position_++]);
+            }
+            if (position_ >= expression_.size())
+            {
+                fail_("unterminated string");
+            }
+            ++position_;
+        }
+        else if (peek_keyword_("true") || peek_keyword_("false"))
+        {
+            literal.kind = Literal::Kind::boolean;
+            literal.boolean = consume_("true");
+            if (!literal.boolean)
+            {
+                consume_("false");
+            }
+        }
+        else if (std::isdigit(static_cast<unsigned char>(c)) || c == '-' || c == '+' || c == '.')
+        {
+            const char* start = expression_.c_str() + position_;
+            char* end = nullptr;
+
+            errno = 0;
+            const long long integer = std::strtoll(start, &end, 10);
+            const bool is_integer = errno == 0 && end != start && *end != '.' && *end != 'e' && *end != 'E';
+
+            if (is_integer)
+            {
+                literal.kind = Literal::Kind::integer;
+                literal.integer = static_cast<std::int64_t>(integer);
+            }
+            else
+            {
+                literal.kind = Literal::Kind::floating;
+                literal.floating = std::strtod(start, &end);
+                if (end == start)
+                {
+                    fail_("malformed number");
+                }
+            }
+            position_ += static_cast<std::size_t>(end - start);
+        }
+        else
+        {
+            fail_("expected literal");
+        }
+
+        return literal;
+    }
+
+    void skip_spaces_() noexcept
+    {
+        while (position_ < expression_.size() && std::isspace(static_cast<unsigned char>(expression_[position_])))
+        {
+            ++position_;
+        }
+    }
+
+    bool peek_(
+            const std::string& token) noexcept
+    {
+        skip_spaces_();
+        return expression_.compare(position_, token.size(), token) == 0;
+    }
+
+    bool peek_keyword_(
+            const std::string& keyword) noexcept
+    {
+        if (!peek_(keyword))
+        {
+            return false;
+        }
+
+        // The keyword must not be the beginning of a longer identifier
+        const std::size_t end = position_ + keyword.size();
+        return end >= expression_.size() ||
+               !(std::isalnum(static_cast<unsigned char>(expression_[end])) || expression_[end] == '_');
+    }
+
+    bool consume_(
+            const std::string& token) noexcept
+    {
+        if (!peek_(token))
+        {
+            return false;
+        }
+
+        position_ += token.size();
+        return true;
+    }
+
+    bool is_identifier_start_() const noexcept
+    {
+        return position_ < expression_.size() &&
+               (std::isalpha(static_cast<unsigned char>(expression_[position_])) || expression_[position_] == '_');
+    }
+
+    [[noreturn]] void fail_(
+            const std::string& reason) const
+    {
+        throw utils::ConfigurationException(
+                  utils::Formatter() << "Invalid content filter <" << expression_ << ">: " << reason <<
+                      " at position " << position_ << ".");
+    }
+
+    const std::string& expression_;
+
+    std::size_t position_;
+};
+
+} /* namespace */
+
+ContentFilterExpression::ContentFilterExpression(
+        const std::string& expression)
+    : expression_(expression)
+    , root_(Parser(expression).parse())
+{
+    // Do nothing
+}
+
+const std::string& ContentFilterExpression::expression() const noexcept
+{
+    return expression_;
+}
+
+std::shared_ptr<const ContentFilterExpression::Node> ContentFilterExpression::root() const noexcept
+{
+    return root_;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
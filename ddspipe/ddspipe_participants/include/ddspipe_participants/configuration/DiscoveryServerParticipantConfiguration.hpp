@@ -16,6 +16,8 @@
 
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/types/compression/CompressionConfiguration.hpp>
+#include <ddspipe_participants/types/delta/DeltaConfiguration.hpp>
 #include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
 #include <ddspipe_participants/types/address/Address.hpp>
 #include <ddspipe_participants/types/address/DiscoveryServerConnectionAddress.hpp>
@@ -59,6 +61,12 @@ struct DiscoveryServerParticipantConfiguration : public SimpleParticipantConfigu
     std::set<types::DiscoveryServerConnectionAddress> connection_addresses {};
 
     types::TlsConfiguration tls_configuration {};
+
+    //! Compression of the payloads exchanged with the remote proxy
+    types::CompressionConfiguration compression {};
+
+    //! Delta encoding of the keyed topics exchanged with the remote proxy
+    types::DeltaConfiguration delta {};
 };
 
 } /* namespace participants */
@@ -0,0 +1,98 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * @brief Enumeration of distributions of the size of the payloads generated.
+ *
+ * - fixed: every payload has \c payload_size bytes.
+ * - uniform: sizes uniformly distributed between \c payload_size and \c max_payload_size .
+ * - exponential: sizes exponentially distributed with mean \c payload_size , truncated at \c max_payload_size .
+ */
+ENUMERATION_BUILDER(
+    PayloadSizeDistribution,
+    fixed,
+    uniform,
+    exponential
+    );
+
+/**
+ * This data struct represents a configuration for a GeneratorParticipant
+ */
+struct GeneratorParticipantConfiguration : public ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    GeneratorParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Prefix of the name of the topics generated (followed by the index of the topic)
+    std::string topic_prefix {"generator_topic_"};
+
+    //! Type name of the topics generated
+    std::string type_name {"GeneratorPayload"};
+
+    //! Number of topics generated
+    unsigned int topics {1};
+
+    //! Samples generated per second in each topic
+    double rate {100};
+
+    //! Number of instances written in each topic (0 for non keyed topics)
+    unsigned int keys {0};
+
+    //! Distribution of the size of the payloads generated
+    PayloadSizeDistribution size_distribution {PayloadSizeDistribution::fixed};
+
+    //! Size [bytes] of the payloads generated (mean size for non fixed distributions)
+    std::uint32_t payload_size {64};
+
+    //! Maximum size [bytes] of the payloads generated for non fixed distributions
+    std::uint32_t max_payload_size {1024};
+
+    //! Samples of a topic waiting to be forwarded before the generator skips new ones (0 for no limit)
+    unsigned int max_pending {1000};
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -14,8 +14,14 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include <cpp_utils/time/time_utils.hpp>
+
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/types/compression/CompressionConfiguration.hpp>
+#include <ddspipe_participants/types/delta/DeltaConfiguration.hpp>
 #include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
 #include <ddspipe_participants/types/address/Address.hpp>
 #include <ddspipe_participants/types/address/DiscoveryServerConnectionAddress.hpp>
@@ -57,6 +63,21 @@ struct InitialPeersParticipantConfiguration : public SimpleParticipantConfigurat
     std::set<types::Address> connection_addresses {};
 
     types::TlsConfiguration tls_configuration {};
+
+    //! Compression of the payloads exchanged with the remote proxy
+    types::CompressionConfiguration compression {};
+
+    //! Delta encoding of the keyed topics exchanged with the remote proxy
+    types::DeltaConfiguration delta {};
+
+    //! Whether the samples of every topic are packed into envelopes of a single internal topic
+    bool bundle {false};
+
+    //! Maximum size of an envelope [bytes]
+    std::uint32_t bundle_max_size {8192};
+
+    //! Maximum time a sample waits in an envelope [ms]
+    utils::Duration_ms bundle_max_delay {10};
 };
 
 } /* namespace participants */
@@ -0,0 +1,216 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <fastdds/rtps/rtps_fwd.h>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/types/bundle/BundleEnvelope.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Bundler packs the samples of every topic written by a Participant into envelopes of the internal bundle topic.
+ *
+ * An envelope is sent when adding a new sample would exceed \c max_size , or when its oldest sample has waited
+ * \c max_delay milliseconds. Every topic is given an id and announced to the remote proxy before its first
+ * sample, and re-announced periodically so late joiners know the ids and create the bridges required too.
+ * A topic is announced as required while the reader it was announced for exists, and as not required afterwards,
+ * so the remote proxy can remove the bridge that writes in it. Announcements never make an envelope exceed
+ * \c max_size .
+ */
+class Bundler
+{
+public:
+
+    /**
+     * @brief Construct a new Bundler
+     *
+     * @param participant_id: Id of the Participant that owns the Bundler.
+     * @param payload_pool: DDS Pipe shared Payload Pool.
+     * @param rtps_participant: RTPS Participant where the bundle writer is created.
+     * @param max_size: Maximum size of an envelope [bytes].
+     * @param max_delay: Maximum time a sample waits in an envelope [ms].
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    Bundler(
+            const core::types::ParticipantId& participant_id,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            fastrtps::rtps::RTPSParticipant* rtps_participant,
+            const std::uint32_t max_size,
+            const utils::Duration_ms max_delay);
+
+    //! Send the pending envelope and stop the flush thread
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~Bundler();
+
+    /**
+     * @brief Create the internal bundle writer and start the flush thread.
+     *
+     * @throw InitializationException if the writer creation fails
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void init();
+
+    /**
+     * @brief Add a sample of topic \c topic_id to the current envelope.
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode add_sample(
+            const std::uint32_t topic_id,
+            const core::types::RtpsPayloadData& data) noexcept;
+
+    /**
+     * @brief Id of \c topic in the envelopes.
+     *
+     * The first time it is called for a topic, a new id is assigned and announced to the remote proxy.
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint32_t topic_id(
+            const core::types::DdsTopic& topic) noexcept;
+
+    /**
+     * @brief Announce \c topic to the remote proxy as required, so it creates the bridge that writes in it.
+     *
+     * The topic is announced as required while \c reader exists.
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void announce(
+            const core::types::DdsTopic& topic,
+            const std::shared_ptr<core::IReader>& reader) noexcept;
+
+    //! Number of samples sent inside envelopes
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t samples_bundled() const noexcept;
+
+    //! Number of envelopes sent
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t envelopes_sent() const noexcept;
+
+    //! Period to announce again every topic [ms]
+    static constexpr const utils::Duration_ms ANNOUNCEMENT_PERIOD = 5000;
+
+protected:
+
+    //! Topic announced to the remote proxy
+    struct AnnouncedTopic
+    {
+        //! Topic announced
+        core::types::DdsTopic topic;
+
+        //! Reader that requires the topic (if any)
+        std::weak_ptr<core::IReader> reader;
+
+        //! Whether the remote proxy must create the bridge of the topic
+        bool required;
+    };
+
+    //! Get the id of \c topic , assigning and announcing it if new (or if it becomes required by \c reader )
+    std::uint32_t register_topic_nts_(
+            const core::types::DdsTopic& topic,
+            const std::shared_ptr<core::IReader>& reader) noexcept;
+
+    //! Add the announcement of \c topic_id to the current envelope, sending it first if it would not fit
+    void add_announcement_nts_(
+            const std::uint32_t topic_id,
+            const AnnouncedTopic& announced) noexcept;
+
+    //! Send the current envelope (if not empty) and start a new one
+    void flush_nts_() noexcept;
+
+    //! Routine of \c flush_thread_ that sends the envelopes on deadline and the periodic announcements
+    void flush_routine_() noexcept;
+
+    //! Id of the Participant that owns the Bundler
+    const core::types::ParticipantId participant_id_;
+
+    //! DDS Pipe shared Payload Pool
+    const std::shared_ptr<core::PayloadPool> payload_pool_;
+
+    //! RTPS Participant where the bundle writer is created
+    fastrtps::rtps::RTPSParticipant* rtps_participant_;
+
+    //! Maximum size of an envelope
+    const std::uint32_t max_size_;
+
+    //! Maximum time a sample waits in an envelope
+    const std::chrono::milliseconds max_delay_;
+
+    //! Writer of the internal bundle topic
+    std::shared_ptr<core::IWriter> writer_;
+
+    //! Envelope being filled
+    types::BundleEnvelope envelope_;
+
+    //! Time when the first sample of \c envelope_ was added
+    std::chrono::steady_clock::time_point envelope_start_;
+
+    //! Ids of the topics announced, indexed by topic key
+    std::map<types::BundleEnvelope::TopicKey, std::uint32_t> topic_ids_;
+
+    //! Topics announced, indexed by topic id
+    std::map<std::uint32_t, AnnouncedTopic> announced_topics_;
+
+    //! Id of the next topic announced
+    std::uint32_t next_topic_id_;
+
+    //! Number of samples sent inside envelopes
+    std::atomic<std::uint64_t> samples_bundled_;
+
+    //! Number of envelopes sent
+    std::atomic<std::uint64_t> envelopes_sent_;
+
+    //! Whether the flush thread must finish
+    bool stop_;
+
+    //! Protects \c envelope_ , the topics announced and \c stop_
+    std::mutex mutex_;
+
+    //! Awakes the flush thread when a new envelope starts or when it must stop
+    std::condition_variable cv_;
+
+    //! Thread that sends the envelopes whose deadline is reached
+    std::thread flush_thread_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
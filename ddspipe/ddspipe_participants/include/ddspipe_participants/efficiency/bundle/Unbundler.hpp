@@ -0,0 +1,198 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <fastdds/rtps/rtps_fwd.h>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+#include <ddspipe_participants/types/bundle/BundleEnvelope.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Unbundler receives the envelopes of the internal bundle topic and dispatches each sample inside them to the
+ * reader registered for its topic.
+ *
+ * Envelopes are processed in a dedicated thread, so the RTPS listener thread only notifies their arrival.
+ * The topic ids of each remote Bundler are learnt from its announcements, and the topics announced as required
+ * are notified through a callback, so the Participant can make the topic discovered. A topic is notified as
+ * withdrawn once its remote Bundler announces it as not required, or stops announcing it (or sending envelopes)
+ * for \c ANNOUNCEMENT_TIMEOUT , so the Participant can remove it again.
+ */
+class Unbundler
+{
+public:
+
+    //! Callback called with a remote bundle writer and a topic it requires (or no longer requires)
+    using AnnouncementCallback = std::function<void (const core::types::Guid&, const core::types::DdsTopic&)>;
+
+    /**
+     * @brief Construct a new Unbundler
+     *
+     * @param participant_id: Id of the Participant that owns the Unbundler.
+     * @param payload_pool: DDS Pipe shared Payload Pool.
+     * @param rtps_participant: RTPS Participant where the bundle reader is created.
+     * @param on_announcement: Callback called the first time each remote bundle writer announces a topic as required.
+     * @param on_withdrawal: Callback called when a topic notified in \c on_announcement is no longer required.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    Unbundler(
+            const core::types::ParticipantId& participant_id,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            fastrtps::rtps::RTPSParticipant* rtps_participant,
+            const AnnouncementCallback& on_announcement,
+            const AnnouncementCallback& on_withdrawal);
+
+    //! Stop the dispatch thread
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~Unbundler();
+
+    /**
+     * @brief Create the internal bundle reader and start the dispatch thread.
+     *
+     * @throw InitializationException if the reader creation fails
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void init();
+
+    /**
+     * @brief Create the reader where the samples of \c topic are dispatched.
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<InternalReader> create_reader(
+            const core::types::DdsTopic& topic);
+
+    //! Number of envelopes received
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t envelopes_received() const noexcept;
+
+    //! Number of samples dispatched to a reader
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t samples_unbundled() const noexcept;
+
+    //! Time after which a topic not announced again is withdrawn (three announcement periods) [ms]
+    static constexpr const utils::Duration_ms ANNOUNCEMENT_TIMEOUT = 15000;
+
+protected:
+
+    //! State learnt from the envelopes of a remote bundle writer
+    struct RemoteBundler
+    {
+        //! Topic keys indexed by the id announced
+        std::map<std::uint32_t, types::BundleEnvelope::TopicKey> topic_ids;
+
+        //! Topics announced as required, with the time of their last announcement
+        std::map<types::BundleEnvelope::TopicKey,
+                std::pair<core::types::DdsTopic, std::chrono::steady_clock::time_point>> required_topics;
+
+        //! Time of the last envelope received
+        std::chrono::steady_clock::time_point last_seen;
+    };
+
+    //! Routine of \c dispatch_thread_ that takes and parses the envelopes received
+    void dispatch_routine_() noexcept;
+
+    //! Dispatch a sample sent by the bundle writer \c source to the reader of its topic
+    void on_sample_(
+            const core::types::Guid& source,
+            const std::uint32_t topic_id,
+            std::unique_ptr<core::types::RtpsPayloadData>&& data) noexcept;
+
+    //! Learn the id of a topic announced by the bundle writer \c source , and notify whether it is required
+    void on_announcement_(
+            const core::types::Guid& source,
+            const std::uint32_t topic_id,
+            const core::types::DdsTopic& topic,
+            const bool required) noexcept;
+
+    //! Forget the remote bundle writers and required topics not heard of for \c ANNOUNCEMENT_TIMEOUT
+    void expire_remote_bundlers_() noexcept;
+
+    //! Id of the Participant that owns the Unbundler
+    const core::types::ParticipantId participant_id_;
+
+    //! DDS Pipe shared Payload Pool
+    const std::shared_ptr<core::PayloadPool> payload_pool_;
+
+    //! RTPS Participant where the bundle reader is created
+    fastrtps::rtps::RTPSParticipant* rtps_participant_;
+
+    //! Callback called the first time each remote bundle writer announces a topic as required
+    const AnnouncementCallback on_announcement_callback_;
+
+    //! Callback called when a topic is no longer required by a remote bundle writer
+    const AnnouncementCallback on_withdrawal_callback_;
+
+    //! Reader of the internal bundle topic
+    std::shared_ptr<core::IReader> reader_;
+
+    //! Readers where the samples are dispatched, indexed by topic key
+    std::map<types::BundleEnvelope::TopicKey, std::weak_ptr<InternalReader>> readers_;
+
+    //! State of every remote bundle writer (topic ids are only unique per writer)
+    std::map<core::types::Guid, RemoteBundler> remote_bundlers_;
+
+    //! Protects \c readers_ and \c remote_bundlers_
+    std::mutex readers_mutex_;
+
+    //! Number of envelopes received
+    std::atomic<std::uint64_t> envelopes_received_;
+
+    //! Number of samples dispatched to a reader
+    std::atomic<std::uint64_t> samples_unbundled_;
+
+    //! Whether there are envelopes pending to take
+    bool data_available_;
+
+    //! Whether the dispatch thread must finish
+    bool stop_;
+
+    //! Protects \c data_available_ and \c stop_
+    std::mutex dispatch_mutex_;
+
+    //! Awakes the dispatch thread when an envelope arrives or when it must stop
+    std::condition_variable dispatch_cv_;
+
+    //! Thread that parses the envelopes received
+    std::thread dispatch_thread_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
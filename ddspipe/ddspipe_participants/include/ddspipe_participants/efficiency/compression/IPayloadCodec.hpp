@@ -0,0 +1,88 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Interface of a codec that compresses and decompresses payloads.
+ *
+ * Implement this interface to add a new codec to \c PayloadCompressor .
+ */
+class IPayloadCodec
+{
+public:
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual ~IPayloadCodec() = default;
+
+    //! Id of the codec written in every compressed payload (must be unique and different from 0)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual std::uint8_t id() const noexcept = 0;
+
+    //! Maximum size that a payload of \c size bytes can take once compressed
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual std::uint32_t max_compressed_size(
+            const std::uint32_t size) const noexcept = 0;
+
+    //! Maximum size that \c size bytes of compressed data can take once decompressed
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual std::uint64_t max_decompressed_size(
+            const std::uint32_t size) const noexcept = 0;
+
+    /**
+     * @brief Compress \c src into \c dst .
+     *
+     * @param [in] src : data to compress
+     * @param [in] src_size : size of \c src
+     * @param [out] dst : buffer where the compressed data is written
+     * @param [in,out] dst_size : capacity of \c dst as input, size of the compressed data as output
+     *
+     * @return whether the data has been compressed
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool compress(
+            const std::uint8_t* src,
+            const std::uint32_t src_size,
+            std::uint8_t* dst,
+            std::uint32_t& dst_size) const noexcept = 0;
+
+    /**
+     * @brief Decompress \c src into \c dst .
+     *
+     * @param [in] src : compressed data
+     * @param [in] src_size : size of \c src
+     * @param [out] dst : buffer where the original data is written
+     * @param [in] dst_size : size of the original data
+     *
+     * @return whether the data has been decompressed into exactly \c dst_size bytes
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool decompress(
+            const std::uint8_t* src,
+            const std::uint32_t src_size,
+            std::uint8_t* dst,
+            const std::uint32_t dst_size) const noexcept = 0;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
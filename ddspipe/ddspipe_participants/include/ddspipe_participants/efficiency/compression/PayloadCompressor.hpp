@@ -0,0 +1,183 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/metrics/EntityMetrics.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddspipe_participants/efficiency/compression/IPayloadCodec.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/types/compression/CompressionConfiguration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * PayloadCompressor compresses the payloads written by a Participant and decompresses the ones it receives.
+ *
+ * A compressed payload starts with a header (magic, codec id and original size) followed by the data compressed
+ * by the codec. Payloads smaller than the threshold, or that do not get smaller once compressed, are sent as they
+ * are: serialized CDR payloads start with a zero byte, so they are never mistaken for a compressed one.
+ *
+ * A compressed payload received is only decompressed if its original size is not above \c max_payload_size nor
+ * above what the codec can expand its size to, so a malformed header cannot reserve an arbitrarily large payload.
+ *
+ * It keeps the statistics of every payload compressed and decompressed, that are reported on destruction, and adds
+ * the sizes and time spent to the \c EntityMetrics of its participant.
+ */
+class PayloadCompressor
+{
+public:
+
+    /**
+     * @brief Construct a new Payload Compressor
+     *
+     * @param participant_id : Id of the Participant that owns the compressor.
+     * @param payload_pool : DDS Pipe shared Payload Pool.
+     * @param codec : codec used to compress the payloads.
+     * @param threshold : payloads smaller than this size [bytes] are not compressed.
+     * @param max_payload_size : compressed payloads larger than this size [bytes] once decompressed are discarded.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    PayloadCompressor(
+            const core::types::ParticipantId& participant_id,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            const std::shared_ptr<IPayloadCodec>& codec,
+            const std::uint32_t threshold,
+            const std::uint32_t max_payload_size);
+
+    //! Report the compression statistics
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~PayloadCompressor();
+
+    /**
+     * @brief Create the compressor for the codec in \c configuration .
+     *
+     * @return nullptr if compression is not active in \c configuration
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static std::shared_ptr<PayloadCompressor> create(
+            const core::types::ParticipantId& participant_id,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            const types::CompressionConfiguration& configuration);
+
+    /**
+     * @brief Compress \c payload into a new payload reserved in the Payload Pool.
+     *
+     * @return false if \c payload is not worth compressing (\c compressed is not set)
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool compress(
+            const core::types::Payload& payload,
+            core::types::Payload& compressed) noexcept;
+
+    /**
+     * @brief Decompress \c payload into a new payload reserved in the Payload Pool.
+     *
+     * @param [in] payload : payload received
+     * @param [out] decompressed : payload decompressed (only set if return is \c true )
+     * @param [out] error : whether \c payload is compressed but could not be decompressed
+     *
+     * @return whether \c payload was compressed and has been decompressed
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool decompress(
+            const core::types::Payload& payload,
+            core::types::Payload& decompressed,
+            bool& error) noexcept;
+
+    //! Number of payloads compressed
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t payloads_compressed() const noexcept;
+
+    //! Number of payloads sent uncompressed (under threshold or incompressible)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t payloads_skipped() const noexcept;
+
+    //! Number of payloads decompressed
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t payloads_decompressed() const noexcept;
+
+    //! Ratio between the original and the compressed size of the payloads compressed (0 if none)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    double compression_ratio() const noexcept;
+
+    //! Time spent compressing [ns]
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t compression_time() const noexcept;
+
+    //! Time spent decompressing [ns]
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t decompression_time() const noexcept;
+
+    //! Size of the header of a compressed payload
+    static constexpr const std::uint32_t HEADER_SIZE = 8;
+
+protected:
+
+    //! Id of the Participant that owns the compressor
+    const core::types::ParticipantId participant_id_;
+
+    //! DDS Pipe shared Payload Pool
+    const std::shared_ptr<core::PayloadPool> payload_pool_;
+
+    //! Codec used to compress the payloads
+    const std::shared_ptr<IPayloadCodec> codec_;
+
+    //! Payloads smaller than this size are not compressed
+    const std::uint32_t threshold_;
+
+    //! Compressed payloads larger than this size once decompressed are discarded
+    const std::uint32_t max_payload_size_;
+
+    //! Metrics of the participant that owns the compressor
+    std::shared_ptr<core::EntityMetrics> participant_metrics_;
+
+    //! Number of payloads compressed
+    std::atomic<std::uint64_t> payloads_compressed_;
+
+    //! Number of payloads sent uncompressed
+    std::atomic<std::uint64_t> payloads_skipped_;
+
+    //! Number of payloads decompressed
+    std::atomic<std::uint64_t> payloads_decompressed_;
+
+    //! Original size of the payloads compressed
+    std::atomic<std::uint64_t> bytes_in_;
+
+    //! Compressed size of the payloads compressed (header included)
+    std::atomic<std::uint64_t> bytes_out_;
+
+    //! Time spent compressing [ns]
+    std::atomic<std::uint64_t> compression_time_;
+
+    //! Time spent decompressing [ns]
+    std::atomic<std::uint64_t> decompression_time_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,79 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <ddspipe_participants/efficiency/compression/IPayloadCodec.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Payload codec based on zlib (deflate).
+ */
+class ZlibCodec : public IPayloadCodec
+{
+public:
+
+    /**
+     * @brief Construct a new Zlib Codec
+     *
+     * @param level : compression level (from 1, fastest, to 9, smallest)
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ZlibCodec(
+            const unsigned int level);
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint8_t id() const noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint32_t max_compressed_size(
+            const std::uint32_t size) const noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t max_decompressed_size(
+            const std::uint32_t size) const noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool compress(
+            const std::uint8_t* src,
+            const std::uint32_t src_size,
+            std::uint8_t* dst,
+            std::uint32_t& dst_size) const noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool decompress(
+            const std::uint8_t* src,
+            const std::uint32_t src_size,
+            std::uint8_t* dst,
+            const std::uint32_t dst_size) const noexcept override;
+
+    //! Id of the zlib codec in the compressed payloads
+    static constexpr const std::uint8_t ID = 1;
+
+    //! Maximum ratio between the original and the compressed size of deflate data
+    static constexpr const std::uint64_t MAX_EXPANSION_RATIO = 1032;
+
+protected:
+
+    //! Compression level
+    const int level_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
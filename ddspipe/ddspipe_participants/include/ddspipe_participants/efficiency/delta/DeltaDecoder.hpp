@@ -0,0 +1,141 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * DeltaDecoder rebuilds the full payloads of the \c DeltaFrame sent by the \c DeltaEncoder of remote proxies.
+ *
+ * It keeps the last payload rebuilt of every instance of every encoder. A delta that does not follow the last frame
+ * received (the previous one was lost or this reader joined late) cannot be rebuilt, so the instance is not
+ * forwarded until its next keyframe.
+ *
+ * Every encoder sends its frames in a new stream, so the state of a remote proxy that has restarted is left behind.
+ * Whenever a new stream appears, the streams that have not sent any frame in \c STREAM_TIMEOUT are forgotten.
+ */
+class DeltaDecoder
+{
+public:
+
+    /**
+     * @brief Construct a new Delta Decoder
+     *
+     * @param topic_name : name of the topic decoded (for logging).
+     * @param payload_pool : DDS Pipe shared Payload Pool.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DeltaDecoder(
+            const std::string& topic_name,
+            const std::shared_ptr<core::PayloadPool>& payload_pool);
+
+    //! Report the decoding statistics
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~DeltaDecoder();
+
+    /**
+     * @brief Rebuild the payload of \c data into a new payload reserved in the Payload Pool.
+     *
+     * @param [in] data : sample received
+     * @param [out] decoded : payload rebuilt (only set if return is \c true )
+     * @param [out] error : whether \c data is a frame that could not be rebuilt
+     *
+     * @return whether \c data was a frame and its payload has been rebuilt
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool decode(
+            const core::types::RtpsPayloadData& data,
+            core::types::Payload& decoded,
+            bool& error) noexcept;
+
+    //! Number of deltas that could not be rebuilt
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t deltas_dropped() const noexcept;
+
+    //! Time without frames after which the state of a stream is forgotten [ms]
+    static constexpr const utils::Duration_ms STREAM_TIMEOUT = 60000;
+
+protected:
+
+    //! Last state rebuilt of an instance
+    struct InstanceState
+    {
+        //! Last payload rebuilt
+        std::vector<std::uint8_t> payload;
+
+        //! Counter of the last frame received
+        std::uint32_t counter {0};
+    };
+
+    //! State of the instances sent by an encoder
+    struct StreamState
+    {
+        //! Last state rebuilt of every instance
+        std::map<core::types::InstanceHandle, InstanceState> instances;
+
+        //! Time when the last frame of the stream was received
+        std::chrono::steady_clock::time_point last_seen;
+    };
+
+    //! Get the state of \c stream , forgetting the idle streams if it is new
+    StreamState& stream_state_nts_(
+            const std::uint32_t stream) noexcept;
+
+    //! Name of the topic decoded
+    const std::string topic_name_;
+
+    //! DDS Pipe shared Payload Pool
+    const std::shared_ptr<core::PayloadPool> payload_pool_;
+
+    //! State of every encoder, indexed by stream
+    std::map<std::uint32_t, StreamState> streams_;
+
+    //! Protects \c streams_
+    std::mutex mutex_;
+
+    //! Number of keyframes received
+    std::atomic<std::uint64_t> keyframes_received_;
+
+    //! Number of deltas rebuilt
+    std::atomic<std::uint64_t> deltas_received_;
+
+    //! Number of deltas that could not be rebuilt
+    std::atomic<std::uint64_t> deltas_dropped_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
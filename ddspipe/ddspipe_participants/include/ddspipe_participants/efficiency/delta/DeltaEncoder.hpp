@@ -0,0 +1,141 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * DeltaEncoder keeps the last payload sent of every instance of a topic, and encodes each new payload as a
+ * \c DeltaFrame against it.
+ *
+ * A keyframe is sent for the first sample of an instance, every \c keyframe_interval samples, when the size
+ * of the payload changes or when the delta would not be smaller than the payload.
+ *
+ * Not thread safe: each writer owns its encoder.
+ */
+class DeltaEncoder
+{
+public:
+
+    /**
+     * @brief Construct a new Delta Encoder
+     *
+     * @param topic_name : name of the topic encoded (for logging).
+     * @param payload_pool : DDS Pipe shared Payload Pool.
+     * @param keyframe_interval : number of samples of an instance between two keyframes.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DeltaEncoder(
+            const std::string& topic_name,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            const std::uint32_t keyframe_interval);
+
+    //! Report the encoding statistics
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~DeltaEncoder();
+
+    /**
+     * @brief Encode the payload of \c data into a new payload reserved in the Payload Pool.
+     *
+     * @return false if \c data must be sent as it is (disposals, unregistrations or empty payloads)
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool encode(
+            const core::types::RtpsPayloadData& data,
+            core::types::Payload& encoded) noexcept;
+
+    /**
+     * @brief Forget the state of \c instance , as its last frame encoded could not be sent.
+     *
+     * The next sample of the instance is encoded as a keyframe, so the receiver does not miss the frame that
+     * the following deltas would be calculated against.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void discard(
+            const core::types::InstanceHandle& instance) noexcept;
+
+    //! Number of keyframes sent
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t keyframes_sent() const noexcept;
+
+    //! Number of deltas sent
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t deltas_sent() const noexcept;
+
+    //! Ratio between the original and the encoded size of the payloads encoded (0 if none)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    double encoding_ratio() const noexcept;
+
+protected:
+
+    //! Last state sent of an instance
+    struct InstanceState
+    {
+        //! Last payload sent
+        std::vector<std::uint8_t> payload;
+
+        //! Counter of the last frame sent
+        std::uint32_t counter {0};
+
+        //! Deltas sent since the last keyframe
+        std::uint32_t deltas_since_keyframe {0};
+    };
+
+    //! Name of the topic encoded
+    const std::string topic_name_;
+
+    //! DDS Pipe shared Payload Pool
+    const std::shared_ptr<core::PayloadPool> payload_pool_;
+
+    //! Number of samples of an instance between two keyframes
+    const std::uint32_t keyframe_interval_;
+
+    //! Identifier of this encoder in the frames it sends
+    const std::uint32_t stream_;
+
+    //! Last state sent of every instance
+    std::map<core::types::InstanceHandle, InstanceState> instances_;
+
+    //! Number of keyframes sent
+    std::atomic<std::uint64_t> keyframes_sent_;
+
+    //! Number of deltas sent
+    std::atomic<std::uint64_t> deltas_sent_;
+
+    //! Original size of the payloads encoded
+    std::atomic<std::uint64_t> bytes_in_;
+
+    //! Size of the frames sent
+    std::atomic<std::uint64_t> bytes_out_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
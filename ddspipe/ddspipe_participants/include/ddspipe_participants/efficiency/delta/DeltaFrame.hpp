@@ -0,0 +1,108 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Wire format of the payloads sent by a delta encoded writer.
+ *
+ * Every frame starts with a header (magic, kind, stream, counter and original size, little endian) followed by:
+ * - KEYFRAME: the original payload.
+ * - DELTA: the XOR of the payload with the previous one of the same instance, run-length encoded as a sequence of
+ *   (zero run, literal length, literal bytes) with both lengths as varints. Trailing zeros are not encoded.
+ *
+ * The stream identifies the encoder that sent the frame, and the counter the position of the frame in the
+ * instance, so a delta is only applied over the frame right before it.
+ */
+struct DeltaFrame
+{
+    //! Kind of frame
+    enum class Kind : std::uint8_t
+    {
+        keyframe = 0,
+        delta = 1,
+    };
+
+    //! Header of every frame
+    struct Header
+    {
+        Kind kind {Kind::keyframe};
+        std::uint32_t stream {0};
+        std::uint32_t counter {0};
+        std::uint32_t length {0};
+    };
+
+    //! Write \c header in the first \c HEADER_SIZE bytes of \c dst
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static void write_header(
+            const Header& header,
+            std::uint8_t* dst) noexcept;
+
+    /**
+     * @brief Read the header of the frame in \c src .
+     *
+     * @return false if \c src is not a delta frame (serialized CDR payloads start with a zero byte)
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static bool read_header(
+            const std::uint8_t* src,
+            const std::uint32_t size,
+            Header& header) noexcept;
+
+    /**
+     * @brief Encode the difference between \c previous and \c current .
+     *
+     * @param [in] previous : previous payload of the instance
+     * @param [in] current : new payload of the instance (same size as \c previous )
+     * @param [in] size : size of both payloads
+     * @param [out] dst : buffer where the delta is written
+     * @param [in,out] dst_size : capacity of \c dst as input, size of the delta as output
+     *
+     * @return false if the delta does not fit in \c dst
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static bool encode_delta(
+            const std::uint8_t* previous,
+            const std::uint8_t* current,
+            const std::uint32_t size,
+            std::uint8_t* dst,
+            std::uint32_t& dst_size) noexcept;
+
+    /**
+     * @brief Apply the delta in \c src over \c payload .
+     *
+     * @return false if the delta is malformed or exceeds \c size (\c payload is left partially modified)
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static bool apply_delta(
+            const std::uint8_t* src,
+            const std::uint32_t src_size,
+            std::uint8_t* payload,
+            const std::uint32_t size) noexcept;
+
+    //! Size of the header of every frame
+    static constexpr const std::uint32_t HEADER_SIZE = 16;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
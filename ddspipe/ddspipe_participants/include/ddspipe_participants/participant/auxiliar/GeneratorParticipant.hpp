@@ -0,0 +1,158 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddspipe_participants/participant/auxiliar/BlankParticipant.hpp>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Participant that generates synthetic data in process, to load the DDS Pipe without any external application.
+ *
+ * It announces a writer and a reader in every topic generated, so a bridge is created for them whatever the
+ * discovery trigger is. Its readers receive samples at the configured rate, with the configured payload size
+ * distribution and number of instances. Each payload is CDR little endian encapsulated and carries the key and
+ * the sequence number of the sample, followed by filler bytes.
+ *
+ * If a topic has \c max_pending samples waiting to be forwarded, new samples are skipped instead of queued,
+ * so a pipe that can not keep up does not make the memory grow without bound.
+ */
+class GeneratorParticipant : public BlankParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Generator Participant and start generating data.
+     *
+     * @param participant_configuration : configuration of the data generated.
+     * @param payload_pool : DDS Pipe shared Payload Pool.
+     * @param discovery_database : DDS Pipe shared Discovery Database.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    GeneratorParticipant(
+            const std::shared_ptr<GeneratorParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            const std::shared_ptr<core::DiscoveryDatabase>& discovery_database);
+
+    //! Stop generating data and report the generation statistics
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~GeneratorParticipant();
+
+    //! Override create_reader() IParticipant method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<core::IReader> create_reader(
+            const core::ITopic& topic) override;
+
+    //! Number of samples generated
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t samples_generated() const noexcept;
+
+    //! Number of samples skipped because too many were pending to be forwarded
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint64_t samples_skipped() const noexcept;
+
+    //! Size [bytes] of the header of the payloads generated (encapsulation, key and sequence number)
+    static constexpr const std::uint32_t HEADER_SIZE = 16;
+
+protected:
+
+    //! Data of a generated topic
+    struct GeneratedTopic
+    {
+        //! Topic generated
+        core::types::DdsTopic topic;
+
+        //! Guid of the writer announced in the topic, source of every sample generated
+        core::types::Guid writer_guid;
+
+        //! Reader where the samples of the topic are received
+        std::shared_ptr<InternalReader> reader;
+
+        //! Sequence number of the last sample generated
+        std::uint64_t sequence_number;
+    };
+
+    //! Generate every sample owed at the configured rate until stopped
+    void generation_routine_() noexcept;
+
+    //! Generate the next sample of \c topic
+    void generate_sample_(
+            GeneratedTopic& topic) noexcept;
+
+    //! Size of the next payload following the configured distribution
+    std::uint32_t next_payload_size_() noexcept;
+
+    //! Announce an endpoint of \c kind in \c topic
+    void announce_endpoint_(
+            const GeneratedTopic& topic,
+            const core::types::EndpointKind kind,
+            const core::types::Guid& guid);
+
+    //! Reference to alias access of this object configuration without casting every time
+    const std::shared_ptr<GeneratorParticipantConfiguration> configuration_;
+
+    //! DDS Pipe shared Payload Pool
+    const std::shared_ptr<core::PayloadPool> payload_pool_;
+
+    //! DDS Pipe shared Discovery Database
+    const std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
+
+    //! Topics generated
+    std::vector<GeneratedTopic> topics_;
+
+    //! Random generator of the payload sizes (only used by the generation thread)
+    std::mt19937 random_generator_;
+
+    //! Number of samples generated
+    std::atomic<std::uint64_t> samples_generated_;
+
+    //! Number of samples skipped
+    std::atomic<std::uint64_t> samples_skipped_;
+
+    //! Whether the generation must stop
+    bool stop_;
+
+    //! Protects \c stop_
+    std::mutex mutex_;
+
+    //! Awakes the generation thread when stopping
+    std::condition_variable cv_;
+
+    //! Thread generating the data
+    std::thread generation_thread_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,76 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/participant/auxiliar/BlankParticipant.hpp>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Participant that introduces in the DDS Pipe the data generated inside the process for a single topic.
+ *
+ * The data given to its \c InternalReader is forwarded by the bridge of the topic to every other participant,
+ * as if it had been received from the network. It does not discover anything nor write any data.
+ *
+ * Writer: BlankWriter
+ * Reader: InternalReader for the topic given, BlankReader for any other
+ */
+class InternalParticipant : public BlankParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Internal Participant
+     *
+     * @param id : Id of this participant
+     * @param topic_name : name of the topic whose data is generated inside the process
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    InternalParticipant(
+            const core::types::ParticipantId& id,
+            const std::string& topic_name);
+
+    //! Override create_reader() IParticipant method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<core::IReader> create_reader(
+            const core::ITopic& topic) override;
+
+    /**
+     * @brief Reader where the data of the topic must be introduced.
+     *
+     * It is the same Reader for every bridge of the topic, so it can be kept while the bridge is recreated.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<InternalReader> reader() const noexcept;
+
+protected:
+
+    //! Name of the topic whose data is generated inside the process
+    const std::string topic_name_;
+
+    //! Reader of the topic
+    std::shared_ptr<InternalReader> reader_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,81 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <ddspipe_participants/configuration/SinkParticipantConfiguration.hpp>
+#include <ddspipe_participants/participant/auxiliar/BlankParticipant.hpp>
+#include <ddspipe_participants/writer/auxiliar/SinkWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Concrete Participant that drops every message that arrives, measuring the reception of every topic.
+ *
+ * It counts the samples, bytes, lost, duplicated and out of order sequence numbers and the latency of every topic,
+ * and prints a summary report on destruction. Along with a load source (e.g. a \c GeneratorParticipant ), it
+ * measures the throughput and latency of the DDS Pipe end to end.
+ */
+class SinkParticipant : public BlankParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Sink Participant
+     *
+     * @param participant_configuration : configuration of the report.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    SinkParticipant(
+            const std::shared_ptr<SinkParticipantConfiguration>& participant_configuration);
+
+    //! Print the report of every topic received
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~SinkParticipant();
+
+    //! Override create_writer() IParticipant method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<core::IWriter> create_writer(
+            const core::ITopic& topic) override;
+
+    //! Statistics of every topic received, indexed by topic name
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::map<std::string, SinkStatistics> statistics() const noexcept;
+
+    //! Print the report of every topic received
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void report() const noexcept;
+
+protected:
+
+    //! Reference to alias access of this object configuration without casting every time
+    const std::shared_ptr<SinkParticipantConfiguration> configuration_;
+
+    //! Writer of every topic, indexed by unique topic name, kept while the participant lives to report them
+    std::map<std::string, std::shared_ptr<SinkWriter>> writers_;
+
+    //! Mutex to protect \c writers_
+    mutable std::mutex mutex_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -29,11 +29,14 @@
 #include <ddspipe_core/interface/IParticipant.hpp>
 #include <ddspipe_core/types/dds/DomainId.hpp>
 #include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+#include <ddspipe_participants/efficiency/compression/PayloadCompressor.hpp>
 #include <ddspipe_participants/library/library_dll.h>
 #include <ddspipe_participants/types/address/Address.hpp>
+#include <ddspipe_participants/types/delta/DeltaConfiguration.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -207,6 +210,32 @@ protected:
     static fastrtps::rtps::RTPSParticipantAttributes reckon_participant_attributes_(
             const ParticipantConfiguration* participant_configuration);
 
+    /**
+     * @brief Wrap \c writer so it compresses the payloads (only if \c compressor_ is set).
+     */
+    std::shared_ptr<core::IWriter> apply_compression_(
+            const std::shared_ptr<core::IWriter>& writer) const;
+
+    /**
+     * @brief Wrap \c reader so it decompresses the payloads (only if \c compressor_ is set).
+     */
+    std::shared_ptr<core::IReader> apply_compression_(
+            const std::shared_ptr<core::IReader>& reader) const;
+
+    /**
+     * @brief Wrap \c writer so it delta encodes the payloads (only if \c delta_ is enabled and \c topic is keyed).
+     */
+    std::shared_ptr<core::IWriter> apply_delta_(
+            const std::shared_ptr<core::IWriter>& writer,
+            const core::types::DdsTopic& topic) const;
+
+    /**
+     * @brief Wrap \c reader so it rebuilds delta encoded payloads (only if \c delta_ is enabled and \c topic is keyed).
+     */
+    std::shared_ptr<core::IReader> apply_delta_(
+            const std::shared_ptr<core::IReader>& reader,
+            const core::types::DdsTopic& topic) const;
+
     /////
     // VARIABLES
 
@@ -227,6 +256,12 @@ protected:
 
     //! Participant attributes to create the internal RTPS Participant.
     fastrtps::rtps::RTPSParticipantAttributes participant_attributes_;
+
+    //! Compresses the payloads sent and decompresses the ones received (only set by WAN participants).
+    std::shared_ptr<PayloadCompressor> compressor_;
+
+    //! Delta encoding of keyed topics (only enabled by WAN participants).
+    types::DeltaConfiguration delta_;
 };
 
 } /* namespace rtps */
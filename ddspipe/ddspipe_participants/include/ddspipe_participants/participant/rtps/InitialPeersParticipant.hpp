@@ -14,9 +14,16 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 
 #include <ddspipe_participants/configuration/InitialPeersParticipantConfiguration.hpp>
+#include <ddspipe_participants/efficiency/bundle/Bundler.hpp>
+#include <ddspipe_participants/efficiency/bundle/Unbundler.hpp>
 #include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
 
 #include <ddspipe_participants/participant/rtps/CommonParticipant.hpp>
@@ -40,11 +47,73 @@ public:
             const std::shared_ptr<core::PayloadPool>& payload_pool,
             const std::shared_ptr<core::DiscoveryDatabase>& discovery_database);
 
+    /**
+     * @brief Create the internal RTPS participant and, if bundle is enabled, the bundle writer and reader.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void init() override;
+
+    /**
+     * @brief Create a writer object
+     *
+     * If bundle is enabled, the samples of RTPS topics are added to the bundle envelopes.
+     * The envelopes are sent through a single RELIABLE and VOLATILE writer, so the samples of every bundled topic
+     * are forwarded reliably to the remote proxy, whatever the reliability of the topic.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<core::IWriter> create_writer(
+            const core::ITopic& topic) override;
+
+    /**
+     * @brief Create a reader object
+     *
+     * If bundle is enabled, the RTPS topics are announced to the remote proxy and their samples are taken from
+     * the bundle envelopes.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<core::IReader> create_reader(
+            const core::ITopic& topic) override;
+
 protected:
 
     static fastrtps::rtps::RTPSParticipantAttributes reckon_participant_attributes_(
             const InitialPeersParticipantConfiguration* configuration);
 
+    //! Whether bundle is enabled and \c topic is forwarded inside the envelopes
+    bool is_bundled_(
+            const core::ITopic& topic) const noexcept;
+
+    //! Add to the database a simulated reader for a topic required by the remote bundle writer \c source
+    void on_topic_announced_(
+            const core::types::Guid& source,
+            const core::types::DdsTopic& topic);
+
+    //! Erase from the database the simulated reader of a topic no longer required by \c source
+    void on_topic_withdrawn_(
+            const core::types::Guid& source,
+            const core::types::DdsTopic& topic);
+
+    //! Whether the samples are packed into envelopes of a single internal topic
+    const bool bundle_;
+
+    //! Maximum size of an envelope
+    const std::uint32_t bundle_max_size_;
+
+    //! Maximum time a sample waits in an envelope
+    const utils::Duration_ms bundle_max_delay_;
+
+    //! Simulated readers of the topics required by each remote bundle writer
+    std::map<std::pair<core::types::Guid, types::BundleEnvelope::TopicKey>, core::types::Endpoint> simulated_endpoints_;
+
+    //! Protects \c simulated_endpoints_
+    std::mutex simulated_endpoints_mutex_;
+
+    //! Packs the samples written in envelopes (only if bundle is enabled)
+    std::shared_ptr<Bundler> bundler_;
+
+    //! Dispatches the samples of the envelopes received (only if bundle is enabled)
+    std::unique_ptr<Unbundler> unbundler_;
+
 };
 
 } /* namespace rpts */
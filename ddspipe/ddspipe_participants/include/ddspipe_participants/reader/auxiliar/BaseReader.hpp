@@ -23,6 +23,7 @@
 #include <ddspipe_core/interface/IReader.hpp>
 #include <ddspipe_core/interface/ITopic.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/metrics/EntityMetrics.hpp>
 
 #include <ddspipe_participants/library/library_dll.h>
 
@@ -208,6 +209,11 @@ protected:
      */
     virtual bool should_accept_sample_() noexcept;
 
+    //! Add \c value to the counter \c kind of the participant and topic metrics
+    void add_metric_(
+            const core::MetricKind kind,
+            const std::uint64_t value = 1) noexcept;
+
     /////////////////////////
     // INTERNAL VARIABLES
     /////////////////////////
@@ -242,6 +248,12 @@ protected:
     //! Minimum time [ns] between received samples required to be processed (0 <=> no restriction).
     std::chrono::nanoseconds min_intersample_period_ = std::chrono::nanoseconds(0);
 
+    //! Metrics of the participant (nullptr to not count the samples of this Reader)
+    std::shared_ptr<core::EntityMetrics> participant_metrics_;
+
+    //! Metrics of the topic (only set by the Readers that know their topic)
+    std::shared_ptr<core::EntityMetrics> topic_metrics_;
+
     //! Default callback. It shows a warning that callback is not set
     static const std::function<void()> DEFAULT_ON_DATA_AVAILABLE_CALLBACK;
 
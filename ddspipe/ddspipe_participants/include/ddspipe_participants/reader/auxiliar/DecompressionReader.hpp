@@ -0,0 +1,68 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DecompressionReader.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_participants/efficiency/compression/PayloadCompressor.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/DecoratorReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Reader that decompresses the payload of every sample taken from another Reader.
+ *
+ * Samples that were not compressed are returned as they are.
+ */
+class DecompressionReader : public DecoratorReader
+{
+public:
+
+    /**
+     * @brief Construct a new Decompression Reader object
+     *
+     * @param reader reader that receives the compressed samples
+     * @param compressor compressor of the parent participant
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DecompressionReader(
+            const std::shared_ptr<core::IReader>& reader,
+            const std::shared_ptr<PayloadCompressor>& compressor);
+
+    /**
+     * @brief Take the next sample of the internal reader and decompress its payload.
+     *
+     * Samples that cannot be decompressed are discarded.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take(
+            std::unique_ptr<core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    //! Compressor of the parent participant
+    std::shared_ptr<PayloadCompressor> compressor_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,101 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DecoratorReader.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Abstract Reader that forwards every method to another Reader.
+ *
+ * In order to inherit from this class, override \c take to transform the data taken from the internal Reader.
+ */
+class DecoratorReader : public core::IReader
+{
+public:
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void enable() noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void disable() noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void unset_on_data_available_callback() noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take(
+            std::unique_ptr<core::IRoutingData>& data) noexcept override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    core::types::Guid guid() const override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    uint64_t get_unread_count() const override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    core::types::DdsTopic topic() const override;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    core::types::ParticipantId participant_id() const override;
+
+protected:
+
+    /**
+     * @brief Construct a new Decorator Reader object
+     *
+     * @note Protected ctor to make class abstract (only built by their childs).
+     *
+     * @param reader reader whose methods are forwarded
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DecoratorReader(
+            const std::shared_ptr<core::IReader>& reader);
+
+    /**
+     * @brief Replace the payload of \c data by \c payload .
+     *
+     * Both payloads must belong to the DDS Pipe PayloadPool. \c payload is released afterwards.
+     */
+    static void replace_payload_(
+            core::types::RtpsPayloadData& data,
+            core::types::Payload& payload) noexcept;
+
+    //! Reader whose methods are forwarded
+    std::shared_ptr<core::IReader> reader_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
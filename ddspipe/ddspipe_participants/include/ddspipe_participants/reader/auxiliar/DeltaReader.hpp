@@ -0,0 +1,73 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeltaReader.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/efficiency/delta/DeltaDecoder.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/DecoratorReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Reader that rebuilds the full payload of every delta encoded sample taken from another Reader.
+ *
+ * Samples that were not delta encoded are returned as they are.
+ */
+class DeltaReader : public DecoratorReader
+{
+public:
+
+    /**
+     * @brief Construct a new Delta Reader object
+     *
+     * @param topic topic of the reader
+     * @param reader reader that receives the encoded samples
+     * @param payload_pool DDS Pipe shared PayloadPool
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DeltaReader(
+            const core::types::DdsTopic& topic,
+            const std::shared_ptr<core::IReader>& reader,
+            const std::shared_ptr<core::PayloadPool>& payload_pool);
+
+    /**
+     * @brief Take the next sample of the internal reader and rebuild its payload.
+     *
+     * Samples that cannot be rebuilt are discarded.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take(
+            std::unique_ptr<core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    //! Decoder of the samples of this reader
+    DeltaDecoder decoder_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
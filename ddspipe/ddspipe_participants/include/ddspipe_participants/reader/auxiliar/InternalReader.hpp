@@ -60,6 +60,10 @@ public:
     void simulate_data_reception(
             std::unique_ptr<core::IRoutingData>&& data) noexcept;
 
+    //! Number of data received (by simulation) that have not been taken yet
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::size_t pending_data() noexcept;
+
 protected:
 
     void enable_nts_() noexcept override;
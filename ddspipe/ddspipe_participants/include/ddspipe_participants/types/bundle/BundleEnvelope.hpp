@@ -0,0 +1,175 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+namespace types {
+
+/**
+ * Serialized collection of records sent as a single sample of the internal bundle topic.
+ *
+ * A record is either:
+ *  - a sample of a topic (topic id, source guid, sequence number, source timestamp, change kind, instance and
+ *    payload).
+ *  - an announcement of a topic (topic id, name, type name, main QoS and whether it is required), that tells the
+ *    remote proxy the id of the topic and, if required, makes it create the bridge for it.
+ *
+ * Topic ids are assigned by the sending proxy, so they are only meaningful together with the writer of the
+ * envelope. A topic is always announced before (or in the same envelope as) its first sample.
+ * Every field is serialized in little endian.
+ */
+class BundleEnvelope
+{
+public:
+
+    //! Callback called for each sample record found while parsing an envelope
+    using SampleCallback = std::function<void (std::uint32_t, std::unique_ptr<core::types::RtpsPayloadData>&&)>;
+
+    //! Callback called for each announcement record found while parsing an envelope (id, topic and required)
+    using AnnouncementCallback = std::function<void (std::uint32_t, const core::types::DdsTopic&, bool)>;
+
+    //! Name and type name of a topic, that identify it in both proxies
+    using TopicKey = std::pair<std::string, std::string>;
+
+    //! Create an empty envelope (only with header)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    BundleEnvelope();
+
+    //! Internal topic (RELIABLE and VOLATILE) that carries the envelopes
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static core::types::DdsTopic bundle_topic() noexcept;
+
+    //! Key of \c topic , to relate the ids announced with the local topics
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static TopicKey topic_key(
+            const core::types::DdsTopic& topic) noexcept;
+
+    //! Serialized size that \c data would take in an envelope
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static std::uint32_t sample_record_size(
+            const core::types::RtpsPayloadData& data) noexcept;
+
+    //! Serialized size that the announcement of \c topic would take in an envelope
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static std::uint32_t announcement_record_size(
+            const core::types::DdsTopic& topic) noexcept;
+
+    //! Append a sample record
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void add_sample(
+            const std::uint32_t topic_id,
+            const core::types::RtpsPayloadData& data);
+
+    //! Append an announcement record
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void add_announcement(
+            const std::uint32_t topic_id,
+            const core::types::DdsTopic& topic,
+            const bool required);
+
+    //! Whether the envelope has no records
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool empty() const noexcept;
+
+    //! Serialized size of the envelope (header included)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::uint32_t size() const noexcept;
+
+    //! Number of records in the envelope
+    DDSPIPE_PARTICIPANTS_DllAPI
+    unsigned int records() const noexcept;
+
+    //! Remove every record
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void clear() noexcept;
+
+    //! Serialized envelope
+    DDSPIPE_PARTICIPANTS_DllAPI
+    const std::vector<std::uint8_t>& buffer() const noexcept;
+
+    /**
+     * @brief Parse a serialized envelope calling the callbacks for each record.
+     *
+     * The payload of each sample is copied into a payload reserved in \c payload_pool .
+     *
+     * @return false if the envelope is malformed. The records parsed before the error are notified anyway.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static bool parse(
+            const core::types::Payload& envelope,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            const SampleCallback& on_sample,
+            const AnnouncementCallback& on_announcement) noexcept;
+
+    //! Name of the internal topic that carries the envelopes
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static const char* TOPIC_NAME;
+
+    //! Type name of the internal topic that carries the envelopes
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static const char* TYPE_NAME;
+
+    //! Default maximum size of an envelope [bytes]
+    static constexpr const std::uint32_t DEFAULT_MAX_SIZE = 8192;
+
+protected:
+
+    //! Kinds of records
+    enum RecordKind : std::uint8_t
+    {
+        sample_record = 0,
+        announcement_record = 1,
+    };
+
+    void write_u8_(
+            const std::uint8_t value);
+
+    void write_u16_(
+            const std::uint16_t value);
+
+    void write_u32_(
+            const std::uint32_t value);
+
+    void write_bytes_(
+            const std::uint8_t* data,
+            const std::uint32_t size);
+
+    //! Serialized envelope
+    std::vector<std::uint8_t> buffer_;
+
+    //! Number of records serialized
+    unsigned int records_;
+};
+
+} /* namespace types */
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
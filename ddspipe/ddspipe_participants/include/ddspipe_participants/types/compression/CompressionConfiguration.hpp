@@ -0,0 +1,87 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+namespace types {
+
+/**
+ * @brief Enumeration of codecs available to compress the payloads.
+ */
+ENUMERATION_BUILDER(
+    CompressionKind,
+    none,
+    zlib
+    );
+
+/**
+ * Configuration of the payload compression applied between two proxies.
+ *
+ * Both proxies must configure the same codec: payloads are compressed by the writers of the participant and
+ * decompressed by its readers.
+ */
+struct CompressionConfiguration : public core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    CompressionConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    //! Whether a codec is configured
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool is_active() const noexcept;
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Codec used to compress the payloads
+    CompressionKind kind {CompressionKind::none};
+
+    //! Payloads smaller than this size [bytes] are sent uncompressed
+    std::uint32_t threshold {256};
+
+    //! Compression level of the codec (from 1, fastest, to 9, smallest)
+    unsigned int level {6};
+
+    //! Compressed payloads received that would take more than this size [bytes] once decompressed are discarded
+    std::uint32_t max_payload_size {64 * 1024 * 1024};
+};
+
+} /* namespace types */
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
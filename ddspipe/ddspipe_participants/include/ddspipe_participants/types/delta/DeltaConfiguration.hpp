@@ -0,0 +1,66 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+namespace types {
+
+/**
+ * Configuration of the delta encoding of keyed topics applied between two proxies.
+ *
+ * Both proxies must enable it: the writers of the participant send each instance as a delta against its
+ * previous sample, and its readers reconstruct the full payloads.
+ */
+struct DeltaConfiguration : public core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DeltaConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether keyed topics are delta encoded
+    bool enabled {false};
+
+    //! Number of samples of an instance between two full payloads (keyframes)
+    std::uint32_t keyframe_interval {20};
+};
+
+} /* namespace types */
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
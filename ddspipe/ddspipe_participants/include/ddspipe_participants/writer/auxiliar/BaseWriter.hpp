@@ -24,6 +24,7 @@
 #include <ddspipe_core/interface/ITopic.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/metrics/EntityMetrics.hpp>
 
 #include <ddspipe_participants/library/library_dll.h>
 
@@ -138,6 +139,15 @@ protected:
      */
     bool should_send_sample_() noexcept;
 
+    //! Add \c value to the counter \c kind of the participant and topic metrics
+    void add_metric_(
+            const core::MetricKind kind,
+            const std::uint64_t value = 1) noexcept;
+
+    //! Count a sample written and its latency since it was received
+    void add_written_metrics_(
+            const core::IRoutingData& data) noexcept;
+
     /////////////////////////
     // INTERNAL VARIABLES
     /////////////////////////
@@ -160,6 +170,12 @@ protected:
     //! Minimum time [ns] between sent samples required to be processed (0 <=> no restriction).
     std::chrono::nanoseconds min_intersample_period_ = std::chrono::nanoseconds(0);
 
+    //! Metrics of the participant (nullptr to not count the samples of this Writer)
+    std::shared_ptr<core::EntityMetrics> participant_metrics_;
+
+    //! Metrics of the topic (only set by the Writers that know their topic)
+    std::shared_ptr<core::EntityMetrics> topic_metrics_;
+
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
             std::ostream&,
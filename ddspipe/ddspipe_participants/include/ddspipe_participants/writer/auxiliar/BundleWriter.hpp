@@ -0,0 +1,75 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BundleWriter.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/efficiency/bundle/Bundler.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Writer that adds every sample to the envelopes of a \c Bundler instead of writing it in its own topic.
+ */
+class BundleWriter : public BaseWriter
+{
+public:
+
+    /**
+     * @brief Construct a new Bundle Writer object
+     *
+     * @param participant_id parent participant id
+     * @param topic topic that this Writer refers to
+     * @param bundler bundler of the parent participant
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    BundleWriter(
+            const core::types::ParticipantId& participant_id,
+            const core::types::DdsTopic& topic,
+            const std::shared_ptr<Bundler>& bundler);
+
+protected:
+
+    /**
+     * @brief Write specific method
+     *
+     * @param data : data to add to the current envelope
+     * @return RETCODE_OK if the data has been bundled
+     */
+    utils::ReturnCode write_nts_(
+            core::IRoutingData& data) noexcept override;
+
+    //! Bundler of the parent participant
+    std::shared_ptr<Bundler> bundler_;
+
+    //! Id of the topic inside the envelopes
+    const std::uint32_t topic_id_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
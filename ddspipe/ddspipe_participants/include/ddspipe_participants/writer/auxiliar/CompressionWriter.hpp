@@ -0,0 +1,77 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CompressionWriter.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddspipe_participants/efficiency/compression/PayloadCompressor.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/writer/auxiliar/DecoratorWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Writer that compresses the payload of every sample before writing it with another Writer.
+ *
+ */
+class CompressionWriter : public DecoratorWriter
+{
+public:
+
+    /**
+     * @brief Construct a new Compression Writer object
+     *
+     * @param participant_id parent participant id
+     * @param writer writer that sends the compressed samples
+     * @param compressor compressor of the parent participant
+     * @param payload_pool DDS Pipe shared PayloadPool
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    CompressionWriter(
+            const core::types::ParticipantId& participant_id,
+            const std::shared_ptr<core::IWriter>& writer,
+            const std::shared_ptr<PayloadCompressor>& compressor,
+            const std::shared_ptr<core::PayloadPool>& payload_pool);
+
+protected:
+
+    /**
+     * @brief Write specific method
+     *
+     * @param data : data to compress and write
+     * @return return code of the internal writer
+     */
+    utils::ReturnCode write_nts_(
+            core::IRoutingData& data) noexcept override;
+
+    //! Compressor of the parent participant
+    std::shared_ptr<PayloadCompressor> compressor_;
+
+    //! DDS Pipe shared PayloadPool
+    std::shared_ptr<core::PayloadPool> payload_pool_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
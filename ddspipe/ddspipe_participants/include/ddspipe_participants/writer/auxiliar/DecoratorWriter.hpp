@@ -0,0 +1,78 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DecoratorWriter.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Abstract Writer that transforms the data before writing it with another Writer.
+ *
+ * In order to inherit from this class, implement the protected method \c write_nts_ .
+ * The data received must not be modified, as it is shared with the rest of Writers of the Track.
+ */
+class DecoratorWriter : public BaseWriter
+{
+public:
+
+    //! Whether the internal writer can accept a new message
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool can_accept() const noexcept override;
+
+protected:
+
+    /**
+     * @brief Construct a new Decorator Writer object
+     *
+     * @param participant_id parent participant id
+     * @param writer writer that sends the transformed data
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DecoratorWriter(
+            const core::types::ParticipantId& participant_id,
+            const std::shared_ptr<core::IWriter>& writer);
+
+    //! Enable the internal writer
+    void enable_() noexcept override;
+
+    //! Disable the internal writer
+    void disable_() noexcept override;
+
+    //! Copy every property of \c src but its payload into \c dst
+    static void copy_properties_(
+            const core::types::RtpsPayloadData& src,
+            core::types::RtpsPayloadData& dst) noexcept;
+
+    //! Writer that sends the transformed data
+    std::shared_ptr<core::IWriter> writer_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,80 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeltaWriter.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/efficiency/delta/DeltaEncoder.hpp>
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/writer/auxiliar/DecoratorWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Writer that sends every sample as a delta against the previous sample of its instance, using another Writer.
+ */
+class DeltaWriter : public DecoratorWriter
+{
+public:
+
+    /**
+     * @brief Construct a new Delta Writer object
+     *
+     * @param participant_id parent participant id
+     * @param topic topic of the writer
+     * @param writer writer that sends the encoded samples
+     * @param payload_pool DDS Pipe shared PayloadPool
+     * @param keyframe_interval number of samples of an instance between two keyframes
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    DeltaWriter(
+            const core::types::ParticipantId& participant_id,
+            const core::types::DdsTopic& topic,
+            const std::shared_ptr<core::IWriter>& writer,
+            const std::shared_ptr<core::PayloadPool>& payload_pool,
+            const std::uint32_t keyframe_interval);
+
+protected:
+
+    /**
+     * @brief Write specific method
+     *
+     * @param data : data to encode and write
+     * @return return code of the internal writer
+     */
+    utils::ReturnCode write_nts_(
+            core::IRoutingData& data) noexcept override;
+
+    //! Encoder of the samples of this writer
+    DeltaEncoder encoder_;
+
+    //! DDS Pipe shared PayloadPool
+    std::shared_ptr<core::PayloadPool> payload_pool_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
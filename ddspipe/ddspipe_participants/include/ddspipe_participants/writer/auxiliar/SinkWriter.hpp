@@ -0,0 +1,156 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+//! Reception statistics of the samples of a source writer
+struct SinkSourceStatistics
+{
+    //! Samples received (duplicates included)
+    std::uint64_t samples {0};
+
+    //! Sequence numbers skipped that have not arrived (yet)
+    std::uint64_t lost {0};
+
+    //! Samples received more than once
+    std::uint64_t duplicates {0};
+
+    //! Samples received after a greater sequence number of the same source
+    std::uint64_t out_of_order {0};
+};
+
+//! Reception statistics of the samples of a topic
+struct SinkStatistics : public SinkSourceStatistics
+{
+    //! Bytes of payload received
+    std::uint64_t bytes {0};
+
+    //! Time [s] between the first and the last sample received
+    double duration {0};
+
+    //! Time from the source timestamp to the reception of each sample
+    core::LatencyDistributionSnapshot latency {};
+
+    //! Statistics of every source writer
+    std::map<core::types::Guid, SinkSourceStatistics> sources {};
+};
+
+/**
+ * Writer Implementation that drops every message that is required to write, keeping reception statistics.
+ *
+ * It counts the samples and bytes of the topic, and detects the sequence numbers skipped (lost), repeated
+ * (duplicates) and received late (out of order) for every source writer, with a sliding window of the last
+ * \c SEQUENCE_WINDOW sequence numbers. A sample older than the window is counted as out of order.
+ *
+ * The latency is the time from the source timestamp of a sample to its reception, so it is only meaningful when
+ * the source and the sink clocks are synchronized (e.g. data generated in the same process).
+ */
+class SinkWriter : public BlankWriter
+{
+public:
+
+    /**
+     * @brief Construct a new Sink Writer
+     *
+     * @param topic : topic that this Writer refers to.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    SinkWriter(
+            const core::types::DdsTopic& topic);
+
+    //! Statistics of the samples received so far
+    DDSPIPE_PARTICIPANTS_DllAPI
+    SinkStatistics statistics() const noexcept;
+
+    //! Topic that this Writer refers to
+    DDSPIPE_PARTICIPANTS_DllAPI
+    const core::types::DdsTopic& topic() const noexcept;
+
+    //! Number of sequence numbers remembered per source writer
+    static constexpr const std::uint64_t SEQUENCE_WINDOW = 64;
+
+protected:
+
+    //! Sequence numbers received from a source writer
+    struct SourceState
+    {
+        //! Reception statistics of the source
+        SinkSourceStatistics statistics;
+
+        //! Highest sequence number received
+        std::uint64_t highest {0};
+
+        //! Bit i set if sequence number \c highest - i has been received
+        std::uint64_t window {0};
+    };
+
+    /**
+     * @brief Register the reception of the sample and drop it.
+     *
+     * @param data : data to register
+     * @return RETCODE_OK always
+     */
+    virtual utils::ReturnCode write(
+            core::IRoutingData& data) noexcept override;
+
+    //! Update the statistics of \c source with the reception of \c sequence_number
+    static void register_sequence_number_(
+            SourceState& source,
+            const std::uint64_t sequence_number) noexcept;
+
+    //! Topic that this Writer refers to
+    const core::types::DdsTopic topic_;
+
+    //! Samples received from each source writer
+    std::map<core::types::Guid, SourceState> sources_;
+
+    //! Samples received
+    std::uint64_t samples_;
+
+    //! Bytes of payload received
+    std::uint64_t bytes_;
+
+    //! Reception time of the first sample
+    std::chrono::steady_clock::time_point first_reception_;
+
+    //! Reception time of the last sample
+    std::chrono::steady_clock::time_point last_reception_;
+
+    //! Time from the source timestamp to the reception of each sample
+    core::LatencyHistogram latency_;
+
+    //! Mutex to protect the statistics
+    mutable std::mutex mutex_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -91,6 +91,14 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     void init();
 
+    /**
+     * @brief Whether a new change can be added without evicting a change not yet acknowledged by every Reader.
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool can_accept() const noexcept override;
+
     /////////////////////////
     // RTPS LISTENER METHODS
     /////////////////////////
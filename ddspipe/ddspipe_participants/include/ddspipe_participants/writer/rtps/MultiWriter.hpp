@@ -69,6 +69,10 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual ~MultiWriter();
 
+    //! Whether every internal writer can accept a new message
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool can_accept() const noexcept override;
+
 protected:
 
     //! Override specific enable to call enable in internal writers.
@@ -95,7 +99,7 @@ protected:
 
     using WritersMapType = utils::SharedAtomicable<std::map<core::types::SpecificEndpointQoS, QoSSpecificWriter*>>;
     //! Map of writer indexed by Specific QoS of each.
-    WritersMapType writers_map_;
+    mutable WritersMapType writers_map_;
 
     const std::shared_ptr<core::PayloadPool>& payload_pool_;
 
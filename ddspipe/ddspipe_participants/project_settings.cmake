@@ -29,11 +29,17 @@ set(MODULE_FIND_PACKAGES
     fastrtps
     cpp_utils
     ddspipe_core
+    ZLIB
 )
 
 set(fastrtps_MINIMUM_VERSION "2.8")
 
+# ZLIB package does not export a target with its own name, so its imported target is linked instead
 set(MODULE_DEPENDENCIES
     $<$<BOOL:${WIN32}>:iphlpapi$<SEMICOLON>Shlwapi>
-    ${MODULE_FIND_PACKAGES}
+    fastcdr
+    fastrtps
+    cpp_utils
+    ddspipe_core
+    $<BUILD_INTERFACE:ZLIB::ZLIB>
 )
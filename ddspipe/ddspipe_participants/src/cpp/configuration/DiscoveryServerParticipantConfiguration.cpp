@@ -67,6 +67,18 @@ bool DiscoveryServerParticipantConfiguration::is_valid(
         return false;
     }
 
+    // Check compression configuration
+    if (!compression.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    // Check delta configuration
+    if (!delta.is_valid(error_msg))
+    {
+        return false;
+    }
+
     // If active, check it is valid
     if (tls_configuration.is_active())
     {
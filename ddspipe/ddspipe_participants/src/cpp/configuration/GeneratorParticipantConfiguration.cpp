@@ -0,0 +1,65 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+bool GeneratorParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (topic_prefix.empty())
+    {
+        error_msg << "The prefix of the generated topics can not be empty. ";
+        return false;
+    }
+
+    if (topics == 0)
+    {
+        error_msg << "The generator must generate at least one topic. ";
+        return false;
+    }
+
+    if (!(rate > 0))
+    {
+        error_msg << "Incorrect generation rate " << rate << ", it must be positive. ";
+        return false;
+    }
+
+    if (payload_size == 0)
+    {
+        error_msg << "The size of the generated payloads must be positive. ";
+        return false;
+    }
+
+    if (size_distribution != PayloadSizeDistribution::fixed && max_payload_size < payload_size)
+    {
+        error_msg << "The maximum payload size " << max_payload_size << " is smaller than the payload size " <<
+            payload_size << ". ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -59,6 +59,25 @@ bool InitialPeersParticipantConfiguration::is_valid(
         return false;
     }
 
+    // Check bundle envelopes can hold samples
+    if (bundle && bundle_max_size == 0)
+    {
+        error_msg << "Bundle max size must be greater than 0. ";
+        return false;
+    }
+
+    // Check compression configuration
+    if (!compression.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    // Check delta configuration
+    if (!delta.is_valid(error_msg))
+    {
+        return false;
+    }
+
     // If active, check it is valid
     if (tls_configuration.is_active())
     {
@@ -0,0 +1,289 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/efficiency/bundle/Bundler.hpp>
+#include <ddspipe_participants/writer/rtps/SimpleWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+Bundler::Bundler(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        fastrtps::rtps::RTPSParticipant* rtps_participant,
+        const std::uint32_t max_size,
+        const utils::Duration_ms max_delay)
+    : participant_id_(participant_id)
+    , payload_pool_(payload_pool)
+    , rtps_participant_(rtps_participant)
+    , max_size_(max_size)
+    , max_delay_(max_delay)
+    , next_topic_id_(0)
+    , samples_bundled_(0)
+    , envelopes_sent_(0)
+    , stop_(false)
+{
+    // Do nothing
+}
+
+Bundler::~Bundler()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+
+        // Do not lose the samples waiting in the current envelope
+        flush_nts_();
+    }
+    cv_.notify_all();
+
+    if (flush_thread_.joinable())
+    {
+        flush_thread_.join();
+    }
+
+    logInfo(DDSPIPE_BUNDLE,
+            "Bundler of Participant " << participant_id_ << " sent " << samples_bundled_ << " samples in " <<
+            envelopes_sent_ << " envelopes.");
+}
+
+void Bundler::init()
+{
+    auto writer = std::make_shared<rtps::SimpleWriter>(
+        participant_id_,
+        types::BundleEnvelope::bundle_topic(),
+        payload_pool_,
+        rtps_participant_);
+    writer->init();
+    writer->enable();
+
+    writer_ = writer;
+
+    flush_thread_ = std::thread(&Bundler::flush_routine_, this);
+}
+
+utils::ReturnCode Bundler::add_sample(
+        const std::uint32_t topic_id,
+        const RtpsPayloadData& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Send the current envelope if this sample does not fit in it
+    if (!envelope_.empty() && envelope_.size() + types::BundleEnvelope::sample_record_size(data) > max_size_)
+    {
+        flush_nts_();
+    }
+
+    if (envelope_.empty())
+    {
+        // A new envelope starts, so its deadline must be awaited
+        envelope_start_ = std::chrono::steady_clock::now();
+        cv_.notify_all();
+    }
+
+    envelope_.add_sample(topic_id, data);
+    samples_bundled_++;
+
+    // A sample bigger than the envelope is sent alone
+    if (envelope_.size() >= max_size_)
+    {
+        flush_nts_();
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+std::uint32_t Bundler::topic_id(
+        const DdsTopic& topic) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return register_topic_nts_(topic, nullptr);
+}
+
+void Bundler::announce(
+        const DdsTopic& topic,
+        const std::shared_ptr<core::IReader>& reader) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    register_topic_nts_(topic, reader);
+}
+
+std::uint64_t Bundler::samples_bundled() const noexcept
+{
+    return samples_bundled_.load();
+}
+
+std::uint64_t Bundler::envelopes_sent() const noexcept
+{
+    return envelopes_sent_.load();
+}
+
+std::uint32_t Bundler::register_topic_nts_(
+        const DdsTopic& topic,
+        const std::shared_ptr<core::IReader>& reader) noexcept
+{
+    auto id_it = topic_ids_.find(types::BundleEnvelope::topic_key(topic));
+    if (id_it != topic_ids_.end())
+    {
+        AnnouncedTopic& announced = announced_topics_[id_it->second];
+        if (reader)
+        {
+            announced.reader = reader;
+
+            if (!announced.required)
+            {
+                // Already announced, but not as required
+                announced.required = true;
+                add_announcement_nts_(id_it->second, announced);
+            }
+        }
+        return id_it->second;
+    }
+
+    // Ids are only unique in this Bundler, so they cannot collide as the hashes of the topics did
+    const std::uint32_t topic_id = next_topic_id_++;
+    topic_ids_.emplace(types::BundleEnvelope::topic_key(topic), topic_id);
+    const AnnouncedTopic& announced =
+            announced_topics_.emplace(topic_id, AnnouncedTopic{topic, reader, reader != nullptr}).first->second;
+
+    logDebug(DDSPIPE_BUNDLE, "Announcing topic " << topic << " with bundle id " << topic_id << ".");
+
+    add_announcement_nts_(topic_id, announced);
+
+    return topic_id;
+}
+
+void Bundler::add_announcement_nts_(
+        const std::uint32_t topic_id,
+        const AnnouncedTopic& announced) noexcept
+{
+    // Send the current envelope if this announcement does not fit in it
+    if (!envelope_.empty() &&
+            envelope_.size() + types::BundleEnvelope::announcement_record_size(announced.topic) > max_size_)
+    {
+        flush_nts_();
+    }
+
+    if (envelope_.empty())
+    {
+        envelope_start_ = std::chrono::steady_clock::now();
+        cv_.notify_all();
+    }
+
+    envelope_.add_announcement(topic_id, announced.topic, announced.required);
+
+    if (envelope_.size() >= max_size_)
+    {
+        flush_nts_();
+    }
+}
+
+void Bundler::flush_nts_() noexcept
+{
+    if (envelope_.empty() || !writer_)
+    {
+        return;
+    }
+
+    const std::vector<std::uint8_t>& buffer = envelope_.buffer();
+
+    RtpsPayloadData data;
+    if (!payload_pool_->get_payload(static_cast<std::uint32_t>(buffer.size()), data.payload))
+    {
+        logDevError(DDSPIPE_BUNDLE, "Error getting Payload for bundle envelope.");
+        envelope_.clear();
+        return;
+    }
+    data.payload_owner = payload_pool_.get();
+
+    std::memcpy(data.payload.data, buffer.data(), buffer.size());
+    data.payload.length = static_cast<std::uint32_t>(buffer.size());
+    data.kind = ChangeKind::ALIVE;
+    DataTime::now(data.source_timestamp);
+
+    logDebug(DDSPIPE_BUNDLE,
+            "Bundler of Participant " << participant_id_ << " sending envelope with " << envelope_.records() <<
+            " records and " << buffer.size() << " bytes.");
+
+    utils::ReturnCode ret = writer_->write(data);
+    if (!ret)
+    {
+        logWarning(DDSPIPE_BUNDLE,
+                "Error sending bundle envelope in Participant " << participant_id_ << ". Error code " << ret << ".");
+    }
+    else
+    {
+        envelopes_sent_++;
+    }
+
+    envelope_.clear();
+}
+
+void Bundler::flush_routine_() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto next_announcement = std::chrono::steady_clock::now() + std::chrono::milliseconds(ANNOUNCEMENT_PERIOD);
+
+    while (!stop_)
+    {
+        // Wait till the deadline of the current envelope or the next announcement
+        auto wake_up = next_announcement;
+        if (!envelope_.empty())
+        {
+            wake_up = std::min(wake_up, envelope_start_ + max_delay_);
+        }
+
+        cv_.wait_until(lock, wake_up);
+
+        if (stop_)
+        {
+            break;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+
+        if (now >= next_announcement)
+        {
+            // Announce again every topic, so a remote proxy that has joined later knows them
+            for (auto& topic_it : announced_topics_)
+            {
+                if (topic_it.second.required && topic_it.second.reader.expired())
+                {
+                    // The reader is gone, so the remote proxy can remove the bridge that writes in it
+                    logDebug(DDSPIPE_BUNDLE, "Topic " << topic_it.second.topic << " no longer required.");
+                    topic_it.second.required = false;
+                }
+                add_announcement_nts_(topic_it.first, topic_it.second);
+            }
+            next_announcement = now + std::chrono::milliseconds(ANNOUNCEMENT_PERIOD);
+        }
+
+        if (!envelope_.empty() && now >= envelope_start_ + max_delay_)
+        {
+            flush_nts_();
+        }
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
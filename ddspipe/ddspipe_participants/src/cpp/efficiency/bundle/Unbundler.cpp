@@ -0,0 +1,360 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/efficiency/bundle/Bundler.hpp>
+#include <ddspipe_participants/efficiency/bundle/Unbundler.hpp>
+#include <ddspipe_participants/reader/rtps/SimpleReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+Unbundler::Unbundler(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<PayloadPool>& payload_pool,
+        fastrtps::rtps::RTPSParticipant* rtps_participant,
+        const AnnouncementCallback& on_announcement,
+        const AnnouncementCallback& on_withdrawal)
+    : participant_id_(participant_id)
+    , payload_pool_(payload_pool)
+    , rtps_participant_(rtps_participant)
+    , on_announcement_callback_(on_announcement)
+    , on_withdrawal_callback_(on_withdrawal)
+    , envelopes_received_(0)
+    , samples_unbundled_(0)
+    , data_available_(false)
+    , stop_(false)
+{
+    // Do nothing
+}
+
+Unbundler::~Unbundler()
+{
+    if (reader_)
+    {
+        reader_->disable();
+        reader_->unset_on_data_available_callback();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        stop_ = true;
+    }
+    dispatch_cv_.notify_all();
+
+    if (dispatch_thread_.joinable())
+    {
+        dispatch_thread_.join();
+    }
+
+    logInfo(DDSPIPE_BUNDLE,
+            "Unbundler of Participant " << participant_id_ << " received " << envelopes_received_ <<
+            " envelopes with " << samples_unbundled_ << " samples.");
+}
+
+void Unbundler::init()
+{
+    auto reader = std::make_shared<rtps::SimpleReader>(
+        participant_id_,
+        types::BundleEnvelope::bundle_topic(),
+        payload_pool_,
+        rtps_participant_);
+    reader->init();
+
+    // The listener only awakes the dispatch thread, so no RTPS mutex is held while parsing
+    reader->set_on_data_available_callback(
+        [this]()
+        {
+            {
+                std::lock_guard<std::mutex> lock(dispatch_mutex_);
+                data_available_ = true;
+            }
+            dispatch_cv_.notify_one();
+        });
+
+    reader_ = reader;
+
+    dispatch_thread_ = std::thread(&Unbundler::dispatch_routine_, this);
+
+    reader_->enable();
+}
+
+std::shared_ptr<InternalReader> Unbundler::create_reader(
+        const DdsTopic& topic)
+{
+    auto reader = std::make_shared<InternalReader>(participant_id_);
+
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    readers_[types::BundleEnvelope::topic_key(topic)] = reader;
+
+    return reader;
+}
+
+std::uint64_t Unbundler::envelopes_received() const noexcept
+{
+    return envelopes_received_.load();
+}
+
+std::uint64_t Unbundler::samples_unbundled() const noexcept
+{
+    return samples_unbundled_.load();
+}
+
+void Unbundler::dispatch_routine_() noexcept
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(dispatch_mutex_);
+            dispatch_cv_.wait_for(
+                lock,
+                std::chrono::milliseconds(Bundler::ANNOUNCEMENT_PERIOD),
+                [this]()
+                {
+                    return data_available_ || stop_;
+                });
+
+            if (stop_)
+            {
+                return;
+            }
+
+            data_available_ = false;
+        }
+
+        expire_remote_bundlers_();
+
+        // Take every envelope received so far
+        std::unique_ptr<IRoutingData> data;
+        while (reader_->take(data) == utils::ReturnCode::RETCODE_OK)
+        {
+            auto& envelope = dynamic_cast<RtpsPayloadData&>(*data);
+
+            if (envelope.kind != ChangeKind::ALIVE)
+            {
+                continue;
+            }
+
+            envelopes_received_++;
+
+            // Topic ids are assigned by the Bundler that sends the envelope
+            const Guid source = envelope.source_guid;
+
+            {
+                std::lock_guard<std::mutex> lock(readers_mutex_);
+                remote_bundlers_[source].last_seen = std::chrono::steady_clock::now();
+            }
+
+            bool correct = types::BundleEnvelope::parse(
+                envelope.payload,
+                payload_pool_,
+                [this, &source](std::uint32_t topic_id, std::unique_ptr<RtpsPayloadData>&& sample)
+                {
+                    on_sample_(source, topic_id, std::move(sample));
+                },
+                [this, &source](std::uint32_t topic_id, const DdsTopic& topic, bool required)
+                {
+                    on_announcement_(source, topic_id, topic, required);
+                });
+
+            if (!correct)
+            {
+                logWarning(DDSPIPE_BUNDLE,
+                        "Malformed bundle envelope received in Participant " << participant_id_ << ".");
+            }
+        }
+    }
+}
+
+void Unbundler::on_sample_(
+        const Guid& source,
+        const std::uint32_t topic_id,
+        std::unique_ptr<RtpsPayloadData>&& data) noexcept
+{
+    std::shared_ptr<InternalReader> reader;
+    {
+        std::lock_guard<std::mutex> lock(readers_mutex_);
+
+        auto source_it = remote_bundlers_.find(source);
+        if (source_it != remote_bundlers_.end())
+        {
+            auto key_it = source_it->second.topic_ids.find(topic_id);
+            if (key_it != source_it->second.topic_ids.end())
+            {
+                auto it = readers_.find(key_it->second);
+                if (it != readers_.end())
+                {
+                    reader = it->second.lock();
+                }
+            }
+        }
+    }
+
+    if (!reader)
+    {
+        // The topic is not (or no longer) forwarded by this proxy
+        logDebug(DDSPIPE_BUNDLE,
+                "Dropping bundled sample of unknown topic id " << topic_id << " in Participant " << participant_id_ <<
+                ".");
+        return;
+    }
+
+    data->participant_receiver = participant_id_;
+    samples_unbundled_++;
+
+    reader->simulate_data_reception(std::move(data));
+}
+
+void Unbundler::on_announcement_(
+        const Guid& source,
+        const std::uint32_t topic_id,
+        const DdsTopic& topic,
+        const bool required) noexcept
+{
+    const types::BundleEnvelope::TopicKey key = types::BundleEnvelope::topic_key(topic);
+
+    {
+        std::lock_guard<std::mutex> lock(readers_mutex_);
+
+        RemoteBundler& remote = remote_bundlers_[source];
+
+        auto id_it = remote.topic_ids.find(topic_id);
+        if (id_it == remote.topic_ids.end())
+        {
+            remote.topic_ids.emplace(topic_id, key);
+        }
+        else if (id_it->second != key)
+        {
+            // Every Bundler assigns different ids to different topics, so this is a malformed announcement
+            logWarning(DDSPIPE_BUNDLE,
+                    "Bundle id " << topic_id << " of topic " << topic << " already used by topic " <<
+                    id_it->second.first << " in envelopes from " << source << ". Ignoring the announcement.");
+            return;
+        }
+
+        auto required_it = remote.required_topics.find(key);
+        if (required)
+        {
+            const auto now = std::chrono::steady_clock::now();
+
+            if (required_it != remote.required_topics.end())
+            {
+                // Periodic announcement of a known topic
+                required_it->second.second = now;
+                return;
+            }
+
+            remote.required_topics.emplace(key, std::make_pair(topic, now));
+        }
+        else
+        {
+            if (required_it == remote.required_topics.end())
+            {
+                // Not required, and it was not before either
+                return;
+            }
+
+            remote.required_topics.erase(required_it);
+        }
+    }
+
+    if (required)
+    {
+        logDebug(DDSPIPE_BUNDLE,
+                "Topic " << topic << " required by " << source << " in Participant " << participant_id_ << ".");
+
+        if (on_announcement_callback_)
+        {
+            on_announcement_callback_(source, topic);
+        }
+    }
+    else
+    {
+        logDebug(DDSPIPE_BUNDLE,
+                "Topic " << topic << " no longer required by " << source << " in Participant " << participant_id_ <<
+                ".");
+
+        if (on_withdrawal_callback_)
+        {
+            on_withdrawal_callback_(source, topic);
+        }
+    }
+}
+
+void Unbundler::expire_remote_bundlers_() noexcept
+{
+    std::vector<std::pair<Guid, DdsTopic>> withdrawn;
+
+    {
+        std::lock_guard<std::mutex> lock(readers_mutex_);
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto timeout = std::chrono::milliseconds(ANNOUNCEMENT_TIMEOUT);
+
+        for (auto remote_it = remote_bundlers_.begin(); remote_it != remote_bundlers_.end();)
+        {
+            RemoteBundler& remote = remote_it->second;
+            const bool gone = now - remote.last_seen > timeout;
+
+            for (auto topic_it = remote.required_topics.begin(); topic_it != remote.required_topics.end();)
+            {
+                if (gone || now - topic_it->second.second > timeout)
+                {
+                    withdrawn.emplace_back(remote_it->first, topic_it->second.first);
+                    topic_it = remote.required_topics.erase(topic_it);
+                }
+                else
+                {
+                    ++topic_it;
+                }
+            }
+
+            if (gone)
+            {
+                // The remote bundle writer has left, so its ids are no longer valid
+                logDebug(DDSPIPE_BUNDLE, "Forgetting bundle writer " << remote_it->first << ".");
+                remote_it = remote_bundlers_.erase(remote_it);
+            }
+            else
+            {
+                ++remote_it;
+            }
+        }
+    }
+
+    for (const auto& topic : withdrawn)
+    {
+        logDebug(DDSPIPE_BUNDLE,
+                "Topic " << topic.second << " not announced by " << topic.first << " for " << ANNOUNCEMENT_TIMEOUT <<
+                " ms in Participant " << participant_id_ << ".");
+
+        if (on_withdrawal_callback_)
+        {
+            on_withdrawal_callback_(topic.first, topic.second);
+        }
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,275 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
+
+#include <ddspipe_participants/efficiency/compression/PayloadCompressor.hpp>
+#include <ddspipe_participants/efficiency/compression/ZlibCodec.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+namespace {
+
+//! Magic at the beginning of every compressed payload (first byte is never 0, unlike CDR encapsulations)
+constexpr const std::uint8_t COMPRESSED_MAGIC[] = {'D', 'P', 'Z'};
+
+//! Nanoseconds elapsed since \c start
+std::uint64_t elapsed_ns(
+        const std::chrono::steady_clock::time_point& start)
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+} /* namespace */
+
+PayloadCompressor::PayloadCompressor(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        const std::shared_ptr<IPayloadCodec>& codec,
+        const std::uint32_t threshold,
+        const std::uint32_t max_payload_size)
+    : participant_id_(participant_id)
+    , payload_pool_(payload_pool)
+    , codec_(codec)
+    , threshold_(threshold)
+    , max_payload_size_(max_payload_size)
+    , participant_metrics_(core::ProcessMetricsRegistry::get_instance()->participant_metrics(participant_id))
+    , payloads_compressed_(0)
+    , payloads_skipped_(0)
+    , payloads_decompressed_(0)
+    , bytes_in_(0)
+    , bytes_out_(0)
+    , compression_time_(0)
+    , decompression_time_(0)
+{
+    logDebug(DDSPIPE_COMPRESSION,
+            "Creating PayloadCompressor in Participant " << participant_id_ << " with codec " <<
+            static_cast<unsigned int>(codec_->id()) << " and threshold " << threshold_ << " bytes.");
+}
+
+PayloadCompressor::~PayloadCompressor()
+{
+    logInfo(DDSPIPE_COMPRESSION,
+            "Participant " << participant_id_ << " compressed " << payloads_compressed_ << " payloads " <<
+            "(ratio " << compression_ratio() << ", " << compression_time_ / 1000 << " us), skipped " <<
+            payloads_skipped_ << " payloads and decompressed " << payloads_decompressed_ << " payloads (" <<
+            decompression_time_ / 1000 << " us).");
+}
+
+std::shared_ptr<PayloadCompressor> PayloadCompressor::create(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        const types::CompressionConfiguration& configuration)
+{
+    std::shared_ptr<IPayloadCodec> codec;
+
+    switch (configuration.kind)
+    {
+        case types::CompressionKind::zlib:
+            codec = std::make_shared<ZlibCodec>(configuration.level);
+            break;
+
+        default:
+            return nullptr;
+    }
+
+    return std::make_shared<PayloadCompressor>(
+        participant_id,
+        payload_pool,
+        codec,
+        configuration.threshold,
+        configuration.max_payload_size);
+}
+
+bool PayloadCompressor::compress(
+        const Payload& payload,
+        Payload& compressed) noexcept
+{
+    if (payload.length == 0 || payload.length < threshold_)
+    {
+        payloads_skipped_++;
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const std::uint32_t max_size = HEADER_SIZE + codec_->max_compressed_size(payload.length);
+
+    if (!payload_pool_->get_payload(max_size, compressed))
+    {
+        logDevError(DDSPIPE_COMPRESSION, "Error getting Payload to compress.");
+        payloads_skipped_++;
+        return false;
+    }
+
+    std::uint32_t compressed_size = max_size - HEADER_SIZE;
+    const bool ok = codec_->compress(payload.data, payload.length, compressed.data + HEADER_SIZE, compressed_size);
+
+    if (!ok || HEADER_SIZE + compressed_size >= payload.length)
+    {
+        // Not worth it, send the original payload
+        payload_pool_->release_payload(compressed);
+        const std::uint64_t time = elapsed_ns(start);
+        compression_time_ += time;
+        participant_metrics_->add(core::MetricKind::compression_time_ns, time);
+        payloads_skipped_++;
+        return false;
+    }
+
+    // Header: magic, codec id and original length (little endian)
+    compressed.data[0] = COMPRESSED_MAGIC[0];
+    compressed.data[1] = COMPRESSED_MAGIC[1];
+    compressed.data[2] = COMPRESSED_MAGIC[2];
+    compressed.data[3] = codec_->id();
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        compressed.data[4 + i] = static_cast<std::uint8_t>(payload.length >> (i * 8));
+    }
+    compressed.length = HEADER_SIZE + compressed_size;
+
+    const std::uint64_t time = elapsed_ns(start);
+    compression_time_ += time;
+    payloads_compressed_++;
+    bytes_in_ += payload.length;
+    bytes_out_ += compressed.length;
+
+    participant_metrics_->add(core::MetricKind::compression_time_ns, time);
+    participant_metrics_->add(core::MetricKind::compression_bytes_in, payload.length);
+    participant_metrics_->add(core::MetricKind::compression_bytes_out, compressed.length);
+
+    return true;
+}
+
+bool PayloadCompressor::decompress(
+        const Payload& payload,
+        Payload& decompressed,
+        bool& error) noexcept
+{
+    error = false;
+
+    if (payload.length < HEADER_SIZE ||
+            payload.data[0] != COMPRESSED_MAGIC[0] ||
+            payload.data[1] != COMPRESSED_MAGIC[1] ||
+            payload.data[2] != COMPRESSED_MAGIC[2])
+    {
+        // Not compressed
+        return false;
+    }
+
+    if (payload.data[3] != codec_->id())
+    {
+        logWarning(DDSPIPE_COMPRESSION,
+                "Payload compressed with unknown codec " << static_cast<unsigned int>(payload.data[3]) <<
+                " received in Participant " << participant_id_ << ".");
+        participant_metrics_->add(core::MetricKind::dropped_malformed);
+        error = true;
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::uint32_t original_size = 0;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        original_size |= static_cast<std::uint32_t>(payload.data[4 + i]) << (i * 8);
+    }
+
+    // Check the original size before reserving it, as it is read from the wire
+    if (original_size > max_payload_size_ ||
+            original_size > codec_->max_decompressed_size(payload.length - HEADER_SIZE))
+    {
+        logWarning(DDSPIPE_COMPRESSION,
+                "Compressed payload of " << payload.length << " bytes claiming an original size of " <<
+                original_size << " bytes received in Participant " << participant_id_ << " (max " <<
+                max_payload_size_ << " bytes).");
+        participant_metrics_->add(core::MetricKind::dropped_malformed);
+        error = true;
+        return false;
+    }
+
+    if (!payload_pool_->get_payload(original_size, decompressed))
+    {
+        logDevError(DDSPIPE_COMPRESSION, "Error getting Payload to decompress.");
+        error = true;
+        return false;
+    }
+
+    if (!codec_->decompress(payload.data + HEADER_SIZE, payload.length - HEADER_SIZE, decompressed.data, original_size))
+    {
+        logWarning(DDSPIPE_COMPRESSION,
+                "Malformed compressed payload received in Participant " << participant_id_ << ".");
+        payload_pool_->release_payload(decompressed);
+        participant_metrics_->add(core::MetricKind::dropped_malformed);
+        error = true;
+        return false;
+    }
+    decompressed.length = original_size;
+
+    const std::uint64_t time = elapsed_ns(start);
+    decompression_time_ += time;
+    payloads_decompressed_++;
+
+    participant_metrics_->add(core::MetricKind::decompression_time_ns, time);
+
+    return true;
+}
+
+std::uint64_t PayloadCompressor::payloads_compressed() const noexcept
+{
+    return payloads_compressed_.load();
+}
+
+std::uint64_t PayloadCompressor::payloads_skipped() const noexcept
+{
+    return payloads_skipped_.load();
+}
+
+std::uint64_t PayloadCompressor::payloads_decompressed() const noexcept
+{
+    return payloads_decompressed_.load();
+}
+
+double PayloadCompressor::compression_ratio() const noexcept
+{
+    const std::uint64_t bytes_out = bytes_out_.load();
+    if (bytes_out == 0)
+    {
+        return 0;
+    }
+
+    return static_cast<double>(bytes_in_.load()) / static_cast<double>(bytes_out);
+}
+
+std::uint64_t PayloadCompressor::compression_time() const noexcept
+{
+    return compression_time_.load();
+}
+
+std::uint64_t PayloadCompressor::decompression_time() const noexcept
+{
+    return decompression_time_.load();
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,88 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <zlib.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/efficiency/compression/ZlibCodec.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+ZlibCodec::ZlibCodec(
+        const unsigned int level)
+    : level_(static_cast<int>(level))
+{
+    // Do nothing
+}
+
+std::uint8_t ZlibCodec::id() const noexcept
+{
+    return ID;
+}
+
+std::uint32_t ZlibCodec::max_compressed_size(
+        const std::uint32_t size) const noexcept
+{
+    return static_cast<std::uint32_t>(compressBound(size));
+}
+
+std::uint64_t ZlibCodec::max_decompressed_size(
+        const std::uint32_t size) const noexcept
+{
+    return static_cast<std::uint64_t>(size) * MAX_EXPANSION_RATIO;
+}
+
+bool ZlibCodec::compress(
+        const std::uint8_t* src,
+        const std::uint32_t src_size,
+        std::uint8_t* dst,
+        std::uint32_t& dst_size) const noexcept
+{
+    uLongf compressed_size = dst_size;
+
+    int ret = compress2(dst, &compressed_size, src, src_size, level_);
+    if (ret != Z_OK)
+    {
+        logDebug(DDSPIPE_COMPRESSION, "zlib failed to compress " << src_size << " bytes. Error code " << ret << ".");
+        return false;
+    }
+
+    dst_size = static_cast<std::uint32_t>(compressed_size);
+    return true;
+}
+
+bool ZlibCodec::decompress(
+        const std::uint8_t* src,
+        const std::uint32_t src_size,
+        std::uint8_t* dst,
+        const std::uint32_t dst_size) const noexcept
+{
+    uLongf decompressed_size = dst_size;
+
+    int ret = uncompress(dst, &decompressed_size, src, src_size);
+    if (ret != Z_OK || decompressed_size != dst_size)
+    {
+        logDebug(DDSPIPE_COMPRESSION, "zlib failed to decompress " << src_size << " bytes. Error code " << ret << ".");
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,183 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/efficiency/delta/DeltaDecoder.hpp>
+#include <ddspipe_participants/efficiency/delta/DeltaFrame.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+DeltaDecoder::DeltaDecoder(
+        const std::string& topic_name,
+        const std::shared_ptr<core::PayloadPool>& payload_pool)
+    : topic_name_(topic_name)
+    , payload_pool_(payload_pool)
+    , keyframes_received_(0)
+    , deltas_received_(0)
+    , deltas_dropped_(0)
+{
+    logDebug(DDSPIPE_DELTA, "Creating DeltaDecoder for topic " << topic_name_ << ".");
+}
+
+DeltaDecoder::~DeltaDecoder()
+{
+    logInfo(DDSPIPE_DELTA,
+            "Topic " << topic_name_ << " received " << keyframes_received_ << " keyframes and " <<
+            deltas_received_ << " deltas (" << deltas_dropped_ << " dropped).");
+}
+
+bool DeltaDecoder::decode(
+        const RtpsPayloadData& data,
+        Payload& decoded,
+        bool& error) noexcept
+{
+    error = false;
+
+    DeltaFrame::Header header;
+    if (!DeltaFrame::read_header(data.payload.data, data.payload.length, header))
+    {
+        if (data.kind != ChangeKind::ALIVE)
+        {
+            // The instance is gone, the remote encoder starts it again with a keyframe
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& stream_it : streams_)
+            {
+                stream_it.second.instances.erase(data.instanceHandle);
+            }
+        }
+
+        // Not a frame
+        return false;
+    }
+
+    const std::uint8_t* body = data.payload.data + DeltaFrame::HEADER_SIZE;
+    const std::uint32_t body_size = data.payload.length - DeltaFrame::HEADER_SIZE;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& instances = stream_state_nts_(header.stream).instances;
+
+    if (header.kind == DeltaFrame::Kind::keyframe)
+    {
+        if (body_size != header.length)
+        {
+            logWarning(DDSPIPE_DELTA, "Malformed keyframe received in topic " << topic_name_ << ".");
+            error = true;
+            return false;
+        }
+
+        if (!payload_pool_->get_payload(header.length, decoded))
+        {
+            logDevError(DDSPIPE_DELTA, "Error getting Payload to decode.");
+            error = true;
+            return false;
+        }
+
+        std::memcpy(decoded.data, body, header.length);
+        decoded.length = header.length;
+
+        InstanceState& state = instances[data.instanceHandle];
+        state.payload.assign(body, body + body_size);
+        state.counter = header.counter;
+
+        keyframes_received_++;
+        return true;
+    }
+
+    auto it = instances.find(data.instanceHandle);
+    if (it == instances.end() ||
+            it->second.counter + 1 != header.counter ||
+            it->second.payload.size() != header.length)
+    {
+        logDebug(DDSPIPE_DELTA,
+                "Dropping delta " << header.counter << " from " << data.source_guid << " in topic " << topic_name_ <<
+                " until next keyframe.");
+        deltas_dropped_++;
+        error = true;
+        return false;
+    }
+
+    InstanceState& state = it->second;
+
+    if (!DeltaFrame::apply_delta(body, body_size, state.payload.data(), header.length))
+    {
+        logWarning(DDSPIPE_DELTA, "Malformed delta received in topic " << topic_name_ << ".");
+
+        // The last payload is no longer valid
+        instances.erase(it);
+        deltas_dropped_++;
+        error = true;
+        return false;
+    }
+    state.counter = header.counter;
+
+    if (!payload_pool_->get_payload(header.length, decoded))
+    {
+        logDevError(DDSPIPE_DELTA, "Error getting Payload to decode.");
+        error = true;
+        return false;
+    }
+
+    std::memcpy(decoded.data, state.payload.data(), header.length);
+    decoded.length = header.length;
+
+    deltas_received_++;
+    return true;
+}
+
+std::uint64_t DeltaDecoder::deltas_dropped() const noexcept
+{
+    return deltas_dropped_.load();
+}
+
+DeltaDecoder::StreamState& DeltaDecoder::stream_state_nts_(
+        const std::uint32_t stream) noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    auto it = streams_.find(stream);
+    if (it == streams_.end())
+    {
+        // A new encoder (maybe a restarted remote proxy), so forget the ones that no longer send
+        for (auto idle_it = streams_.begin(); idle_it != streams_.end();)
+        {
+            if (now - idle_it->second.last_seen > std::chrono::milliseconds(STREAM_TIMEOUT))
+            {
+                logDebug(DDSPIPE_DELTA,
+                        "Forgetting idle stream " << idle_it->first << " in topic " << topic_name_ << ".");
+                idle_it = streams_.erase(idle_it);
+            }
+            else
+            {
+                ++idle_it;
+            }
+        }
+
+        it = streams_.emplace(stream, StreamState()).first;
+    }
+
+    it->second.last_seen = now;
+    return it->second;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,141 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <random>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/efficiency/delta/DeltaEncoder.hpp>
+#include <ddspipe_participants/efficiency/delta/DeltaFrame.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+DeltaEncoder::DeltaEncoder(
+        const std::string& topic_name,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        const std::uint32_t keyframe_interval)
+    : topic_name_(topic_name)
+    , payload_pool_(payload_pool)
+    , keyframe_interval_(keyframe_interval)
+    , stream_(std::random_device()())
+    , keyframes_sent_(0)
+    , deltas_sent_(0)
+    , bytes_in_(0)
+    , bytes_out_(0)
+{
+    logDebug(DDSPIPE_DELTA,
+            "Creating DeltaEncoder " << stream_ << " for topic " << topic_name_ <<
+            " with keyframe interval " << keyframe_interval_ << ".");
+}
+
+DeltaEncoder::~DeltaEncoder()
+{
+    logInfo(DDSPIPE_DELTA,
+            "Topic " << topic_name_ << " sent " << keyframes_sent_ << " keyframes and " << deltas_sent_ <<
+            " deltas (ratio " << encoding_ratio() << ").");
+}
+
+bool DeltaEncoder::encode(
+        const RtpsPayloadData& data,
+        Payload& encoded) noexcept
+{
+    if (data.kind != ChangeKind::ALIVE || data.payload.length == 0)
+    {
+        // The instance is gone, next sample of it starts with a keyframe
+        instances_.erase(data.instanceHandle);
+        return false;
+    }
+
+    const std::uint32_t length = data.payload.length;
+
+    if (!payload_pool_->get_payload(DeltaFrame::HEADER_SIZE + length, encoded))
+    {
+        logDevError(DDSPIPE_DELTA, "Error getting Payload to encode.");
+        return false;
+    }
+
+    InstanceState& state = instances_[data.instanceHandle];
+
+    DeltaFrame::Header header;
+    header.stream = stream_;
+    header.counter = state.counter + 1;
+    header.length = length;
+
+    // Send a delta if the receiver can rebuild it from the last frame sent and it is smaller than the payload
+    std::uint32_t delta_size = length - 1;
+    if (state.payload.size() == length &&
+            state.deltas_since_keyframe + 1 < keyframe_interval_ &&
+            DeltaFrame::encode_delta(
+                state.payload.data(), data.payload.data, length, encoded.data + DeltaFrame::HEADER_SIZE, delta_size))
+    {
+        header.kind = DeltaFrame::Kind::delta;
+        encoded.length = DeltaFrame::HEADER_SIZE + delta_size;
+        state.deltas_since_keyframe++;
+        deltas_sent_++;
+    }
+    else
+    {
+        header.kind = DeltaFrame::Kind::keyframe;
+        std::memcpy(encoded.data + DeltaFrame::HEADER_SIZE, data.payload.data, length);
+        encoded.length = DeltaFrame::HEADER_SIZE + length;
+        state.deltas_since_keyframe = 0;
+        keyframes_sent_++;
+    }
+
+    DeltaFrame::write_header(header, encoded.data);
+
+    state.payload.assign(data.payload.data, data.payload.data + length);
+    state.counter = header.counter;
+
+    bytes_in_ += length;
+    bytes_out_ += encoded.length;
+
+    return true;
+}
+
+void DeltaEncoder::discard(
+        const InstanceHandle& instance) noexcept
+{
+    instances_.erase(instance);
+}
+
+std::uint64_t DeltaEncoder::keyframes_sent() const noexcept
+{
+    return keyframes_sent_.load();
+}
+
+std::uint64_t DeltaEncoder::deltas_sent() const noexcept
+{
+    return deltas_sent_.load();
+}
+
+double DeltaEncoder::encoding_ratio() const noexcept
+{
+    const std::uint64_t bytes_out = bytes_out_.load();
+    if (bytes_out == 0)
+    {
+        return 0;
+    }
+
+    return static_cast<double>(bytes_in_.load()) / static_cast<double>(bytes_out);
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,226 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_participants/efficiency/delta/DeltaFrame.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+namespace {
+
+//! Magic at the beginning of every frame (first byte is never 0, unlike CDR encapsulations)
+constexpr const std::uint8_t DELTA_MAGIC[] = {'D', 'P', 'D'};
+
+//! Minimum run of zeros that ends a literal (shorter runs are cheaper inside the literal)
+constexpr const std::uint32_t MIN_ZERO_RUN = 3;
+
+void write_u32(
+        const std::uint32_t value,
+        std::uint8_t* dst) noexcept
+{
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        dst[i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+}
+
+std::uint32_t read_u32(
+        const std::uint8_t* src) noexcept
+{
+    std::uint32_t value = 0;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        value |= static_cast<std::uint32_t>(src[i]) << (i * 8);
+    }
+    return value;
+}
+
+bool write_varint(
+        std::uint32_t value,
+        std::uint8_t* dst,
+        const std::uint32_t capacity,
+        std::uint32_t& position) noexcept
+{
+    do
+    {
+        if (position >= capacity)
+        {
+            return false;
+        }
+
+        std::uint8_t byte = value & 0x7F;
+        value >>= 7;
+        dst[position++] = byte | (value ? 0x80 : 0);
+    } while (value);
+
+    return true;
+}
+
+bool read_varint(
+        const std::uint8_t* src,
+        const std::uint32_t size,
+        std::uint32_t& position,
+        std::uint32_t& value) noexcept
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 32; shift += 7)
+    {
+        if (position >= size)
+        {
+            return false;
+        }
+
+        const std::uint8_t byte = src[position++];
+        value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    // Too many bytes for a 32 bits value
+    return false;
+}
+
+} /* namespace */
+
+void DeltaFrame::write_header(
+        const Header& header,
+        std::uint8_t* dst) noexcept
+{
+    dst[0] = DELTA_MAGIC[0];
+    dst[1] = DELTA_MAGIC[1];
+    dst[2] = DELTA_MAGIC[2];
+    dst[3] = static_cast<std::uint8_t>(header.kind);
+    write_u32(header.stream, dst + 4);
+    write_u32(header.counter, dst + 8);
+    write_u32(header.length, dst + 12);
+}
+
+bool DeltaFrame::read_header(
+        const std::uint8_t* src,
+        const std::uint32_t size,
+        Header& header) noexcept
+{
+    if (size < HEADER_SIZE ||
+            src[0] != DELTA_MAGIC[0] ||
+            src[1] != DELTA_MAGIC[1] ||
+            src[2] != DELTA_MAGIC[2] ||
+            src[3] > static_cast<std::uint8_t>(Kind::delta))
+    {
+        return false;
+    }
+
+    header.kind = static_cast<Kind>(src[3]);
+    header.stream = read_u32(src + 4);
+    header.counter = read_u32(src + 8);
+    header.length = read_u32(src + 12);
+
+    return true;
+}
+
+bool DeltaFrame::encode_delta(
+        const std::uint8_t* previous,
+        const std::uint8_t* current,
+        const std::uint32_t size,
+        std::uint8_t* dst,
+        std::uint32_t& dst_size) noexcept
+{
+    const std::uint32_t capacity = dst_size;
+    std::uint32_t position = 0;
+    std::uint32_t i = 0;
+
+    while (i < size)
+    {
+        // Run of unchanged bytes
+        const std::uint32_t run_start = i;
+        while (i < size && previous[i] == current[i])
+        {
+            ++i;
+        }
+
+        if (i == size)
+        {
+            // Trailing zeros are implicit
+            break;
+        }
+
+        // Literal until the next run of unchanged bytes long enough (or the end)
+        const std::uint32_t literal_start = i;
+        std::uint32_t zeros = 0;
+        while (i < size && zeros < MIN_ZERO_RUN)
+        {
+            zeros = (previous[i] == current[i]) ? zeros + 1 : 0;
+            ++i;
+        }
+        i -= zeros;
+        const std::uint32_t literal_length = i - literal_start;
+
+        if (!write_varint(literal_start - run_start, dst, capacity, position) ||
+                !write_varint(literal_length, dst, capacity, position) ||
+                capacity - position < literal_length)
+        {
+            return false;
+        }
+
+        for (std::uint32_t j = literal_start; j < i; ++j)
+        {
+            dst[position++] = previous[j] ^ current[j];
+        }
+    }
+
+    dst_size = position;
+    return true;
+}
+
+bool DeltaFrame::apply_delta(
+        const std::uint8_t* src,
+        const std::uint32_t src_size,
+        std::uint8_t* payload,
+        const std::uint32_t size) noexcept
+{
+    std::uint32_t position = 0;
+    std::uint32_t i = 0;
+
+    while (position < src_size)
+    {
+        std::uint32_t zero_run = 0;
+        std::uint32_t literal_length = 0;
+        if (!read_varint(src, src_size, position, zero_run) ||
+                !read_varint(src, src_size, position, literal_length))
+        {
+            return false;
+        }
+
+        if (zero_run > size - i ||
+                literal_length > size - i - zero_run ||
+                literal_length > src_size - position)
+        {
+            return false;
+        }
+
+        i += zero_run;
+        for (std::uint32_t j = 0; j < literal_length; ++j)
+        {
+            payload[i++] ^= src[position++];
+        }
+    }
+
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,290 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/participant/auxiliar/GeneratorParticipant.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+namespace {
+
+//! CDR little endian encapsulation that starts every payload generated
+constexpr const std::uint8_t CDR_LE_ENCAPSULATION[] = {0x00, 0x01, 0x00, 0x00};
+
+//! Seed of the payload sizes, so every run generates the same sequence of sizes
+constexpr const std::mt19937::result_type RANDOM_SEED = 0x5eed;
+
+//! Minimum time [s] between two generation rounds, so high rates are generated in batches
+constexpr const double MIN_GENERATION_PERIOD = 0.001;
+
+//! Maximum time [s] of samples generated at once when the generation falls behind (e.g. after a suspension)
+constexpr const double MAX_GENERATION_BURST = 1.0;
+
+//! Write \c value in \c bytes little endian bytes starting at \c buffer
+void write_little_endian(
+        std::uint8_t* buffer,
+        const std::uint64_t value,
+        const unsigned int bytes) noexcept
+{
+    for (unsigned int i = 0; i < bytes; ++i)
+    {
+        buffer[i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+}
+
+} /* namespace */
+
+GeneratorParticipant::GeneratorParticipant(
+        const std::shared_ptr<GeneratorParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        const std::shared_ptr<core::DiscoveryDatabase>& discovery_database)
+    : BlankParticipant(participant_configuration->id)
+    , configuration_(participant_configuration)
+    , payload_pool_(payload_pool)
+    , discovery_database_(discovery_database)
+    , random_generator_(RANDOM_SEED)
+    , samples_generated_(0)
+    , samples_skipped_(0)
+    , stop_(false)
+{
+    logDebug(DDSPIPE_GENERATOR_PARTICIPANT, "Creating Generator Participant : " << configuration_->id << " .");
+
+    topics_.reserve(configuration_->topics);
+
+    for (unsigned int i = 0; i < configuration_->topics; ++i)
+    {
+        GeneratedTopic generated;
+        generated.topic.m_topic_name = configuration_->topic_prefix + std::to_string(i);
+        generated.topic.type_name = configuration_->type_name;
+        generated.topic.topic_qos.keyed.set_value(configuration_->keys > 0);
+        generated.topic.m_topic_discoverer = id();
+        generated.writer_guid = Guid::new_unique_guid();
+        generated.reader = std::make_shared<InternalReader>(id());
+        generated.sequence_number = 0;
+
+        // Announce both kinds of endpoints, so the topic is relevant for any discovery trigger
+        announce_endpoint_(generated, EndpointKind::writer, generated.writer_guid);
+        announce_endpoint_(generated, EndpointKind::reader, Guid::new_unique_guid());
+
+        topics_.push_back(std::move(generated));
+    }
+
+    logInfo(DDSPIPE_GENERATOR_PARTICIPANT,
+            "Generator Participant " << id() << " generating " << configuration_->topics << " topics at " <<
+            configuration_->rate << " samples/s each.");
+
+    generation_thread_ = std::thread(&GeneratorParticipant::generation_routine_, this);
+}
+
+GeneratorParticipant::~GeneratorParticipant()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    if (generation_thread_.joinable())
+    {
+        generation_thread_.join();
+    }
+
+    logInfo(DDSPIPE_GENERATOR_PARTICIPANT,
+            "Generator Participant " << id() << " generated " << samples_generated_ << " samples and skipped " <<
+            samples_skipped_ << " samples.");
+}
+
+std::shared_ptr<core::IReader> GeneratorParticipant::create_reader(
+        const core::ITopic& topic)
+{
+    for (const auto& generated : topics_)
+    {
+        if (topic.topic_unique_name() == generated.topic.topic_unique_name())
+        {
+            return generated.reader;
+        }
+    }
+
+    return std::make_shared<BlankReader>();
+}
+
+std::uint64_t GeneratorParticipant::samples_generated() const noexcept
+{
+    return samples_generated_.load();
+}
+
+std::uint64_t GeneratorParticipant::samples_skipped() const noexcept
+{
+    return samples_skipped_.load();
+}
+
+void GeneratorParticipant::generation_routine_() noexcept
+{
+    const double rate = configuration_->rate;
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(std::max(1.0 / rate, MIN_GENERATION_PERIOD)));
+    const auto max_burst = static_cast<std::uint64_t>(std::max(rate * MAX_GENERATION_BURST, 1.0));
+
+    const auto start = std::chrono::steady_clock::now();
+    std::uint64_t samples_per_topic = 0;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stop_)
+    {
+        lock.unlock();
+
+        // Samples owed to every topic since the generation started
+        const auto now = std::chrono::steady_clock::now();
+        const auto expected = static_cast<std::uint64_t>(std::chrono::duration<double>(now - start).count() * rate);
+
+        if (expected > samples_per_topic + max_burst)
+        {
+            // Do not try to catch up with the samples that should have been generated long ago
+            samples_per_topic = expected - max_burst;
+        }
+
+        for (; samples_per_topic < expected; ++samples_per_topic)
+        {
+            for (auto& generated : topics_)
+            {
+                generate_sample_(generated);
+            }
+        }
+
+        lock.lock();
+        cv_.wait_until(
+            lock,
+            now + period,
+            [this]()
+            {
+                return stop_;
+            });
+    }
+}
+
+void GeneratorParticipant::generate_sample_(
+        GeneratedTopic& generated) noexcept
+{
+    if (configuration_->max_pending > 0 && generated.reader->pending_data() >= configuration_->max_pending)
+    {
+        samples_skipped_++;
+        return;
+    }
+
+    const std::uint32_t size = next_payload_size_();
+
+    auto data = std::make_unique<RtpsPayloadData>();
+    if (!payload_pool_->get_payload(size, data->payload))
+    {
+        logDevError(DDSPIPE_GENERATOR_PARTICIPANT, "Error getting Payload to generate a sample.");
+        samples_skipped_++;
+        return;
+    }
+    data->payload_owner = payload_pool_.get();
+
+    const std::uint64_t sequence_number = ++generated.sequence_number;
+    const std::uint32_t key = configuration_->keys > 0 ?
+            static_cast<std::uint32_t>(sequence_number % configuration_->keys) : 0;
+
+    // Payload: encapsulation, key, sequence number and filler
+    std::uint8_t* buffer = data->payload.data;
+    std::copy(std::begin(CDR_LE_ENCAPSULATION), std::end(CDR_LE_ENCAPSULATION), buffer);
+    write_little_endian(buffer + 4, key, 4);
+    write_little_endian(buffer + 8, sequence_number, 8);
+    for (std::uint32_t i = HEADER_SIZE; i < size; ++i)
+    {
+        buffer[i] = static_cast<std::uint8_t>(sequence_number + i);
+    }
+    data->payload.length = size;
+
+    if (configuration_->keys > 0)
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            data->instanceHandle.value[i] = static_cast<std::uint8_t>(key >> (i * 8));
+        }
+    }
+
+    data->kind = ChangeKind::ALIVE;
+    DataTime::now(data->source_timestamp);
+    data->reception_timestamp = data->source_timestamp;
+    data->source_guid = generated.writer_guid;
+    data->sequence_number.high = static_cast<std::int32_t>(sequence_number >> 32);
+    data->sequence_number.low = static_cast<std::uint32_t>(sequence_number);
+    data->participant_receiver = id();
+
+    generated.reader->simulate_data_reception(std::move(data));
+    samples_generated_++;
+}
+
+std::uint32_t GeneratorParticipant::next_payload_size_() noexcept
+{
+    std::uint32_t size = configuration_->payload_size;
+
+    switch (configuration_->size_distribution)
+    {
+        case PayloadSizeDistribution::uniform:
+        {
+            std::uniform_int_distribution<std::uint32_t> distribution(
+                configuration_->payload_size, configuration_->max_payload_size);
+            size = distribution(random_generator_);
+            break;
+        }
+
+        case PayloadSizeDistribution::exponential:
+        {
+            std::exponential_distribution<double> distribution(1.0 / configuration_->payload_size);
+            size = static_cast<std::uint32_t>(
+                std::min(distribution(random_generator_), static_cast<double>(configuration_->max_payload_size)));
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    // Every payload carries at least its header
+    return size < HEADER_SIZE ? HEADER_SIZE : size;
+}
+
+void GeneratorParticipant::announce_endpoint_(
+        const GeneratedTopic& generated,
+        const EndpointKind kind,
+        const Guid& guid)
+{
+    Endpoint endpoint;
+    endpoint.kind = kind;
+    endpoint.guid = guid;
+    endpoint.topic = generated.topic;
+    endpoint.discoverer_participant_id = id();
+
+    discovery_database_->add_endpoint(endpoint);
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,50 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_participants/participant/auxiliar/InternalParticipant.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+InternalParticipant::InternalParticipant(
+        const core::types::ParticipantId& id,
+        const std::string& topic_name)
+    : BlankParticipant(id)
+    , topic_name_(topic_name)
+    , reader_(std::make_shared<InternalReader>(id))
+{
+    // Do nothing
+}
+
+std::shared_ptr<core::IReader> InternalParticipant::create_reader(
+        const core::ITopic& topic)
+{
+    if (topic.topic_name() == topic_name_)
+    {
+        return reader_;
+    }
+
+    return std::make_shared<BlankReader>();
+}
+
+std::shared_ptr<InternalReader> InternalParticipant::reader() const noexcept
+{
+    return reader_;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,134 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/participant/auxiliar/SinkParticipant.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+namespace {
+
+//! Rate [1/s] of \c amount during \c duration [s] (0 if the duration is not positive)
+double rate(
+        const std::uint64_t amount,
+        const double duration) noexcept
+{
+    return duration > 0 ? static_cast<double>(amount) / duration : 0;
+}
+
+} /* namespace */
+
+SinkParticipant::SinkParticipant(
+        const std::shared_ptr<SinkParticipantConfiguration>& participant_configuration)
+    : BlankParticipant(participant_configuration->id)
+    , configuration_(participant_configuration)
+{
+    logDebug(DDSPIPE_SINK, "Creating Sink Participant : " << configuration_->id << " .");
+}
+
+SinkParticipant::~SinkParticipant()
+{
+    report();
+}
+
+std::shared_ptr<core::IWriter> SinkParticipant::create_writer(
+        const core::ITopic& topic)
+{
+    if (topic.internal_type_discriminator() != core::types::INTERNAL_TOPIC_TYPE_RTPS)
+    {
+        logInfo(DDSPIPE_SINK, "Ignoring topic " << topic.topic_name() << " as it is not RTPS.");
+        return std::make_shared<BlankWriter>();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Reuse the writer of a topic created again, so its statistics accumulate
+    auto& writer = writers_[topic.topic_unique_name()];
+    if (!writer)
+    {
+        writer = std::make_shared<SinkWriter>(dynamic_cast<const core::types::DdsTopic&>(topic));
+    }
+
+    return writer;
+}
+
+std::map<std::string, SinkStatistics> SinkParticipant::statistics() const noexcept
+{
+    std::map<std::string, SinkStatistics> statistics;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& writer : writers_)
+    {
+        statistics.emplace(writer.second->topic().topic_name(), writer.second->statistics());
+    }
+
+    return statistics;
+}
+
+void SinkParticipant::report() const noexcept
+{
+    SinkStatistics total;
+
+    for (const auto& topic : statistics())
+    {
+        const SinkStatistics& stats = topic.second;
+
+        logUser(
+            DDSPIPE_SINK,
+            "Sink Participant " << id() << " received in topic " << topic.first << ": " <<
+                stats.samples << " samples in " << stats.duration << " s (" <<
+                rate(stats.samples, stats.duration) << " samples/s, " <<
+                rate(stats.bytes, stats.duration) / 1e6 << " MB/s) from " << stats.sources.size() << " writers, " <<
+                stats.lost << " lost, " << stats.duplicates << " duplicated, " << stats.out_of_order <<
+                " out of order, latency p50 " << stats.latency.percentile_ns(0.5) / 1000 << " us, p99 " <<
+                stats.latency.percentile_ns(0.99) / 1000 << " us, max " << stats.latency.max_ns / 1000 << " us.");
+
+        if (configuration_->verbose)
+        {
+            for (const auto& source : stats.sources)
+            {
+                logUser(
+                    DDSPIPE_SINK,
+                    "  From writer " << source.first << ": " << source.second.samples << " samples, " <<
+                        source.second.lost << " lost, " << source.second.duplicates << " duplicated, " <<
+                        source.second.out_of_order << " out of order.");
+            }
+        }
+
+        total.samples += stats.samples;
+        total.bytes += stats.bytes;
+        total.lost += stats.lost;
+        total.duplicates += stats.duplicates;
+        total.out_of_order += stats.out_of_order;
+        total.duration = std::max(total.duration, stats.duration);
+    }
+
+    logUser(
+        DDSPIPE_SINK,
+        "Sink Participant " << id() << " received " << total.samples << " samples (" <<
+            rate(total.samples, total.duration) << " samples/s, " << rate(total.bytes, total.duration) / 1e6 <<
+            " MB/s), " << total.lost << " lost, " << total.duplicates << " duplicated, " << total.out_of_order <<
+            " out of order.");
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
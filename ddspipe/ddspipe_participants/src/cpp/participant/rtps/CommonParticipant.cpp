@@ -34,10 +34,15 @@
 #include <ddspipe_participants/library/library_dll.h>
 #include <ddspipe_participants/participant/rtps/CommonParticipant.hpp>
 #include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/reader/auxiliar/DecompressionReader.hpp>
+#include <ddspipe_participants/reader/auxiliar/DeltaReader.hpp>
 #include <ddspipe_participants/reader/rpc/SimpleReader.hpp>
 #include <ddspipe_participants/reader/rtps/SimpleReader.hpp>
 #include <ddspipe_participants/reader/rtps/SpecificQoSReader.hpp>
+#include <ddspipe_participants/types/bundle/BundleEnvelope.hpp>
 #include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+#include <ddspipe_participants/writer/auxiliar/CompressionWriter.hpp>
+#include <ddspipe_participants/writer/auxiliar/DeltaWriter.hpp>
 #include <ddspipe_participants/writer/rpc/SimpleWriter.hpp>
 #include <ddspipe_participants/writer/rtps/MultiWriter.hpp>
 #include <ddspipe_participants/writer/rtps/QoSSpecificWriter.hpp>
@@ -115,6 +120,12 @@ void CommonParticipant::onReaderDiscovery(
         core::types::Endpoint info_reader = detail::create_endpoint_from_info_<fastrtps::rtps::ReaderDiscoveryInfo>(
             info, this->id());
 
+        if (info_reader.topic.m_topic_name == types::BundleEnvelope::TOPIC_NAME)
+        {
+            // Internal bundle topic endpoints are not forwarded
+            return;
+        }
+
         if (info.status == fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERED_READER)
         {
             logInfo(DDSPIPE_DISCOVERY,
@@ -154,6 +165,12 @@ void CommonParticipant::onWriterDiscovery(
         core::types::Endpoint info_writer = detail::create_endpoint_from_info_<fastrtps::rtps::WriterDiscoveryInfo>(
             info, this->id());
 
+        if (info_writer.topic.m_topic_name == types::BundleEnvelope::TOPIC_NAME)
+        {
+            // Internal bundle topic endpoints are not forwarded
+            return;
+        }
+
         if (info.status == fastrtps::rtps::WriterDiscoveryInfo::DISCOVERED_WRITER)
         {
             logInfo(DDSPIPE_DISCOVERY,
@@ -388,12 +405,14 @@ std::shared_ptr<core::IWriter> CommonParticipant::create_writer(
         if (dds_topic.topic_qos.has_partitions() || dds_topic.topic_qos.has_ownership())
         {
             // Notice that MultiWriter does not require an init call
-            return std::make_shared<MultiWriter>(
+            auto writer = std::make_shared<MultiWriter>(
                 this->id(),
                 dds_topic,
                 this->payload_pool_,
                 rtps_participant_,
                 this->configuration_->is_repeater);
+
+            return apply_delta_(apply_compression_(writer), dds_topic);
         }
         else
         {
@@ -405,7 +424,7 @@ std::shared_ptr<core::IWriter> CommonParticipant::create_writer(
                 this->configuration_->is_repeater);
             writer->init();
 
-            return writer;
+            return apply_delta_(apply_compression_(writer), dds_topic);
         }
     }
     else
@@ -455,7 +474,7 @@ std::shared_ptr<core::IReader> CommonParticipant::create_reader(
                 discovery_database_);
             reader->init();
 
-            return reader;
+            return apply_delta_(apply_compression_(reader), dds_topic);
         }
         else
         {
@@ -466,7 +485,7 @@ std::shared_ptr<core::IReader> CommonParticipant::create_reader(
                 rtps_participant_);
             reader->init();
 
-            return reader;
+            return apply_delta_(apply_compression_(reader), dds_topic);
         }
     }
     else
@@ -503,6 +522,53 @@ CommonParticipant::reckon_participant_attributes_(
     return params;
 }
 
+std::shared_ptr<core::IWriter> CommonParticipant::apply_compression_(
+        const std::shared_ptr<core::IWriter>& writer) const
+{
+    if (!compressor_)
+    {
+        return writer;
+    }
+
+    return std::make_shared<CompressionWriter>(this->id(), writer, compressor_, payload_pool_);
+}
+
+std::shared_ptr<core::IReader> CommonParticipant::apply_compression_(
+        const std::shared_ptr<core::IReader>& reader) const
+{
+    if (!compressor_)
+    {
+        return reader;
+    }
+
+    return std::make_shared<DecompressionReader>(reader, compressor_);
+}
+
+std::shared_ptr<core::IWriter> CommonParticipant::apply_delta_(
+        const std::shared_ptr<core::IWriter>& writer,
+        const core::types::DdsTopic& topic) const
+{
+    // Instances are only identified in keyed topics
+    if (!delta_.enabled || !topic.topic_qos.keyed)
+    {
+        return writer;
+    }
+
+    return std::make_shared<DeltaWriter>(this->id(), topic, writer, payload_pool_, delta_.keyframe_interval);
+}
+
+std::shared_ptr<core::IReader> CommonParticipant::apply_delta_(
+        const std::shared_ptr<core::IReader>& reader,
+        const core::types::DdsTopic& topic) const
+{
+    if (!delta_.enabled || !topic.topic_qos.keyed)
+    {
+        return reader;
+    }
+
+    return std::make_shared<DeltaReader>(topic, reader, payload_pool_);
+}
+
 } /* namespace rtps */
 } /* namespace participants */
 } /* namespace ddspipe */
@@ -41,6 +41,8 @@ DiscoveryServerParticipant::DiscoveryServerParticipant(
         participant_configuration->domain,
         reckon_participant_attributes_(participant_configuration.get()))
 {
+    compressor_ = PayloadCompressor::create(id(), payload_pool, participant_configuration->compression);
+    delta_ = participant_configuration->delta;
 }
 
 fastrtps::rtps::RTPSParticipantAttributes
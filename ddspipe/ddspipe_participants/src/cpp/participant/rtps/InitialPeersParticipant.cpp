@@ -20,6 +20,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <ddspipe_participants/participant/rtps/InitialPeersParticipant.hpp>
+#include <ddspipe_participants/writer/auxiliar/BundleWriter.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -36,7 +37,140 @@ InitialPeersParticipant::InitialPeersParticipant(
         discovery_database,
         participant_configuration->domain,
         reckon_participant_attributes_(participant_configuration.get()))
+    , bundle_(participant_configuration->bundle)
+    , bundle_max_size_(participant_configuration->bundle_max_size)
+    , bundle_max_delay_(participant_configuration->bundle_max_delay)
 {
+    compressor_ = PayloadCompressor::create(id(), payload_pool, participant_configuration->compression);
+    delta_ = participant_configuration->delta;
+}
+
+void InitialPeersParticipant::init()
+{
+    CommonParticipant::init();
+
+    if (!bundle_)
+    {
+        return;
+    }
+
+    logInfo(DDSPIPE_INITIALPEERS_PARTICIPANT,
+            "Participant " << id() << " bundling samples in envelopes of " << bundle_max_size_ <<
+            " bytes at most, sent every " << bundle_max_delay_ << " ms at most.");
+
+    bundler_ = std::make_shared<Bundler>(
+        id(),
+        payload_pool_,
+        rtps_participant_,
+        bundle_max_size_,
+        bundle_max_delay_);
+    bundler_->init();
+
+    unbundler_ = std::make_unique<Unbundler>(
+        id(),
+        payload_pool_,
+        rtps_participant_,
+        [this](const core::types::Guid& source, const core::types::DdsTopic& topic)
+        {
+            on_topic_announced_(source, topic);
+        },
+        [this](const core::types::Guid& source, const core::types::DdsTopic& topic)
+        {
+            on_topic_withdrawn_(source, topic);
+        });
+    unbundler_->init();
+}
+
+std::shared_ptr<core::IWriter> InitialPeersParticipant::create_writer(
+        const core::ITopic& topic)
+{
+    if (!is_bundled_(topic))
+    {
+        return CommonParticipant::create_writer(topic);
+    }
+
+    const auto& dds_topic = dynamic_cast<const core::types::DdsTopic&>(topic);
+
+    auto writer = std::make_shared<BundleWriter>(
+        id(),
+        dds_topic,
+        bundler_);
+
+    return apply_delta_(apply_compression_(writer), dds_topic);
+}
+
+std::shared_ptr<core::IReader> InitialPeersParticipant::create_reader(
+        const core::ITopic& topic)
+{
+    if (!is_bundled_(topic))
+    {
+        return CommonParticipant::create_reader(topic);
+    }
+
+    const auto& dds_topic = dynamic_cast<const core::types::DdsTopic&>(topic);
+
+    // Let the remote proxy know that this topic is required, so it creates the bridge that writes in it
+    auto reader = unbundler_->create_reader(dds_topic);
+    bundler_->announce(dds_topic, reader);
+
+    return apply_delta_(apply_compression_(reader), dds_topic);
+}
+
+bool InitialPeersParticipant::is_bundled_(
+        const core::ITopic& topic) const noexcept
+{
+    // Only RTPS topics are bundled, RPC topics keep their own endpoints
+    return bundle_ &&
+           topic.internal_type_discriminator() == core::types::INTERNAL_TOPIC_TYPE_RTPS &&
+           dynamic_cast<const core::types::DdsTopic*>(&topic) != nullptr;
+}
+
+void InitialPeersParticipant::on_topic_announced_(
+        const core::types::Guid& source,
+        const core::types::DdsTopic& topic)
+{
+    logInfo(DDSPIPE_INITIALPEERS_PARTICIPANT,
+            "Topic " << topic << " announced by " << source << " in bundle of Participant " << id() << ".");
+
+    core::types::Endpoint endpoint = simulate_endpoint(topic, id());
+    const auto key = std::make_pair(source, types::BundleEnvelope::topic_key(topic));
+
+    {
+        std::lock_guard<std::mutex> lock(simulated_endpoints_mutex_);
+
+        if (!simulated_endpoints_.emplace(key, endpoint).second)
+        {
+            // Already simulated for this remote bundle writer
+            return;
+        }
+    }
+
+    discovery_database_->add_endpoint(endpoint);
+}
+
+void InitialPeersParticipant::on_topic_withdrawn_(
+        const core::types::Guid& source,
+        const core::types::DdsTopic& topic)
+{
+    core::types::Endpoint endpoint;
+
+    {
+        std::lock_guard<std::mutex> lock(simulated_endpoints_mutex_);
+
+        auto it = simulated_endpoints_.find(std::make_pair(source, types::BundleEnvelope::topic_key(topic)));
+        if (it == simulated_endpoints_.end())
+        {
+            return;
+        }
+
+        endpoint = it->second;
+        simulated_endpoints_.erase(it);
+    }
+
+    logInfo(DDSPIPE_INITIALPEERS_PARTICIPANT,
+            "Topic " << topic << " withdrawn by " << source << " in bundle of Participant " << id() << ".");
+
+    discovery_database_->erase_endpoint(endpoint);
 }
 
 fastrtps::rtps::RTPSParticipantAttributes InitialPeersParticipant::reckon_participant_attributes_(
@@ -17,6 +17,7 @@
 #include <cpp_utils/math/math_extension.hpp>
 
 #include <ddspipe_participants/reader/auxiliar/BaseReader.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 
 namespace eprosima {
@@ -39,6 +40,7 @@ BaseReader::BaseReader(
     , on_data_available_lambda_(DEFAULT_ON_DATA_AVAILABLE_CALLBACK)
     , on_data_available_lambda_set_(false)
     , enabled_(false)
+    , participant_metrics_(core::ProcessMetricsRegistry::get_instance()->participant_metrics(participant_id))
 {
     logDebug(DDSPIPE_BASEREADER, "Creating Reader " << *this << ".");
 
@@ -115,7 +117,15 @@ utils::ReturnCode BaseReader::take(
 
     if (enabled_.load())
     {
-        return take_nts_(data);
+        utils::ReturnCode ret = take_nts_(data);
+
+        if (ret == utils::ReturnCode::RETCODE_OK && data)
+        {
+            add_metric_(core::MetricKind::samples_in);
+            add_metric_(core::MetricKind::bytes_in, core::EntityMetrics::data_size(*data));
+        }
+
+        return ret;
     }
     else
     {
@@ -141,6 +151,7 @@ bool BaseReader::should_accept_sample_() noexcept
         auto threshold = last_received_ts_ + min_intersample_period_;
         if (now < threshold)
         {
+            add_metric_(core::MetricKind::dropped_rate_limit);
             return false;
         }
     }
@@ -153,6 +164,7 @@ bool BaseReader::should_accept_sample_() noexcept
 
     if (prev_downsampling_idx != 0)
     {
+        add_metric_(core::MetricKind::dropped_downsampling);
         return false;
     }
 
@@ -162,6 +174,21 @@ bool BaseReader::should_accept_sample_() noexcept
     return true;
 }
 
+void BaseReader::add_metric_(
+        const core::MetricKind kind,
+        const std::uint64_t value /* = 1 */) noexcept
+{
+    if (participant_metrics_)
+    {
+        participant_metrics_->add(kind, value);
+    }
+
+    if (topic_metrics_)
+    {
+        topic_metrics_->add(kind, value);
+    }
+}
+
 void BaseReader::on_data_available_() const noexcept
 {
     if (on_data_available_lambda_set_)
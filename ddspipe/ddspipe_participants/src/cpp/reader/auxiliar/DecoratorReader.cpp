@@ -0,0 +1,99 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/DecoratorReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+DecoratorReader::DecoratorReader(
+        const std::shared_ptr<IReader>& reader)
+    : reader_(reader)
+{
+    // Do nothing
+}
+
+void DecoratorReader::enable() noexcept
+{
+    reader_->enable();
+}
+
+void DecoratorReader::disable() noexcept
+{
+    reader_->disable();
+}
+
+void DecoratorReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    reader_->set_on_data_available_callback(on_data_available_lambda);
+}
+
+void DecoratorReader::unset_on_data_available_callback() noexcept
+{
+    reader_->unset_on_data_available_callback();
+}
+
+utils::ReturnCode DecoratorReader::take(
+        std::unique_ptr<IRoutingData>& data) noexcept
+{
+    return reader_->take(data);
+}
+
+Guid DecoratorReader::guid() const
+{
+    return reader_->guid();
+}
+
+fastrtps::RecursiveTimedMutex& DecoratorReader::get_rtps_mutex() const
+{
+    return reader_->get_rtps_mutex();
+}
+
+uint64_t DecoratorReader::get_unread_count() const
+{
+    return reader_->get_unread_count();
+}
+
+DdsTopic DecoratorReader::topic() const
+{
+    return reader_->topic();
+}
+
+ParticipantId DecoratorReader::participant_id() const
+{
+    return reader_->participant_id();
+}
+
+void DecoratorReader::replace_payload_(
+        RtpsPayloadData& data,
+        Payload& payload) noexcept
+{
+    PayloadPool* payload_pool = data.payload_owner;
+    fastrtps::rtps::IPayloadPool* payload_owner = payload_pool;
+
+    payload_pool->release_payload(data.payload);
+    payload_pool->get_payload(payload, payload_owner, data.payload);
+    payload_pool->release_payload(payload);
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,72 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/DeltaReader.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+DeltaReader::DeltaReader(
+        const DdsTopic& topic,
+        const std::shared_ptr<IReader>& reader,
+        const std::shared_ptr<PayloadPool>& payload_pool)
+    : DecoratorReader(reader)
+    , decoder_(topic.topic_name(), payload_pool)
+{
+    // Do nothing
+}
+
+utils::ReturnCode DeltaReader::take(
+        std::unique_ptr<IRoutingData>& data) noexcept
+{
+    while (true)
+    {
+        utils::ReturnCode ret = reader_->take(data);
+        if (!ret)
+        {
+            return ret;
+        }
+
+        if (data->internal_type_discriminator() != INTERNAL_TOPIC_TYPE_RTPS)
+        {
+            return ret;
+        }
+
+        auto& rtps_data = dynamic_cast<RtpsPayloadData&>(*data);
+
+        Payload decoded;
+        bool error = false;
+        if (decoder_.decode(rtps_data, decoded, error))
+        {
+            replace_payload_(rtps_data, decoded);
+        }
+        else if (error)
+        {
+            // Discard the sample and take the next one (the decoder already reported it)
+            continue;
+        }
+
+        return ret;
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
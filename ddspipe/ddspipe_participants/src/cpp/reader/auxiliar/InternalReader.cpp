@@ -58,6 +58,12 @@ void InternalReader::simulate_data_reception(
     on_data_available_();
 }
 
+std::size_t InternalReader::pending_data() noexcept
+{
+    std::lock_guard<DataReceivedType> lock(data_to_send_);
+    return data_to_send_.size();
+}
+
 utils::ReturnCode InternalReader::take_nts_(
         std::unique_ptr<IRoutingData>& data) noexcept
 {
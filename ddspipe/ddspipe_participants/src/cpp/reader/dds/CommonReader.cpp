@@ -17,6 +17,7 @@
 #include <cpp_utils/math/math_extension.hpp>
 
 #include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 
 #include <ddspipe_participants/reader/dds/CommonReader.hpp>
@@ -111,7 +112,7 @@ CommonReader::CommonReader(
     , dds_subscriber_(nullptr)
     , reader_(nullptr)
 {
-    // Do nothing
+    topic_metrics_ = core::ProcessMetricsRegistry::get_instance()->topic_metrics(topic);
 }
 
 utils::ReturnCode CommonReader::take_nts_(
@@ -250,8 +251,22 @@ void CommonReader::fill_received_data_(
     // Store the new data that has arrived in the Track data
     // Get the writer guid
     data_to_fill.source_guid = detail::guid_from_instance_handle(info.publication_handle);
+    // Get sequence number in the writer
+    data_to_fill.sequence_number = info.sample_identity.sequence_number();
+    // Get the identity of the data in its original writer, sent by the proxy that forwarded it (if any)
+    if (info.related_sample_identity != fastrtps::rtps::SampleIdentity::unknown())
+    {
+        data_to_fill.origin_guid = info.related_sample_identity.writer_guid();
+        data_to_fill.origin_sequence_number = info.related_sample_identity.sequence_number();
+    }
+    else
+    {
+        data_to_fill.origin_guid = data_to_fill.source_guid;
+        data_to_fill.origin_sequence_number = data_to_fill.sequence_number;
+    }
     // Get source timestamp
     data_to_fill.source_timestamp = info.source_timestamp;
+    data_to_fill.reception_timestamp = info.reception_timestamp;
     // Get Participant receiver
     data_to_fill.participant_receiver = participant_id_;
 
@@ -19,6 +19,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 
 #include <ddspipe_participants/reader/rtps/CommonReader.hpp>
@@ -51,7 +52,7 @@ CommonReader::CommonReader(
     , topic_attributes_(topic_attributes)
     , reader_qos_(reader_qos)
 {
-    // Do nothing.
+    topic_metrics_ = core::ProcessMetricsRegistry::get_instance()->topic_metrics(topic);
 }
 
 CommonReader::~CommonReader()
@@ -204,8 +205,23 @@ void CommonReader::fill_received_data_(
     // Store the new data that has arrived in the Track data
     // Get the writer guid
     data_to_fill.source_guid = received_change.writerGUID;
+    // Get sequence number in the writer
+    data_to_fill.sequence_number = received_change.sequenceNumber;
+    // Get the identity of the data in its original writer, sent by the proxy that forwarded it (if any)
+    const fastrtps::rtps::SampleIdentity& origin = received_change.write_params.sample_identity();
+    if (origin != fastrtps::rtps::SampleIdentity::unknown())
+    {
+        data_to_fill.origin_guid = origin.writer_guid();
+        data_to_fill.origin_sequence_number = origin.sequence_number();
+    }
+    else
+    {
+        data_to_fill.origin_guid = data_to_fill.source_guid;
+        data_to_fill.origin_sequence_number = data_to_fill.sequence_number;
+    }
     // Get source timestamp
     data_to_fill.source_timestamp = received_change.sourceTimestamp;
+    data_to_fill.reception_timestamp = received_change.reader_info.receptionTimestamp;
     // Get Participant receiver
     data_to_fill.participant_receiver = participant_id_;
 
@@ -479,6 +495,11 @@ void CommonReader::on_sample_rejected(
     logInfo(DDSPIPE_RTPS_COMMONREADER_LISTENER,
             "Reader " << *this << " rejected a sample from " << change->writerGUID
                       << ". Reason: " << reason_str);
+
+    if (reason != eprosima::fastdds::dds::SampleRejectedStatusKind::NOT_REJECTED)
+    {
+        add_metric_(core::MetricKind::dropped_rejected);
+    }
 }
 
 utils::ReturnCode CommonReader::is_data_correct_(
@@ -0,0 +1,440 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/types/bundle/BundleEnvelope.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+namespace types {
+
+using namespace eprosima::ddspipe::core::types;
+
+const char* BundleEnvelope::TOPIC_NAME = "__ddsproxy_bundle";
+const char* BundleEnvelope::TYPE_NAME = "ddsproxy::BundleEnvelope";
+
+namespace {
+
+//! Header of every envelope: magic + version
+constexpr const std::uint8_t ENVELOPE_HEADER[] = {'D', 'P', 'B', 2};
+
+//! Size of the fixed fields of a sample record (without instance and payload)
+constexpr const std::uint32_t SAMPLE_RECORD_FIXED_SIZE =
+        1 /* kind */ + 4 /* topic id */ + 16 /* guid */ + 8 /* sequence number */ + 8 /* timestamp */ +
+        1 /* change kind */ + 1 /* has instance */ + 4 /* payload length */;
+
+//! Size of the fixed fields of an announcement record (without names)
+constexpr const std::uint32_t ANNOUNCEMENT_RECORD_FIXED_SIZE =
+        1 /* kind */ + 4 /* topic id */ + 1 /* flags */ + 2 /* name length */ + 2 /* type name length */;
+
+//! Size of an instance handle
+constexpr const std::uint32_t INSTANCE_SIZE = 16;
+
+//! Announcement flags
+constexpr const std::uint8_t FLAG_KEYED = 0x01;
+constexpr const std::uint8_t FLAG_RELIABLE = 0x02;
+constexpr const std::uint8_t FLAG_TRANSIENT_LOCAL = 0x04;
+constexpr const std::uint8_t FLAG_REQUIRED = 0x08;
+
+//! Sequential reader of a serialized envelope that fails (instead of overflowing) on malformed data
+class EnvelopeParser
+{
+public:
+
+    EnvelopeParser(
+            const std::uint8_t* data,
+            const std::uint32_t size)
+        : data_(data)
+        , size_(size)
+        , position_(0)
+    {
+    }
+
+    bool finished() const
+    {
+        return position_ >= size_;
+    }
+
+    bool read_u8(
+            std::uint8_t& value)
+    {
+        if (!has_(1))
+        {
+            return false;
+        }
+        value = data_[position_++];
+        return true;
+    }
+
+    bool read_u16(
+            std::uint16_t& value)
+    {
+        if (!has_(2))
+        {
+            return false;
+        }
+        value = static_cast<std::uint16_t>(data_[position_] | (data_[position_ + 1] << 8));
+        position_ += 2;
+        return true;
+    }
+
+    bool read_u32(
+            std::uint32_t& value)
+    {
+        if (!has_(4))
+        {
+            return false;
+        }
+        value = 0;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            value |= static_cast<std::uint32_t>(data_[position_ + i]) << (8 * i);
+        }
+        position_ += 4;
+        return true;
+    }
+
+    bool read_bytes(
+            std::uint8_t* destination,
+            const std::uint32_t size)
+    {
+        if (!has_(size))
+        {
+            return false;
+        }
+        std::memcpy(destination, data_ + position_, size);
+        position_ += size;
+        return true;
+    }
+
+protected:
+
+    bool has_(
+            const std::uint32_t size) const
+    {
+        return size <= size_ - position_;
+    }
+
+    const std::uint8_t* data_;
+    const std::uint32_t size_;
+    std::uint32_t position_;
+};
+
+} /* namespace */
+
+BundleEnvelope::BundleEnvelope()
+    : records_(0)
+{
+    clear();
+}
+
+DdsTopic BundleEnvelope::bundle_topic() noexcept
+{
+    DdsTopic topic;
+    topic.m_topic_name = TOPIC_NAME;
+    topic.type_name = TYPE_NAME;
+    topic.topic_qos.keyed.set_value(false);
+    topic.topic_qos.reliability_qos.set_value(ReliabilityKind::RELIABLE);
+    topic.topic_qos.durability_qos.set_value(DurabilityKind::VOLATILE);
+
+    return topic;
+}
+
+BundleEnvelope::TopicKey BundleEnvelope::topic_key(
+        const DdsTopic& topic) noexcept
+{
+    return TopicKey(topic.m_topic_name, topic.type_name);
+}
+
+std::uint32_t BundleEnvelope::sample_record_size(
+        const RtpsPayloadData& data) noexcept
+{
+    return SAMPLE_RECORD_FIXED_SIZE + (data.instanceHandle.isDefined() ? INSTANCE_SIZE : 0) + data.payload.length;
+}
+
+std::uint32_t BundleEnvelope::announcement_record_size(
+        const DdsTopic& topic) noexcept
+{
+    return ANNOUNCEMENT_RECORD_FIXED_SIZE + static_cast<std::uint16_t>(topic.m_topic_name.size()) +
+           static_cast<std::uint16_t>(topic.type_name.size());
+}
+
+void BundleEnvelope::add_sample(
+        const std::uint32_t topic_id,
+        const RtpsPayloadData& data)
+{
+    buffer_.reserve(buffer_.size() + sample_record_size(data));
+
+    write_u8_(RecordKind::sample_record);
+    write_u32_(topic_id);
+
+    // Source guid
+    write_bytes_(data.source_guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size);
+    write_bytes_(data.source_guid.entityId.value, fastrtps::rtps::EntityId_t::size);
+
+    // Sequence number in the source
+    write_u32_(static_cast<std::uint32_t>(data.sequence_number.high));
+    write_u32_(data.sequence_number.low);
+
+    // Source timestamp
+    write_u32_(static_cast<std::uint32_t>(data.source_timestamp.seconds()));
+    write_u32_(data.source_timestamp.fraction());
+
+    // Change kind and instance
+    write_u8_(static_cast<std::uint8_t>(data.kind));
+    if (data.instanceHandle.isDefined())
+    {
+        write_u8_(1);
+        for (unsigned int i = 0; i < INSTANCE_SIZE; ++i)
+        {
+            write_u8_(data.instanceHandle.value[i]);
+        }
+    }
+    else
+    {
+        write_u8_(0);
+    }
+
+    // Payload
+    write_u32_(data.payload.length);
+    write_bytes_(data.payload.data, data.payload.length);
+
+    ++records_;
+}
+
+void BundleEnvelope::add_announcement(
+        const std::uint32_t topic_id,
+        const DdsTopic& topic,
+        const bool required)
+{
+    std::uint8_t flags = 0;
+    flags |= topic.topic_qos.keyed ? FLAG_KEYED : 0;
+    flags |= topic.topic_qos.is_reliable() ? FLAG_RELIABLE : 0;
+    flags |= topic.topic_qos.is_transient_local() ? FLAG_TRANSIENT_LOCAL : 0;
+    flags |= required ? FLAG_REQUIRED : 0;
+
+    write_u8_(RecordKind::announcement_record);
+    write_u32_(topic_id);
+    write_u8_(flags);
+
+    write_u16_(static_cast<std::uint16_t>(topic.m_topic_name.size()));
+    write_bytes_(reinterpret_cast<const std::uint8_t*>(topic.m_topic_name.data()),
+            static_cast<std::uint16_t>(topic.m_topic_name.size()));
+
+    write_u16_(static_cast<std::uint16_t>(topic.type_name.size()));
+    write_bytes_(reinterpret_cast<const std::uint8_t*>(topic.type_name.data()),
+            static_cast<std::uint16_t>(topic.type_name.size()));
+
+    ++records_;
+}
+
+bool BundleEnvelope::empty() const noexcept
+{
+    return records_ == 0;
+}
+
+std::uint32_t BundleEnvelope::size() const noexcept
+{
+    return static_cast<std::uint32_t>(buffer_.size());
+}
+
+unsigned int BundleEnvelope::records() const noexcept
+{
+    return records_;
+}
+
+void BundleEnvelope::clear() noexcept
+{
+    buffer_.assign(std::begin(ENVELOPE_HEADER), std::end(ENVELOPE_HEADER));
+    records_ = 0;
+}
+
+const std::vector<std::uint8_t>& BundleEnvelope::buffer() const noexcept
+{
+    return buffer_;
+}
+
+bool BundleEnvelope::parse(
+        const Payload& envelope,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        const SampleCallback& on_sample,
+        const AnnouncementCallback& on_announcement) noexcept
+{
+    EnvelopeParser parser(envelope.data, envelope.length);
+
+    // Check header
+    std::uint8_t header[sizeof(ENVELOPE_HEADER)];
+    if (!parser.read_bytes(header, sizeof(header)) || std::memcmp(header, ENVELOPE_HEADER, sizeof(header)) != 0)
+    {
+        logWarning(DDSPIPE_BUNDLE, "Received a bundle envelope with an unknown header.");
+        return false;
+    }
+
+    while (!parser.finished())
+    {
+        std::uint8_t kind;
+        std::uint32_t topic_id;
+        if (!parser.read_u8(kind) || !parser.read_u32(topic_id))
+        {
+            return false;
+        }
+
+        if (kind == RecordKind::sample_record)
+        {
+            std::unique_ptr<RtpsPayloadData> data = std::make_unique<RtpsPayloadData>();
+
+            std::uint32_t sequence_high;
+            std::uint32_t sequence_low;
+            std::uint32_t seconds;
+            std::uint32_t fraction;
+            std::uint8_t change_kind;
+            std::uint8_t has_instance;
+            std::uint32_t length;
+
+            if (!parser.read_bytes(data->source_guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size) ||
+                    !parser.read_bytes(data->source_guid.entityId.value, fastrtps::rtps::EntityId_t::size) ||
+                    !parser.read_u32(sequence_high) ||
+                    !parser.read_u32(sequence_low) ||
+                    !parser.read_u32(seconds) ||
+                    !parser.read_u32(fraction) ||
+                    !parser.read_u8(change_kind) ||
+                    !parser.read_u8(has_instance))
+            {
+                return false;
+            }
+
+            data->sequence_number.high = static_cast<std::int32_t>(sequence_high);
+            data->sequence_number.low = sequence_low;
+            data->source_timestamp.seconds(static_cast<std::int32_t>(seconds));
+            data->source_timestamp.fraction(fraction);
+            data->kind = static_cast<ChangeKind>(change_kind);
+
+            if (has_instance)
+            {
+                for (unsigned int i = 0; i < INSTANCE_SIZE; ++i)
+                {
+                    std::uint8_t value;
+                    if (!parser.read_u8(value))
+                    {
+                        return false;
+                    }
+                    data->instanceHandle.value[i] = value;
+                }
+            }
+
+            if (!parser.read_u32(length))
+            {
+                return false;
+            }
+
+            if (length > 0)
+            {
+                if (!payload_pool->get_payload(length, data->payload))
+                {
+                    logDevError(DDSPIPE_BUNDLE, "Error getting Payload for bundled sample.");
+                    return false;
+                }
+                data->payload_owner = payload_pool.get();
+
+                if (!parser.read_bytes(data->payload.data, length))
+                {
+                    return false;
+                }
+                data->payload.length = length;
+            }
+
+            on_sample(topic_id, std::move(data));
+        }
+        else if (kind == RecordKind::announcement_record)
+        {
+            std::uint8_t flags;
+            std::uint16_t name_size;
+            std::uint16_t type_size;
+
+            if (!parser.read_u8(flags) || !parser.read_u16(name_size))
+            {
+                return false;
+            }
+
+            std::string name(name_size, '\0');
+            if (!parser.read_bytes(reinterpret_cast<std::uint8_t*>(&name[0]), name_size) ||
+                    !parser.read_u16(type_size))
+            {
+                return false;
+            }
+
+            std::string type(type_size, '\0');
+            if (!parser.read_bytes(reinterpret_cast<std::uint8_t*>(&type[0]), type_size))
+            {
+                return false;
+            }
+
+            DdsTopic topic;
+            topic.m_topic_name = name;
+            topic.type_name = type;
+            topic.topic_qos.keyed.set_value(flags & FLAG_KEYED);
+            topic.topic_qos.reliability_qos.set_value(
+                (flags & FLAG_RELIABLE) ? ReliabilityKind::RELIABLE : ReliabilityKind::BEST_EFFORT);
+            topic.topic_qos.durability_qos.set_value(
+                (flags & FLAG_TRANSIENT_LOCAL) ? DurabilityKind::TRANSIENT_LOCAL : DurabilityKind::VOLATILE);
+
+            on_announcement(topic_id, topic, (flags & FLAG_REQUIRED) != 0);
+        }
+        else
+        {
+            logWarning(DDSPIPE_BUNDLE, "Received a bundle record of unknown kind " << static_cast<int>(kind) << ".");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void BundleEnvelope::write_u8_(
+        const std::uint8_t value)
+{
+    buffer_.push_back(value);
+}
+
+void BundleEnvelope::write_u16_(
+        const std::uint16_t value)
+{
+    buffer_.push_back(static_cast<std::uint8_t>(value));
+    buffer_.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void BundleEnvelope::write_u32_(
+        const std::uint32_t value)
+{
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        buffer_.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+void BundleEnvelope::write_bytes_(
+        const std::uint8_t* data,
+        const std::uint32_t size)
+{
+    buffer_.insert(buffer_.end(), data, data + size);
+}
+
+} /* namespace types */
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
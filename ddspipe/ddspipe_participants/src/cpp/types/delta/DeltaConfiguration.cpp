@@ -0,0 +1,37 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_participants/types/delta/DeltaConfiguration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+namespace types {
+
+bool DeltaConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (enabled && keyframe_interval == 0)
+    {
+        error_msg << "Delta keyframe interval must be greater than 0. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace types */
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cpp_utils/Log.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
 
@@ -26,6 +27,7 @@ BaseWriter::BaseWriter(
     : participant_id_(participant_id)
     , max_tx_rate_(max_tx_rate)
     , enabled_(false)
+    , participant_metrics_(core::ProcessMetricsRegistry::get_instance()->participant_metrics(participant_id))
 {
     logDebug(DDSPIPE_BASEWRITER, "Creating Writer " << *this << ".");
 
@@ -75,11 +77,23 @@ utils::ReturnCode BaseWriter::write(
     {
         if (!should_send_sample_())
         {
+            add_metric_(core::MetricKind::dropped_rate_limit);
             return utils::ReturnCode::RETCODE_OK;
         }
         else
         {
-            return write_nts_(data);
+            utils::ReturnCode ret = write_nts_(data);
+
+            if (ret == utils::ReturnCode::RETCODE_OK)
+            {
+                add_written_metrics_(data);
+            }
+            else
+            {
+                add_metric_(core::MetricKind::dropped_writer_error);
+            }
+
+            return ret;
         }
 
     }
@@ -122,6 +136,40 @@ bool BaseWriter::should_send_sample_() noexcept
     return true;
 }
 
+void BaseWriter::add_metric_(
+        const core::MetricKind kind,
+        const std::uint64_t value /* = 1 */) noexcept
+{
+    if (participant_metrics_)
+    {
+        participant_metrics_->add(kind, value);
+    }
+
+    if (topic_metrics_)
+    {
+        topic_metrics_->add(kind, value);
+    }
+}
+
+void BaseWriter::add_written_metrics_(
+        const core::IRoutingData& data) noexcept
+{
+    if (!participant_metrics_ && !topic_metrics_)
+    {
+        return;
+    }
+
+    add_metric_(core::MetricKind::samples_out);
+    add_metric_(core::MetricKind::bytes_out, core::EntityMetrics::data_size(data));
+
+    // The latency of the topic is measured by the Track (end to end stage), so only the participant one is recorded
+    std::uint64_t latency_ns;
+    if (participant_metrics_ && core::EntityMetrics::data_latency(data, latency_ns))
+    {
+        participant_metrics_->record_latency(latency_ns);
+    }
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const BaseWriter& writer)
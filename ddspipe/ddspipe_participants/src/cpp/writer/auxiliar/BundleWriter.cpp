@@ -0,0 +1,46 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/writer/auxiliar/BundleWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+BundleWriter::BundleWriter(
+        const core::types::ParticipantId& participant_id,
+        const core::types::DdsTopic& topic,
+        const std::shared_ptr<Bundler>& bundler)
+    : BaseWriter(participant_id, topic.topic_qos.max_tx_rate)
+    , bundler_(bundler)
+    , topic_id_(bundler->topic_id(topic))
+{
+    logDebug(DDSPIPE_BUNDLE, "Creating Bundle Writer for topic " << topic << " with bundle id " << topic_id_ << ".");
+}
+
+utils::ReturnCode BundleWriter::write_nts_(
+        core::IRoutingData& data) noexcept
+{
+    auto& rtps_data = dynamic_cast<core::types::RtpsPayloadData&>(data);
+
+    return bundler_->add_sample(topic_id_, rtps_data);
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
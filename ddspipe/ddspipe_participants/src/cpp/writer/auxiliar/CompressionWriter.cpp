@@ -0,0 +1,59 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/writer/auxiliar/CompressionWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+CompressionWriter::CompressionWriter(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<core::IWriter>& writer,
+        const std::shared_ptr<PayloadCompressor>& compressor,
+        const std::shared_ptr<core::PayloadPool>& payload_pool)
+    : DecoratorWriter(participant_id, writer)
+    , compressor_(compressor)
+    , payload_pool_(payload_pool)
+{
+    // Do nothing
+}
+
+utils::ReturnCode CompressionWriter::write_nts_(
+        core::IRoutingData& data) noexcept
+{
+    auto& rtps_data = dynamic_cast<RtpsPayloadData&>(data);
+
+    RtpsPayloadData compressed_data;
+    if (!compressor_->compress(rtps_data.payload, compressed_data.payload))
+    {
+        // Under threshold or not compressible
+        return writer_->write(data);
+    }
+    compressed_data.payload_owner = payload_pool_.get();
+
+    copy_properties_(rtps_data, compressed_data);
+
+    return writer_->write(compressed_data);
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,67 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_participants/writer/auxiliar/DecoratorWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+DecoratorWriter::DecoratorWriter(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<core::IWriter>& writer)
+    : BaseWriter(participant_id)
+    , writer_(writer)
+{
+    // The decorated writer already counts the samples written
+    participant_metrics_.reset();
+}
+
+bool DecoratorWriter::can_accept() const noexcept
+{
+    return writer_->can_accept();
+}
+
+void DecoratorWriter::enable_() noexcept
+{
+    writer_->enable();
+}
+
+void DecoratorWriter::disable_() noexcept
+{
+    writer_->disable();
+}
+
+void DecoratorWriter::copy_properties_(
+        const RtpsPayloadData& src,
+        RtpsPayloadData& dst) noexcept
+{
+    dst.writer_qos = src.writer_qos;
+    dst.instanceHandle = src.instanceHandle;
+    dst.kind = src.kind;
+    dst.source_timestamp = src.source_timestamp;
+    dst.reception_timestamp = src.reception_timestamp;
+    dst.take_timestamp = src.take_timestamp;
+    dst.source_guid = src.source_guid;
+    dst.sequence_number = src.sequence_number;
+    dst.origin_guid = src.origin_guid;
+    dst.origin_sequence_number = src.origin_sequence_number;
+    dst.participant_receiver = src.participant_receiver;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,65 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/writer/auxiliar/DeltaWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+DeltaWriter::DeltaWriter(
+        const ParticipantId& participant_id,
+        const DdsTopic& topic,
+        const std::shared_ptr<core::IWriter>& writer,
+        const std::shared_ptr<core::PayloadPool>& payload_pool,
+        const std::uint32_t keyframe_interval)
+    : DecoratorWriter(participant_id, writer)
+    , encoder_(topic.topic_name(), payload_pool, keyframe_interval)
+    , payload_pool_(payload_pool)
+{
+    // Do nothing
+}
+
+utils::ReturnCode DeltaWriter::write_nts_(
+        core::IRoutingData& data) noexcept
+{
+    auto& rtps_data = dynamic_cast<RtpsPayloadData&>(data);
+
+    RtpsPayloadData encoded_data;
+    if (!encoder_.encode(rtps_data, encoded_data.payload))
+    {
+        // Disposals and unregistrations are sent as they are
+        return writer_->write(data);
+    }
+    encoded_data.payload_owner = payload_pool_.get();
+
+    copy_properties_(rtps_data, encoded_data);
+
+    utils::ReturnCode ret = writer_->write(encoded_data);
+    if (!ret)
+    {
+        // The receiver does not get this frame, so the next sample of the instance must be a keyframe
+        encoder_.discard(rtps_data.instanceHandle);
+    }
+
+    return ret;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
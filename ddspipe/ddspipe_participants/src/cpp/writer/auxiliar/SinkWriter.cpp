@@ -0,0 +1,149 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/writer/auxiliar/SinkWriter.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+SinkWriter::SinkWriter(
+        const DdsTopic& topic)
+    : topic_(topic)
+    , samples_(0)
+    , bytes_(0)
+{
+    logDebug(DDSPIPE_SINK, "Creating Sink Writer in topic " << topic_ << ".");
+}
+
+SinkStatistics SinkWriter::statistics() const noexcept
+{
+    SinkStatistics statistics;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    statistics.samples = samples_;
+    statistics.bytes = bytes_;
+    statistics.latency = latency_.snapshot();
+
+    if (samples_ > 0)
+    {
+        statistics.duration = std::chrono::duration<double>(last_reception_ - first_reception_).count();
+    }
+
+    for (const auto& source : sources_)
+    {
+        statistics.lost += source.second.statistics.lost;
+        statistics.duplicates += source.second.statistics.duplicates;
+        statistics.out_of_order += source.second.statistics.out_of_order;
+        statistics.sources.emplace(source.first, source.second.statistics);
+    }
+
+    return statistics;
+}
+
+const DdsTopic& SinkWriter::topic() const noexcept
+{
+    return topic_;
+}
+
+utils::ReturnCode SinkWriter::write(
+        core::IRoutingData& data) noexcept
+{
+    const auto reception = std::chrono::steady_clock::now();
+
+    DataTime now;
+    DataTime::now(now);
+
+    auto& rtps_data = dynamic_cast<RtpsPayloadData&>(data);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (samples_ == 0)
+    {
+        first_reception_ = reception;
+    }
+    last_reception_ = reception;
+
+    samples_++;
+    bytes_ += rtps_data.payload.length;
+
+    if (rtps_data.source_timestamp != DataTime() && now.to_ns() >= rtps_data.source_timestamp.to_ns())
+    {
+        latency_.record(static_cast<std::uint64_t>(now.to_ns() - rtps_data.source_timestamp.to_ns()));
+    }
+
+    SourceState& source = sources_[rtps_data.source_guid];
+    source.statistics.samples++;
+
+    if (rtps_data.sequence_number != SequenceNumber() && rtps_data.sequence_number != SequenceNumber::unknown())
+    {
+        register_sequence_number_(source, rtps_data.sequence_number.to64long());
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+void SinkWriter::register_sequence_number_(
+        SourceState& source,
+        const std::uint64_t sequence_number) noexcept
+{
+    if (source.window == 0)
+    {
+        // First sample from this source, the ones before it are not lost
+        source.highest = sequence_number;
+        source.window = 1;
+        return;
+    }
+
+    if (sequence_number > source.highest)
+    {
+        const std::uint64_t shift = sequence_number - source.highest;
+
+        source.statistics.lost += shift - 1;
+        source.window = shift < SEQUENCE_WINDOW ? (source.window << shift) | 1 : 1;
+        source.highest = sequence_number;
+        return;
+    }
+
+    const std::uint64_t offset = source.highest - sequence_number;
+
+    if (offset < SEQUENCE_WINDOW && (source.window >> offset) & 1u)
+    {
+        source.statistics.duplicates++;
+        return;
+    }
+
+    if (offset < SEQUENCE_WINDOW)
+    {
+        source.window |= std::uint64_t(1) << offset;
+    }
+
+    // It was counted as lost when a greater sequence number arrived
+    source.statistics.out_of_order++;
+    if (source.statistics.lost > 0)
+    {
+        source.statistics.lost--;
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -21,6 +21,8 @@
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/time/time_utils.hpp>
 
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
+
 #include <ddspipe_participants/efficiency/cache_change/CacheChangePool.hpp>
 #include <ddspipe_participants/writer/dds/CommonWriter.hpp>
 #include <ddspipe_participants/types/dds/ProxyCacheChange.hpp>
@@ -98,7 +100,7 @@ CommonWriter::CommonWriter(
     , dds_publisher_(nullptr)
     , writer_(nullptr)
 {
-    // Do nothing
+    topic_metrics_ = core::ProcessMetricsRegistry::get_instance()->topic_metrics(topic);
 }
 
 // Specific enable/disable do not need to be implemented
@@ -65,6 +65,11 @@ utils::ReturnCode SimpleWriter::fill_to_send_data_(
     {
         to_send_params.related_sample_identity(rpc_data.write_params.get_reference().related_sample_identity());
     }
+    else
+    {
+        // The related sample identity of RPC data identifies the request, not the original writer
+        to_send_params.related_sample_identity(fastrtps::rtps::SampleIdentity::unknown());
+    }
 
     return utils::ReturnCode::RETCODE_OK;
 }
@@ -21,6 +21,8 @@
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/time/time_utils.hpp>
 
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
+
 #include <ddspipe_participants/efficiency/cache_change/CacheChangePool.hpp>
 #include <ddspipe_participants/writer/rtps/CommonWriter.hpp>
 #include <ddspipe_participants/writer/rtps/filter/RepeaterDataFilter.hpp>
@@ -61,7 +63,7 @@ CommonWriter::CommonWriter(
     , writer_qos_(writer_qos)
     , pool_configuration_(pool_configuration)
 {
-    // Do nothing
+    topic_metrics_ = core::ProcessMetricsRegistry::get_instance()->topic_metrics(topic);
 }
 
 CommonWriter::~CommonWriter()
@@ -125,6 +127,24 @@ void CommonWriter::onWriterMatched(
     }
 }
 
+bool CommonWriter::can_accept() const noexcept
+{
+    if (!rtps_writer_ || !rtps_history_)
+    {
+        return true;
+    }
+
+    std::lock_guard<fastrtps::RecursiveTimedMutex> lock(*rtps_history_->getMutex());
+
+    if (!rtps_history_->isFull() || rtps_history_->getHistorySize() == 0)
+    {
+        return true;
+    }
+
+    // The history is full, so the oldest change is evicted in the next write: only harmless if already acknowledged
+    return rtps_writer_->is_acked_by_all(*rtps_history_->changesBegin());
+}
+
 void CommonWriter::onWriterChangeReceivedByAll(
         fastrtps::rtps::RTPSWriter* /*writer*/,
         fastrtps::rtps::CacheChange_t* change)
@@ -247,6 +267,16 @@ utils::ReturnCode CommonWriter::fill_to_send_data_(
     // Set source time stamp to be the original one
     to_send_params.source_timestamp(data.source_timestamp);
 
+    // Send the identity of the data in its original writer, so the proxies receiving it through several routes can
+    // tell the copies apart
+    if (data.origin_guid.is_valid() && data.origin_sequence_number != fastrtps::rtps::SequenceNumber_t::unknown())
+    {
+        fastrtps::rtps::SampleIdentity origin;
+        origin.writer_guid(data.origin_guid);
+        origin.sequence_number(data.origin_sequence_number);
+        to_send_params.related_sample_identity(origin);
+    }
+
     return utils::ReturnCode::RETCODE_OK;
 }
 
@@ -66,6 +66,20 @@ MultiWriter::~MultiWriter()
             participant_id_ << " for topic " << topic_);
 }
 
+bool MultiWriter::can_accept() const noexcept
+{
+    // The writer of the next message is not known, so any congested writer makes this one congested
+    std::shared_lock<WritersMapType> lock(writers_map_);
+    for (const auto& writer : writers_map_)
+    {
+        if (!writer.second->can_accept())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void MultiWriter::enable_() noexcept
 {
     std::shared_lock<WritersMapType> lock(writers_map_);
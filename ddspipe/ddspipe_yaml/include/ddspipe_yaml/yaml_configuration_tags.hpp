@@ -51,6 +51,10 @@ constexpr const char* QOS_KEYED_TAG("keyed"); //! Kind of a topic (with or witho
 constexpr const char* QOS_MAX_TX_RATE_TAG("max-tx-rate"); //! Topic specific max transmission rate
 constexpr const char* QOS_MAX_RX_RATE_TAG("max-rx-rate"); //! Topic specific max reception rate
 constexpr const char* QOS_DOWNSAMPLING_TAG("downsampling"); //! Topic specific downsampling factor
+constexpr const char* QOS_CONFLATE_TAG("conflate"); //! Only forward the latest pending sample of each instance
+constexpr const char* QOS_MAX_AGE_TAG("max-age"); //! Topic specific max age of a sample to be forwarded
+constexpr const char* QOS_DEDUPLICATION_TAG("deduplication"); //! Discard samples received through redundant routes
+constexpr const char* QOS_CONTENT_FILTER_TAG("content-filter"); //! Only forward samples whose fields match an expression
 
 // Participant related tags
 constexpr const char* PARTICIPANT_KIND_TAG("kind");   //! Participant Kind
@@ -64,6 +68,20 @@ constexpr const char* ECHO_DATA_TAG("data");            //! Echo Data received
 constexpr const char* ECHO_DISCOVERY_TAG("discovery");  //! Echo Discovery received
 constexpr const char* ECHO_VERBOSE_TAG("verbose");      //! Echo in verbose mode
 
+// Generator related tags
+constexpr const char* GENERATOR_TOPIC_PREFIX_TAG("topic-prefix"); //! Prefix of the name of the topics generated
+constexpr const char* GENERATOR_TYPE_TAG("type"); //! Type name of the topics generated
+constexpr const char* GENERATOR_TOPICS_TAG("topics"); //! Number of topics generated
+constexpr const char* GENERATOR_RATE_TAG("rate"); //! Samples generated per second in each topic
+constexpr const char* GENERATOR_KEYS_TAG("keys"); //! Number of instances written in each topic
+constexpr const char* GENERATOR_SIZE_DISTRIBUTION_TAG("size-distribution"); //! Distribution of the payload sizes
+constexpr const char* GENERATOR_PAYLOAD_SIZE_TAG("payload-size"); //! Size (mean size if not fixed) of the payloads
+constexpr const char* GENERATOR_MAX_PAYLOAD_SIZE_TAG("max-payload-size"); //! Maximum size of the payloads
+constexpr const char* GENERATOR_MAX_PENDING_TAG("max-pending"); //! Samples pending to be forwarded before skipping
+
+// Sink related tags
+constexpr const char* SINK_VERBOSE_TAG("verbose"); //! Report the statistics of every source writer
+
 // RTPS related tags
 
 // Transport related tags
@@ -92,6 +110,22 @@ constexpr const char* LISTENING_ADDRESSES_TAG("listening-addresses"); //! TODO:
 constexpr const char* CONNECTION_ADDRESSES_TAG("connection-addresses"); //! TODO: add comment
 constexpr const char* COLLECTION_ADDRESSES_TAG("addresses"); //! TODO: add comment
 
+// Compression related tags
+constexpr const char* COMPRESSION_TAG("compression"); //! Compression of the payloads exchanged with the remote proxy
+constexpr const char* COMPRESSION_CODEC_TAG("codec"); //! Codec used to compress the payloads
+constexpr const char* COMPRESSION_THRESHOLD_TAG("threshold"); //! Payloads smaller than this size are not compressed
+constexpr const char* COMPRESSION_LEVEL_TAG("level"); //! Compression level of the codec
+constexpr const char* COMPRESSION_MAX_PAYLOAD_SIZE_TAG("max-payload-size"); //! Max size of a payload decompressed
+
+// Delta related tags
+constexpr const char* DELTA_TAG("delta"); //! Send keyed topics as deltas against the previous sample of each instance
+constexpr const char* DELTA_KEYFRAME_INTERVAL_TAG("keyframe-interval"); //! Samples of an instance between two keyframes
+
+// Bundle related tags
+constexpr const char* BUNDLE_TAG("bundle"); //! Pack the samples of every topic into envelopes of a single topic
+constexpr const char* BUNDLE_MAX_SIZE_TAG("max-size"); //! Maximum size of an envelope [bytes]
+constexpr const char* BUNDLE_MAX_DELAY_TAG("max-delay"); //! Maximum time a sample waits in an envelope [ms]
+
 // TLS related tags
 constexpr const char* TLS_TAG("tls"); //! TLS configuration tag
 constexpr const char* TLS_CA_TAG("ca"); //! Certificate Authority Certificate
@@ -139,9 +173,25 @@ constexpr const char* TOPIC_ROUTES_TAG("topic-routes"); // Topic specific forwar
 constexpr const char* SPECS_TAG("specs"); //! Specs options for DDS Proxy configuration
 constexpr const char* SPECS_QOS_TAG("qos"); //! Global Topic QoS
 constexpr const char* NUMBER_THREADS_TAG("threads"); //! Number of threads to configure the thread pool
+constexpr const char* THREADS_AUTOSCALING_TAG("threads-autoscaling"); //! Adapt the number of threads to the load
+constexpr const char* THREADS_AUTOSCALING_MIN_TAG("min"); //! Minimum number of threads when autoscaling
+constexpr const char* THREADS_AUTOSCALING_MAX_TAG("max"); //! Maximum number of threads when autoscaling
+constexpr const char* THREADS_AUTOSCALING_PERIOD_TAG("period"); //! Time between autoscaling evaluations [ms]
+constexpr const char* THREADS_AUTOSCALING_SCALE_UP_TAG("scale-up-utilization"); //! Utilization to add threads
+constexpr const char* THREADS_AUTOSCALING_SCALE_DOWN_TAG("scale-down-utilization"); //! Utilization to remove threads
 constexpr const char* WAIT_ALL_ACKED_TIMEOUT_TAG("wait-all-acked-timeout"); //! Wait for a maximum of *wait-all-acked-timeout* ms until all msgs sent by reliable writers are acknowledged by their matched readers
 constexpr const char* REMOVE_UNUSED_ENTITIES_TAG("remove-unused-entities"); //! Dynamically create and delete entities and tracks.
 constexpr const char* DISCOVERY_TRIGGER_TAG("discovery-trigger"); //! Make the trigger of the DDS Pipe callbacks configurable.
+constexpr const char* BRIDGE_CREATION_THREADS_TAG("bridge-creation-threads"); //! Number of threads that create the bridges
+constexpr const char* DISCOVERY_SNAPSHOT_TAG("discovery-snapshot"); //! Persist the topics discovered to warm restart
+constexpr const char* DISCOVERY_SNAPSHOT_FILE_TAG("file"); //! File where the discovery snapshot is persisted
+constexpr const char* DISCOVERY_SNAPSHOT_PERIOD_TAG("period"); //! Time between discovery snapshots [ms]
+constexpr const char* DISCOVERY_SNAPSHOT_RECONCILE_TIMEOUT_TAG("reconcile-timeout"); //! Time to rediscover the snapshot topics [ms]
+constexpr const char* IDLE_BRIDGE_TTL_TAG("idle-bridge-ttl"); //! Time after which the bridges of idle topics are destroyed [ms]
+constexpr const char* MONITOR_TAG("monitor"); //! Publish the statistics of the proxy in a topic
+constexpr const char* MONITOR_PERIOD_TAG("period"); //! Time between statistics samples [ms]
+constexpr const char* MONITOR_TOPIC_TAG("topic"); //! Name of the topic of the statistics
+constexpr const char* MONITOR_ID_TAG("id"); //! Id of the proxy in the statistics
 
 //use related tag
 constexpr const char* MASTER_FLAG_TAG("master_flag");     //!Though create the bridge , don't use it until other proxy is bad
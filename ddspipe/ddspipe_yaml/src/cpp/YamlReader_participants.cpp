@@ -26,6 +26,8 @@
 
 #include <ddspipe_participants/types/address/Address.hpp>
 #include <ddspipe_participants/types/address/DiscoveryServerConnectionAddress.hpp>
+#include <ddspipe_participants/types/compression/CompressionConfiguration.hpp>
+#include <ddspipe_participants/types/delta/DeltaConfiguration.hpp>
 #include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
 
 #include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
@@ -33,7 +35,9 @@
 #include <ddspipe_participants/configuration/XmlParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/EchoParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/SinkParticipantConfiguration.hpp>
 
 #include <ddspipe_yaml/Yaml.hpp>
 #include <ddspipe_yaml/YamlReader.hpp>
@@ -116,6 +120,123 @@ participants::EchoParticipantConfiguration YamlReader::get(
     return object;
 }
 
+//////////////////////////////////
+// GeneratorParticipantConfiguration
+template <>
+DDSPIPE_YAML_DllAPI
+void YamlReader::fill(
+        participants::GeneratorParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // topic prefix optional
+    if (is_tag_present(yml, GENERATOR_TOPIC_PREFIX_TAG))
+    {
+        object.topic_prefix = get<std::string>(yml, GENERATOR_TOPIC_PREFIX_TAG, version);
+    }
+
+    // type optional
+    if (is_tag_present(yml, GENERATOR_TYPE_TAG))
+    {
+        object.type_name = get<std::string>(yml, GENERATOR_TYPE_TAG, version);
+    }
+
+    // topics optional
+    if (is_tag_present(yml, GENERATOR_TOPICS_TAG))
+    {
+        object.topics = get_positive_int(yml, GENERATOR_TOPICS_TAG);
+    }
+
+    // rate optional
+    if (is_tag_present(yml, GENERATOR_RATE_TAG))
+    {
+        object.rate = get_positive_double(yml, GENERATOR_RATE_TAG);
+    }
+
+    // keys optional
+    if (is_tag_present(yml, GENERATOR_KEYS_TAG))
+    {
+        object.keys = get_nonnegative_int(yml, GENERATOR_KEYS_TAG);
+    }
+
+    // size distribution optional
+    if (is_tag_present(yml, GENERATOR_SIZE_DISTRIBUTION_TAG))
+    {
+        const std::string distribution = get<std::string>(yml, GENERATOR_SIZE_DISTRIBUTION_TAG, version);
+
+        std::string distribution_lower = distribution;
+        utils::to_lowercase(distribution_lower);
+
+        if (!participants::string_to_enumeration(distribution_lower, object.size_distribution))
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "The payload size distribution " << distribution << " is not valid.");
+        }
+    }
+
+    // payload size optional
+    if (is_tag_present(yml, GENERATOR_PAYLOAD_SIZE_TAG))
+    {
+        object.payload_size = get_positive_int(yml, GENERATOR_PAYLOAD_SIZE_TAG);
+    }
+
+    // max payload size optional
+    if (is_tag_present(yml, GENERATOR_MAX_PAYLOAD_SIZE_TAG))
+    {
+        object.max_payload_size = get_positive_int(yml, GENERATOR_MAX_PAYLOAD_SIZE_TAG);
+    }
+
+    // max pending optional
+    if (is_tag_present(yml, GENERATOR_MAX_PENDING_TAG))
+    {
+        object.max_pending = get_nonnegative_int(yml, GENERATOR_MAX_PENDING_TAG);
+    }
+}
+
+template <>
+DDSPIPE_YAML_DllAPI
+participants::GeneratorParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    participants::GeneratorParticipantConfiguration object;
+    fill<participants::GeneratorParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+//////////////////////////////////
+// SinkParticipantConfiguration
+template <>
+DDSPIPE_YAML_DllAPI
+void YamlReader::fill(
+        participants::SinkParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // verbose optional
+    if (is_tag_present(yml, SINK_VERBOSE_TAG))
+    {
+        object.verbose = get<bool>(yml, SINK_VERBOSE_TAG, version);
+    }
+}
+
+template <>
+DDSPIPE_YAML_DllAPI
+participants::SinkParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    participants::SinkParticipantConfiguration object;
+    fill<participants::SinkParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
 //////////////////////////////////
 // SimpleParticipantConfiguration
 template <>
@@ -221,6 +342,24 @@ void YamlReader::fill(
             version);
     }
 
+    // Optional compression
+    if (YamlReader::is_tag_present(yml, COMPRESSION_TAG))
+    {
+        YamlReader::fill<CompressionConfiguration>(
+            object.compression,
+            YamlReader::get_value_in_tag(yml, COMPRESSION_TAG),
+            version);
+    }
+
+    // Optional delta encoding
+    if (YamlReader::is_tag_present(yml, DELTA_TAG))
+    {
+        YamlReader::fill<DeltaConfiguration>(
+            object.delta,
+            YamlReader::get_value_in_tag(yml, DELTA_TAG),
+            version);
+    }
+
     // NOTE: The only field that change regarding the version is the GuidPrefix.
     switch (version)
     {
@@ -289,6 +428,49 @@ void YamlReader::fill(
             version);
     }
 
+    // Optional compression
+    if (YamlReader::is_tag_present(yml, COMPRESSION_TAG))
+    {
+        YamlReader::fill<CompressionConfiguration>(
+            object.compression,
+            YamlReader::get_value_in_tag(yml, COMPRESSION_TAG),
+            version);
+    }
+
+    // Optional delta encoding
+    if (YamlReader::is_tag_present(yml, DELTA_TAG))
+    {
+        YamlReader::fill<DeltaConfiguration>(
+            object.delta,
+            YamlReader::get_value_in_tag(yml, DELTA_TAG),
+            version);
+    }
+
+    // Optional bundle (either a boolean or a map with the envelope limits)
+    if (YamlReader::is_tag_present(yml, BUNDLE_TAG))
+    {
+        Yaml bundle_yml = YamlReader::get_value_in_tag(yml, BUNDLE_TAG);
+
+        if (bundle_yml.IsMap())
+        {
+            object.bundle = true;
+
+            if (YamlReader::is_tag_present(bundle_yml, BUNDLE_MAX_SIZE_TAG))
+            {
+                object.bundle_max_size = YamlReader::get_positive_int(bundle_yml, BUNDLE_MAX_SIZE_TAG);
+            }
+
+            if (YamlReader::is_tag_present(bundle_yml, BUNDLE_MAX_DELAY_TAG))
+            {
+                object.bundle_max_delay = YamlReader::get_positive_int(bundle_yml, BUNDLE_MAX_DELAY_TAG);
+            }
+        }
+        else
+        {
+            object.bundle = YamlReader::get<bool>(yml, BUNDLE_TAG, version);
+        }
+    }
+
     // Optional Repeater
     if (YamlReader::is_tag_present(yml, IS_REPEATER_TAG))
     {
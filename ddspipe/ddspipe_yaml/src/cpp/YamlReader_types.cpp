@@ -21,6 +21,7 @@
 #include <cpp_utils/utils.hpp>
 #include <cpp_utils/memory/Heritable.hpp>
 
+#include <ddspipe_core/communication/dds/ContentFilterRegistry.hpp>
 #include <ddspipe_core/types/dds/CustomTransport.hpp>
 #include <ddspipe_core/types/dds/DomainId.hpp>
 #include <ddspipe_core/types/dds/GuidPrefix.hpp>
@@ -31,6 +32,8 @@
 
 #include <ddspipe_participants/types/address/Address.hpp>
 #include <ddspipe_participants/types/address/DiscoveryServerConnectionAddress.hpp>
+#include <ddspipe_participants/types/compression/CompressionConfiguration.hpp>
+#include <ddspipe_participants/types/delta/DeltaConfiguration.hpp>
 #include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
 
 #include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
@@ -426,6 +429,47 @@ void YamlReader::fill(
     {
         object.downsampling.set_value(get_positive_int(yml, QOS_DOWNSAMPLING_TAG));
     }
+
+    // Conflate optional
+    if (is_tag_present(yml, QOS_CONFLATE_TAG))
+    {
+        object.conflate.set_value(get<bool>(yml, QOS_CONFLATE_TAG, version));
+    }
+
+    // Max Age optional
+    if (is_tag_present(yml, QOS_MAX_AGE_TAG))
+    {
+        object.max_age.set_value(get_nonnegative_float(yml, QOS_MAX_AGE_TAG));
+    }
+
+    // Deduplication optional
+    if (is_tag_present(yml, QOS_DEDUPLICATION_TAG))
+    {
+        const std::string deduplication = get<std::string>(yml, QOS_DEDUPLICATION_TAG, version);
+
+        std::string deduplication_caps = deduplication;
+        utils::to_uppercase(deduplication_caps);
+
+        DeduplicationKind deduplication_kind;
+        if (!string_to_enumeration(deduplication_caps, deduplication_kind))
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "The deduplication " << deduplication << " is not valid.");
+        }
+
+        object.deduplication.set_value(deduplication_kind);
+    }
+
+    // Content filter optional
+    if (is_tag_present(yml, QOS_CONTENT_FILTER_TAG))
+    {
+        const std::string content_filter = get<std::string>(yml, QOS_CONTENT_FILTER_TAG, version);
+
+        // Parse the expression once, so the bridges only compile it (throws ConfigurationException if malformed)
+        core::ProcessContentFilterRegistry::get_instance()->expression(content_filter);
+
+        object.content_filter.set_value(content_filter);
+    }
 }
 
 /************************
@@ -636,6 +680,103 @@ TlsConfiguration YamlReader::get(
     return object;
 }
 
+/***************************
+* COMPRESSION CONFIGURATION *
+***************************/
+
+template <>
+DDSPIPE_YAML_DllAPI
+void YamlReader::fill(
+        CompressionConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Optional codec
+    if (is_tag_present(yml, COMPRESSION_CODEC_TAG))
+    {
+        const std::string codec = get<std::string>(yml, COMPRESSION_CODEC_TAG, version);
+
+        std::string codec_lower = codec;
+        utils::to_lowercase(codec_lower);
+
+        CompressionKind kind;
+        if (!string_to_enumeration(codec_lower, kind))
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "The compression codec " << codec << " is not valid.");
+        }
+
+        object.kind = kind;
+    }
+
+    // Optional threshold
+    if (is_tag_present(yml, COMPRESSION_THRESHOLD_TAG))
+    {
+        object.threshold = get_nonnegative_int(yml, COMPRESSION_THRESHOLD_TAG);
+    }
+
+    // Optional level
+    if (is_tag_present(yml, COMPRESSION_LEVEL_TAG))
+    {
+        object.level = get_positive_int(yml, COMPRESSION_LEVEL_TAG);
+    }
+
+    // Optional max payload size
+    if (is_tag_present(yml, COMPRESSION_MAX_PAYLOAD_SIZE_TAG))
+    {
+        object.max_payload_size = get_positive_int(yml, COMPRESSION_MAX_PAYLOAD_SIZE_TAG);
+    }
+}
+
+template <>
+DDSPIPE_YAML_DllAPI
+CompressionConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    CompressionConfiguration object;
+    fill<CompressionConfiguration>(object, yml, version);
+    return object;
+}
+
+/*********************
+* DELTA CONFIGURATION *
+*********************/
+
+template <>
+DDSPIPE_YAML_DllAPI
+void YamlReader::fill(
+        DeltaConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Either a boolean or a map with the keyframe interval
+    if (!yml.IsMap())
+    {
+        object.enabled = get<bool>(yml, version);
+        return;
+    }
+
+    object.enabled = true;
+
+    // Optional keyframe interval
+    if (is_tag_present(yml, DELTA_KEYFRAME_INTERVAL_TAG))
+    {
+        object.keyframe_interval = get_positive_int(yml, DELTA_KEYFRAME_INTERVAL_TAG);
+    }
+}
+
+template <>
+DDSPIPE_YAML_DllAPI
+DeltaConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    DeltaConfiguration object;
+    fill<DeltaConfiguration>(object, yml, version);
+    return object;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const YamlReaderVersion& version)
@@ -0,0 +1,77 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MonitorConfiguration.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsproxy_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+/**
+ * Configuration of the statistics that the DDS Proxy publishes about itself.
+ *
+ * Every \c period a \c ProxyStatistics sample is introduced in \c topic_name as if it had been received from the
+ * network, so it is forwarded to every participant like any other topic.
+ */
+struct MonitorConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPROXY_CORE_DllAPI MonitorConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSPROXY_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    DDSPROXY_CORE_DllAPI bool operator ==(
+            const MonitorConfiguration& other) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether the statistics are published
+    bool enabled = false;
+
+    //! Time between two statistics samples [ms]
+    unsigned int period = 1000;
+
+    //! Name of the topic where the statistics are published
+    std::string topic_name = "ddsproxy/statistics";
+
+    //! Id of this proxy in the statistics, to tell apart the proxies of every site
+    std::string proxy_id = "ddsproxy";
+};
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
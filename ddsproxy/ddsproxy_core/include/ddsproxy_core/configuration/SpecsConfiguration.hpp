@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <set>
+#include <string>
 
 #include <cpp_utils/Formatter.hpp>
 
@@ -23,6 +24,8 @@
 #include <ddspipe_core/configuration/IConfiguration.hpp>
 #include <ddspipe_core/types/dds/TopicQoS.hpp>
 
+#include <ddsproxy_core/configuration/MonitorConfiguration.hpp>
+#include <ddsproxy_core/configuration/ThreadAutoscalingConfiguration.hpp>
 #include <ddsproxy_core/library/library_dll.h>
 
 namespace eprosima {
@@ -56,6 +59,27 @@ struct SpecsConfiguration : public ddspipe::core::IConfiguration
 
     unsigned int number_of_threads = 12;
 
+    //! Policy to adapt the number of threads to the load (\c number_of_threads is the initial one)
+    ThreadAutoscalingConfiguration thread_autoscaling{};
+
+    //! Statistics published by the DDS Proxy about itself
+    MonitorConfiguration monitor{};
+
+    //! Number of threads that create the bridges (and their entities) of the topics discovered (0 = one per core)
+    unsigned int bridge_creation_threads = 0;
+
+    //! File where the topics discovered are persisted, to create their bridges on startup (empty to disable)
+    std::string discovery_snapshot_file{};
+
+    //! Time between two snapshots of the topics discovered [ms]
+    unsigned int discovery_snapshot_period = 5000;
+
+    //! Time after startup after which the snapshot topics that have not been discovered again are removed [ms]
+    unsigned int discovery_snapshot_reconcile_timeout = 30000;
+
+    //! Time without samples nor relevant endpoints after which the bridge of a topic is destroyed [ms] (0 = never)
+    unsigned int idle_bridge_ttl = 0;
+
     /**
      * @brief Whether readers that aren't connected to any writers should be deleted.
      *
@@ -0,0 +1,83 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadAutoscalingConfiguration.hpp
+ */
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsproxy_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+/**
+ * Configuration of the policy that adapts the number of threads of the Thread Pool to its load.
+ *
+ * Every \c period the utilization of the threads (time executing tasks over time available) and the tasks waiting
+ * are sampled. The pool grows when there are more tasks waiting than threads or the utilization is over
+ * \c scale_up_utilization , and shrinks one thread at a time when it is idle (no tasks waiting and utilization under
+ * \c scale_down_utilization ) for several periods in a row.
+ */
+struct ThreadAutoscalingConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPROXY_CORE_DllAPI ThreadAutoscalingConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSPROXY_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    DDSPROXY_CORE_DllAPI bool operator ==(
+            const ThreadAutoscalingConfiguration& other) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether the number of threads is adapted to the load
+    bool enabled = false;
+
+    //! Minimum number of threads
+    unsigned int min_threads = 1;
+
+    //! Maximum number of threads
+    unsigned int max_threads = 12;
+
+    //! Time between two evaluations of the load [ms]
+    unsigned int period = 1000;
+
+    //! Utilization (0 to 1) over which threads are added
+    double scale_up_utilization = 0.8;
+
+    //! Utilization (0 to 1) under which threads are removed
+    double scale_down_utilization = 0.3;
+};
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
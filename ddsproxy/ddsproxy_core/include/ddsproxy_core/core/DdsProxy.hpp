@@ -23,8 +23,11 @@
 #include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
 #include <ddspipe_core/core/DdsPipe.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
 
 #include <ddsproxy_core/core/ParticipantFactory.hpp>
+#include <ddsproxy_core/core/ProxyMonitor.hpp>
+#include <ddsproxy_core/core/ThreadPoolAutoscaler.hpp>
 #include <ddsproxy_core/configuration/DdsProxyConfiguration.hpp>
 #include <ddsproxy_core/library/library_dll.h>
 
@@ -101,6 +104,15 @@ public:
      */
     DDSPROXY_CORE_DllAPI utils::ReturnCode stop() noexcept;
 
+    /**
+     * @brief Current forwarding metrics of the DDS Proxy
+     *
+     * Topic and participant counters are process wide, so they keep their values across configuration reloads.
+     *
+     * @note Thread safe
+     */
+    DDSPROXY_CORE_DllAPI ddspipe::core::MetricsSnapshot metrics() const noexcept;
+
 protected:
 
     /**
@@ -111,6 +123,26 @@ protected:
      */
     void init_participants_();
 
+    /**
+     * @brief Apply the number of threads or the autoscaling policy of \c advanced_options to the Thread Pool.
+     *
+     * @param [in] advanced_options : new advanced configuration
+     *
+     * @return whether the Thread Pool configuration has changed
+     */
+    bool reload_thread_pool_(
+            const SpecsConfiguration& advanced_options);
+
+    /**
+     * @brief Add the monitor topic to the builtin topics of \c configuration , if the monitor is enabled.
+     *
+     * The monitor configuration is not reloadable, so the topic of the current one is always added.
+     */
+    void add_monitor_topic_(
+            ddspipe::core::DdsPipeConfiguration& configuration) const;
+
+    //! Create the participant that introduces the statistics of the DDS Proxy, if the monitor is enabled
+    void init_monitor_participant_();
 
     DdsProxyConfiguration configuration_;
 
@@ -127,6 +159,15 @@ protected:
     std::unique_ptr<ddspipe::core::DdsPipe> ddspipe_;
 
     ParticipantFactory participant_factory_;
+
+    //! Resizes \c thread_pool_ according to its load, if autoscaling is enabled
+    std::unique_ptr<ThreadPoolAutoscaler> thread_pool_autoscaler_;
+
+    //! Reader of the monitor participant, where the statistics are introduced (only if the monitor is enabled)
+    std::shared_ptr<ddspipe::participants::InternalReader> monitor_reader_;
+
+    //! Publishes the statistics of the DDS Proxy, if the monitor is enabled
+    std::unique_ptr<ProxyMonitor> proxy_monitor_;
 };
 
 } /* namespace core */
@@ -0,0 +1,109 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/memory/Heritable.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+#include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+#include <ddsproxy_core/configuration/MonitorConfiguration.hpp>
+#include <ddsproxy_core/library/library_dll.h>
+#include <ddsproxy_core/types/ProxyStatistics.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+/**
+ * Periodically publishes the statistics of the DDS Proxy in its monitor topic.
+ *
+ * Every period the metrics are sampled, the rates and latencies since the previous period are calculated, and a
+ * \c ProxyStatistics sample is introduced in the \c InternalReader of the monitor participant. The bridge of the
+ * monitor topic forwards it to every participant, so the statistics of every site can be gathered anywhere.
+ */
+class ProxyMonitor
+{
+public:
+
+    /**
+     * @brief Construct a new Proxy Monitor and start publishing.
+     *
+     * @param configuration : monitor configuration
+     * @param reader : Reader of the monitor topic in the monitor participant
+     * @param payload_pool : DDS Pipe shared Payload Pool
+     * @param metrics_callback : returns the current metrics of the DDS Proxy
+     */
+    DDSPROXY_CORE_DllAPI
+    ProxyMonitor(
+            const MonitorConfiguration& configuration,
+            const std::shared_ptr<ddspipe::participants::InternalReader>& reader,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            std::function<ddspipe::core::MetricsSnapshot()> metrics_callback);
+
+    //! Stop publishing
+    DDSPROXY_CORE_DllAPI
+    ~ProxyMonitor();
+
+    //! Builtin topic where the statistics of \c configuration are published
+    DDSPROXY_CORE_DllAPI
+    static utils::Heritable<ddspipe::core::types::DistributedTopic> monitor_topic(
+            const MonitorConfiguration& configuration);
+
+    //! Id of the participant that introduces the statistics in the DDS Pipe
+    static constexpr const char* PARTICIPANT_ID = "ddsproxy_monitor";
+
+protected:
+
+    //! Sample the metrics and publish the statistics of the last period
+    void publish_() noexcept;
+
+    //! Statistics from \c snapshot and the snapshot of the previous period
+    types::ProxyStatistics statistics_(
+            const ddspipe::core::MetricsSnapshot& snapshot,
+            const double elapsed_s) const noexcept;
+
+    //! Monitor configuration
+    const MonitorConfiguration configuration_;
+
+    //! Reader where the statistics are introduced
+    std::shared_ptr<ddspipe::participants::InternalReader> reader_;
+
+    //! DDS Pipe shared Payload Pool
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    //! Returns the current metrics of the DDS Proxy
+    std::function<ddspipe::core::MetricsSnapshot()> metrics_callback_;
+
+    //! Metrics of the previous period
+    ddspipe::core::MetricsSnapshot last_snapshot_;
+
+    //! Time of the previous period
+    std::chrono::steady_clock::time_point last_publication_;
+
+    //! Handler that calls \c publish_ periodically. Destroyed first so no publication runs during destruction.
+    std::unique_ptr<utils::event::PeriodicEventHandler> periodic_handler_;
+};
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
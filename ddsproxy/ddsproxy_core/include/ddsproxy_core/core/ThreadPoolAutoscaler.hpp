@@ -0,0 +1,84 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+
+#include <ddsproxy_core/configuration/ThreadAutoscalingConfiguration.hpp>
+#include <ddsproxy_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+/**
+ * Periodically resizes a \c SlotThreadPool according to the queue depth and the utilization of its threads.
+ *
+ * Threads are added quickly (half the current number at a time) as soon as the pool is saturated, and removed one
+ * at a time after the pool has been idle for several periods, so short bursts do not make the pool oscillate.
+ */
+class ThreadPoolAutoscaler
+{
+public:
+
+    /**
+     * @brief Construct a new Thread Pool Autoscaler and start evaluating the load of \c thread_pool .
+     *
+     * The pool is resized within the limits of \c configuration right away.
+     */
+    DDSPROXY_CORE_DllAPI
+    ThreadPoolAutoscaler(
+            const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+            const ThreadAutoscalingConfiguration& configuration);
+
+    //! Stop evaluating the load. The pool keeps its current number of threads.
+    DDSPROXY_CORE_DllAPI
+    ~ThreadPoolAutoscaler();
+
+    //! Number of consecutive idle periods after which a thread is removed
+    static constexpr const unsigned int IDLE_PERIODS_TO_SCALE_DOWN = 3;
+
+protected:
+
+    //! Sample the load of the pool and resize it if needed
+    void evaluate_() noexcept;
+
+    //! Thread Pool resized
+    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+
+    //! Autoscaling policy
+    const ThreadAutoscalingConfiguration configuration_;
+
+    //! Busy time of the pool in the previous evaluation [ns]
+    std::uint64_t last_busy_time_;
+
+    //! Time of the previous evaluation
+    std::chrono::steady_clock::time_point last_evaluation_;
+
+    //! Number of consecutive evaluations with the pool idle
+    unsigned int idle_periods_;
+
+    //! Handler that calls \c evaluate_ periodically. Destroyed first so no evaluation runs during destruction.
+    std::unique_ptr<utils::event::PeriodicEventHandler> periodic_handler_;
+};
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
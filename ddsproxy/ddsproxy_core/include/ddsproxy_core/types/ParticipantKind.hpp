@@ -28,7 +28,9 @@ ENUMERATION_BUILDER(
     initial_peers,
     discovery_server,
     echo,
-    xml
+    xml,
+    generator,
+    sink
     );
 
 eProsima_ENUMERATION_BUILDER(
@@ -39,7 +41,9 @@ eProsima_ENUMERATION_BUILDER(
                     { ParticipantKind::initial_peers COMMA {"wan" COMMA "proxy" COMMA "initial-peers"} } COMMA
                     { ParticipantKind::discovery_server COMMA {"discovery-server" COMMA "ds" COMMA "local-ds" COMMA "local-discovery-server" COMMA "wan-ds" COMMA "wan-discovery-server"} } COMMA
                     { ParticipantKind::echo COMMA {"echo"} } COMMA
-                    { ParticipantKind::xml COMMA {"xml" COMMA "XML"} }
+                    { ParticipantKind::xml COMMA {"xml" COMMA "XML"} } COMMA
+                    { ParticipantKind::generator COMMA {"generator"} } COMMA
+                    { ParticipantKind::sink COMMA {"sink"} }
                 }
     );
 
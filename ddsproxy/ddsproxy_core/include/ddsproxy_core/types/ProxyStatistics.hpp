@@ -0,0 +1,98 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxyStatistics.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddsproxy_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+namespace types {
+
+//! Statistics of a topic during the last period (\c ddsproxy::monitoring::TopicStatistics in ProxyStatistics.idl)
+struct TopicStatistics
+{
+    std::string topic_name{};
+    std::string type_name{};
+
+    //! Samples taken from the readers [samples/s]
+    double samples_in_rate{0};
+
+    //! Samples written, once per writer [samples/s]
+    double samples_out_rate{0};
+
+    //! Bytes taken from the readers [bytes/s]
+    double bytes_in_rate{0};
+
+    //! Bytes written, once per writer [bytes/s]
+    double bytes_out_rate{0};
+
+    //! Samples dropped for any reason
+    std::uint64_t samples_dropped{0};
+
+    //! Mean time from the reception of a sample to its write (0 if no sample was written) [us]
+    double mean_latency_us{0};
+
+    //! Upper bound of the latency histogram bucket that holds the 99th percentile [us]
+    double p99_latency_us{0};
+};
+
+//! Statistics of a DDS Proxy during the last period (\c ddsproxy::monitoring::ProxyStatistics in ProxyStatistics.idl)
+struct ProxyStatistics
+{
+    /**
+     * @brief Serialize in CDR (XCDRv1, little endian) with its encapsulation header.
+     *
+     * The result is the payload of a \c ddsproxy::monitoring::ProxyStatistics sample.
+     */
+    DDSPROXY_CORE_DllAPI
+    std::vector<std::uint8_t> serialize() const;
+
+    //! Name of the type in the topic
+    static constexpr const char* TYPE_NAME = "ddsproxy::monitoring::ProxyStatistics";
+
+    std::string proxy_id{};
+
+    //! Time of the sample since epoch [ns]
+    std::uint64_t timestamp_ns{0};
+
+    //! Whether the proxy is forwarding data (false while in standby)
+    bool master{false};
+
+    std::uint64_t payloads_in_use{0};
+    std::uint64_t bytes_in_use{0};
+
+    std::uint32_t threads{0};
+    std::uint32_t busy_threads{0};
+    std::uint64_t pending_tasks{0};
+
+    //! Time executing tasks over time available (0 to 1)
+    double thread_utilization{0};
+
+    std::vector<TopicStatistics> topics{};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
@@ -21,8 +21,10 @@
 
 #include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/EchoParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/InitialPeersParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/SinkParticipantConfiguration.hpp>
 
 #include <ddsproxy_core/configuration/DdsProxyConfiguration.hpp>
 #include <ddsproxy_core/types/ParticipantKind.hpp>
@@ -137,6 +139,14 @@ bool DdsProxyConfiguration::check_correct_configuration_object_(
             return check_correct_configuration_object_by_type_<ddspipe::participants::EchoParticipantConfiguration>(
                 configuration.second);
 
+        case types::ParticipantKind::generator:
+            return check_correct_configuration_object_by_type_<ddspipe::participants::GeneratorParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::sink:
+            return check_correct_configuration_object_by_type_<ddspipe::participants::SinkParticipantConfiguration>(
+                configuration.second);
+
         default:
             return check_correct_configuration_object_by_type_<ddspipe::participants::ParticipantConfiguration>(
                 configuration.second);
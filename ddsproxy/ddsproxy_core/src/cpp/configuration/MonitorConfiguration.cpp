@@ -0,0 +1,60 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MonitorConfiguration.cpp
+ *
+ */
+
+#include <ddsproxy_core/configuration/MonitorConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+bool MonitorConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!enabled)
+    {
+        return true;
+    }
+
+    if (period == 0)
+    {
+        error_msg << "Monitor period must be greater than 0.";
+        return false;
+    }
+
+    if (topic_name.empty())
+    {
+        error_msg << "Monitor topic name must not be empty.";
+        return false;
+    }
+
+    return true;
+}
+
+bool MonitorConfiguration::operator ==(
+        const MonitorConfiguration& other) const noexcept
+{
+    return enabled == other.enabled &&
+           period == other.period &&
+           topic_name == other.topic_name &&
+           proxy_id == other.proxy_id;
+}
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
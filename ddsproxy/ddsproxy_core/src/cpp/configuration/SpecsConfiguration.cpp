@@ -35,6 +35,16 @@ bool SpecsConfiguration::is_valid(
         return false;
     }
 
+    if (!thread_autoscaling.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (!monitor.is_valid(error_msg))
+    {
+        return false;
+    }
+
     if (topic_qos.history_depth == 0U)
     {
         logWarning(DDSPROXY_SPECS, "Using non limited histories could lead to memory exhaustion in long executions.");
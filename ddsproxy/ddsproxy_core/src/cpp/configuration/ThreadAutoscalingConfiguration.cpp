@@ -0,0 +1,74 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadAutoscalingConfiguration.cpp
+ *
+ */
+
+#include <ddsproxy_core/configuration/ThreadAutoscalingConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+bool ThreadAutoscalingConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!enabled)
+    {
+        return true;
+    }
+
+    if (min_threads < 1)
+    {
+        error_msg << "Minimum number of threads must be at least 1.";
+        return false;
+    }
+
+    if (max_threads < min_threads)
+    {
+        error_msg << "Maximum number of threads must not be lower than the minimum.";
+        return false;
+    }
+
+    if (period == 0)
+    {
+        error_msg << "Thread autoscaling period must be greater than 0.";
+        return false;
+    }
+
+    if (scale_down_utilization < 0 || scale_up_utilization > 1 || scale_down_utilization >= scale_up_utilization)
+    {
+        error_msg << "Thread autoscaling utilizations must satisfy 0 <= scale-down < scale-up <= 1.";
+        return false;
+    }
+
+    return true;
+}
+
+bool ThreadAutoscalingConfiguration::operator ==(
+        const ThreadAutoscalingConfiguration& other) const noexcept
+{
+    return enabled == other.enabled &&
+           min_threads == other.min_threads &&
+           max_threads == other.max_threads &&
+           period == other.period &&
+           scale_up_utilization == other.scale_up_utilization &&
+           scale_down_utilization == other.scale_down_utilization;
+}
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
@@ -24,7 +24,9 @@
 #include <ddspipe_core/core/DdsPipe.hpp>
 #include <ddspipe_core/dynamic/AllowedTopicList.hpp>
 #include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/metrics/MetricsRegistry.hpp>
 #include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_participants/participant/auxiliar/InternalParticipant.hpp>
 
 #include <ddsproxy_core/configuration/DdsProxyConfiguration.hpp>
 #include <ddsproxy_core/core/DdsProxy.hpp>
@@ -52,8 +54,13 @@ DdsProxy::DdsProxy(
                       "Configuration for DDS Proxy is invalid: " << error_msg);
     }
 
+    // The topics discovered by the Participants take the Topic QoS of specs as default
+    ddspipe::core::types::TopicQoS::set_default_topic_qos(configuration_.ddspipe_configuration.topic_qos);
+
     // Load Participants
     init_participants_();
+    init_monitor_participant_();
+    add_monitor_topic_(configuration_.ddspipe_configuration);
 
     // Initialize the DdsPipe
     ddspipe_ = std::unique_ptr<ddspipe::core::DdsPipe>(new ddspipe::core::DdsPipe(
@@ -63,6 +70,25 @@ DdsProxy::DdsProxy(
                         participants_database_,
                         thread_pool_));
 
+    if (configuration_.advanced_options.thread_autoscaling.enabled)
+    {
+        thread_pool_autoscaler_ = std::make_unique<ThreadPoolAutoscaler>(
+            thread_pool_,
+            configuration_.advanced_options.thread_autoscaling);
+    }
+
+    if (monitor_reader_)
+    {
+        proxy_monitor_ = std::make_unique<ProxyMonitor>(
+            configuration_.advanced_options.monitor,
+            monitor_reader_,
+            payload_pool_,
+            [this]()
+            {
+                return metrics();
+            });
+    }
+
     logDebug(DDSPROXY, "DDS Proxy created.");
 }
 
@@ -116,10 +142,58 @@ utils::ReturnCode DdsProxy::reload_configuration(
                   utils::Formatter() <<
                       "Configuration for Reload DDS Proxy is invalid: " << error_msg);
     }
-    // new_configuration.ddspipe_configuration.master_flag = new_configuration.advanced_options.master_flag;
 
-    // Reload the DdsPipe configuration, since it is the only reconfigurable attribute.
-    return ddspipe_->reload_configuration(new_configuration.ddspipe_configuration);
+    const bool thread_pool_reloaded = reload_thread_pool_(new_configuration.advanced_options);
+
+    if (!(new_configuration.advanced_options.monitor == configuration_.advanced_options.monitor))
+    {
+        logWarning(DDSPROXY, "Monitor configuration cannot be reloaded. Restart the DDS Proxy to apply it.");
+    }
+
+    // The monitor topic is builtin, so it must be kept in the new configuration
+    ddspipe::core::DdsPipeConfiguration ddspipe_configuration = new_configuration.ddspipe_configuration;
+    add_monitor_topic_(ddspipe_configuration);
+
+    // Reload the DdsPipe configuration. Only the differences with the current one are applied.
+    utils::ReturnCode ret = ddspipe_->reload_configuration(ddspipe_configuration);
+
+    if (ret == utils::ReturnCode::RETCODE_NO_DATA && thread_pool_reloaded)
+    {
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    return ret;
+}
+
+bool DdsProxy::reload_thread_pool_(
+        const SpecsConfiguration& advanced_options)
+{
+    const ThreadAutoscalingConfiguration& autoscaling = advanced_options.thread_autoscaling;
+
+    if (autoscaling == configuration_.advanced_options.thread_autoscaling &&
+            (autoscaling.enabled ||
+            advanced_options.number_of_threads == configuration_.advanced_options.number_of_threads))
+    {
+        return false;
+    }
+
+    // Stop the current policy before resizing the pool
+    thread_pool_autoscaler_.reset();
+
+    if (autoscaling.enabled)
+    {
+        // The pool keeps its current size, within the new limits
+        thread_pool_autoscaler_ = std::make_unique<ThreadPoolAutoscaler>(thread_pool_, autoscaling);
+    }
+    else
+    {
+        thread_pool_->resize(advanced_options.number_of_threads);
+    }
+
+    configuration_.advanced_options.number_of_threads = advanced_options.number_of_threads;
+    configuration_.advanced_options.thread_autoscaling = autoscaling;
+
+    return true;
 }
 
 utils::ReturnCode DdsProxy::start() noexcept
@@ -144,6 +218,55 @@ utils::ReturnCode DdsProxy::stop() noexcept
     return ret;
 }
 
+void DdsProxy::add_monitor_topic_(
+        ddspipe::core::DdsPipeConfiguration& configuration) const
+{
+    if (configuration_.advanced_options.monitor.enabled)
+    {
+        configuration.builtin_topics.insert(ProxyMonitor::monitor_topic(configuration_.advanced_options.monitor));
+    }
+}
+
+void DdsProxy::init_monitor_participant_()
+{
+    if (!configuration_.advanced_options.monitor.enabled)
+    {
+        return;
+    }
+
+    auto monitor_participant = std::make_shared<ddspipe::participants::InternalParticipant>(
+        ProxyMonitor::PARTICIPANT_ID,
+        configuration_.advanced_options.monitor.topic_name);
+
+    try
+    {
+        participants_database_->add_participant(monitor_participant->id(), monitor_participant);
+    }
+    catch (const utils::InconsistencyException& )
+    {
+        throw utils::ConfigurationException(utils::Formatter()
+                      << "Participant id " << ProxyMonitor::PARTICIPANT_ID << " is reserved for the monitor.");
+    }
+
+    monitor_reader_ = monitor_participant->reader();
+}
+
+ddspipe::core::MetricsSnapshot DdsProxy::metrics() const noexcept
+{
+    ddspipe::core::MetricsSnapshot snapshot = ddspipe::core::ProcessMetricsRegistry::get_instance()->snapshot();
+
+    snapshot.payload_pool.payloads_in_use = payload_pool_->payloads_in_use();
+    snapshot.payload_pool.bytes_in_use = payload_pool_->bytes_in_use();
+    snapshot.payload_pool.payloads_reserved = payload_pool_->payloads_reserved();
+
+    snapshot.thread_pool.threads = thread_pool_->number_of_threads();
+    snapshot.thread_pool.busy_threads = thread_pool_->busy_threads();
+    snapshot.thread_pool.pending_tasks = thread_pool_->pending_tasks();
+    snapshot.thread_pool.busy_time_ns = thread_pool_->busy_time();
+
+    return snapshot;
+}
+
 } /* namespace core */
 } /* namespace ddsproxy */
 } /* namespace eprosima */
@@ -26,11 +26,15 @@
 #include <ddspipe_core/interface/IParticipant.hpp>
 #include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/EchoParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/InitialPeersParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/SinkParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/XmlParticipantConfiguration.hpp>
 #include <ddspipe_participants/participant/auxiliar/EchoParticipant.hpp>
+#include <ddspipe_participants/participant/auxiliar/GeneratorParticipant.hpp>
+#include <ddspipe_participants/participant/auxiliar/SinkParticipant.hpp>
 #include <ddspipe_participants/participant/rtps/DiscoveryServerParticipant.hpp>
 #include <ddspipe_participants/participant/rtps/InitialPeersParticipant.hpp>
 #include <ddspipe_participants/participant/rtps/SimpleParticipant.hpp>
@@ -101,6 +105,26 @@ std::shared_ptr<ddspipe::core::IParticipant> ParticipantFactory::create_particip
                 discovery_database
                    );
 
+        case types::ParticipantKind::generator:
+            return generic_create_participant<
+                ddspipe::participants::GeneratorParticipantConfiguration,
+                ddspipe::participants::GeneratorParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::sink:
+            return generic_create_participant<
+                ddspipe::participants::SinkParticipantConfiguration,
+                ddspipe::participants::SinkParticipant>
+                   (
+                kind,
+                participant_configuration
+                   );
+
         case types::ParticipantKind::simple:
             return generic_create_participant_with_init<
                 ddspipe::participants::SimpleParticipantConfiguration,
@@ -0,0 +1,244 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsproxy_core/core/ProxyMonitor.hpp>
+
+// Failover state of the process (false while in standby)
+extern std::atomic<bool> master_flag;
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+using namespace eprosima::ddspipe::core;
+
+namespace {
+
+//! Counters that count samples dropped
+constexpr const MetricKind DROPPED_KINDS[] = {
+    MetricKind::dropped_rate_limit,
+    MetricKind::dropped_downsampling,
+    MetricKind::dropped_writer_error,
+    MetricKind::dropped_rejected,
+    MetricKind::dropped_stale,
+    MetricKind::dropped_duplicate,
+    MetricKind::dropped_filtered,
+    MetricKind::dropped_malformed
+};
+
+//! Upper bound [us] of the bucket that holds \c percentile of the latencies in \c counts
+double latency_percentile(
+        const std::vector<std::uint64_t>& upper_bounds_us,
+        const std::vector<std::uint64_t>& counts,
+        const std::uint64_t count,
+        const double percentile)
+{
+    if (count == 0 || upper_bounds_us.empty())
+    {
+        return 0;
+    }
+
+    const double target = percentile * static_cast<double>(count);
+    std::uint64_t cumulative = 0;
+
+    for (std::size_t i = 0; i < counts.size() && i < upper_bounds_us.size(); ++i)
+    {
+        cumulative += counts[i];
+        if (static_cast<double>(cumulative) >= target)
+        {
+            return static_cast<double>(upper_bounds_us[i]);
+        }
+    }
+
+    // Overflow bucket, only its lower bound is known
+    return static_cast<double>(upper_bounds_us.back());
+}
+
+} /* namespace */
+
+ProxyMonitor::ProxyMonitor(
+        const MonitorConfiguration& configuration,
+        const std::shared_ptr<ddspipe::participants::InternalReader>& reader,
+        const std::shared_ptr<PayloadPool>& payload_pool,
+        std::function<MetricsSnapshot()> metrics_callback)
+    : configuration_(configuration)
+    , reader_(reader)
+    , payload_pool_(payload_pool)
+    , metrics_callback_(std::move(metrics_callback))
+    , last_snapshot_(metrics_callback_())
+    , last_publication_(std::chrono::steady_clock::now())
+{
+    logInfo(DDSPROXY,
+            "Publishing statistics of proxy " << configuration_.proxy_id << " in topic " <<
+            configuration_.topic_name << " every " << configuration_.period << " ms.");
+
+    periodic_handler_ = std::make_unique<utils::event::PeriodicEventHandler>(
+        [this]()
+        {
+            publish_();
+        },
+        configuration_.period);
+}
+
+ProxyMonitor::~ProxyMonitor()
+{
+    // Stop the publications before destroying the rest of the attributes
+    periodic_handler_.reset();
+}
+
+utils::Heritable<ddspipe::core::types::DistributedTopic> ProxyMonitor::monitor_topic(
+        const MonitorConfiguration& configuration)
+{
+    auto topic = utils::Heritable<ddspipe::core::types::DdsTopic>::make_heritable();
+
+    topic->m_topic_name = configuration.topic_name;
+    topic->type_name = types::ProxyStatistics::TYPE_NAME;
+
+    // Every statistics sample must reach the dashboards, even if only the latest one is kept
+    topic->topic_qos.reliability_qos.set_value(ddspipe::core::types::ReliabilityKind::RELIABLE);
+    topic->topic_qos.keyed.set_value(false);
+
+    return topic;
+}
+
+void ProxyMonitor::publish_() noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed_s = std::chrono::duration<double>(now - last_publication_).count();
+
+    MetricsSnapshot snapshot = metrics_callback_();
+    const std::vector<std::uint8_t> buffer = statistics_(snapshot, elapsed_s).serialize();
+
+    last_snapshot_ = std::move(snapshot);
+    last_publication_ = now;
+
+    auto data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+    if (!payload_pool_->get_payload(static_cast<std::uint32_t>(buffer.size()), data->payload))
+    {
+        logDevError(DDSPROXY, "Error getting Payload for proxy statistics.");
+        return;
+    }
+    data->payload_owner = payload_pool_.get();
+
+    std::memcpy(data->payload.data, buffer.data(), buffer.size());
+    data->payload.length = static_cast<std::uint32_t>(buffer.size());
+    data->kind = ddspipe::core::types::ChangeKind::ALIVE;
+    ddspipe::core::types::DataTime::now(data->source_timestamp);
+    data->reception_timestamp = data->source_timestamp;
+    data->participant_receiver = PARTICIPANT_ID;
+
+    reader_->simulate_data_reception(std::move(data));
+}
+
+types::ProxyStatistics ProxyMonitor::statistics_(
+        const MetricsSnapshot& snapshot,
+        const double elapsed_s) const noexcept
+{
+    types::ProxyStatistics statistics;
+
+    statistics.proxy_id = configuration_.proxy_id;
+    statistics.timestamp_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    statistics.master = master_flag.load();
+
+    statistics.payloads_in_use = snapshot.payload_pool.payloads_in_use;
+    statistics.bytes_in_use = snapshot.payload_pool.bytes_in_use;
+
+    statistics.threads = snapshot.thread_pool.threads;
+    statistics.busy_threads = snapshot.thread_pool.busy_threads;
+    statistics.pending_tasks = snapshot.thread_pool.pending_tasks;
+
+    const double busy_ns =
+            static_cast<double>(snapshot.thread_pool.busy_time_ns - last_snapshot_.thread_pool.busy_time_ns);
+    const double available_ns = elapsed_s * 1e9 * snapshot.thread_pool.threads;
+    if (available_ns > 0)
+    {
+        statistics.thread_utilization = std::min(1.0, busy_ns / available_ns);
+    }
+
+    // Topics of the previous period, to calculate the differences
+    std::map<std::pair<std::string, std::string>, const EntityMetricsSnapshot*> last_topics;
+    for (const EntityMetricsSnapshot& topic : last_snapshot_.topics)
+    {
+        last_topics[{topic.name, topic.type_name}] = &topic;
+    }
+
+    const EntityMetricsSnapshot empty_topic;
+
+    for (const EntityMetricsSnapshot& topic : snapshot.topics)
+    {
+        auto it = last_topics.find({topic.name, topic.type_name});
+        const EntityMetricsSnapshot& last = it != last_topics.end() ? *it->second : empty_topic;
+
+        auto delta = [&topic, &last](MetricKind kind)
+                {
+                    return topic.value(kind) - last.value(kind);
+                };
+
+        auto rate = [&delta, elapsed_s](MetricKind kind)
+                {
+                    return elapsed_s > 0 ? static_cast<double>(delta(kind)) / elapsed_s : 0;
+                };
+
+        types::TopicStatistics topic_statistics;
+        topic_statistics.topic_name = topic.name;
+        topic_statistics.type_name = topic.type_name;
+        topic_statistics.samples_in_rate = rate(MetricKind::samples_in);
+        topic_statistics.samples_out_rate = rate(MetricKind::samples_out);
+        topic_statistics.bytes_in_rate = rate(MetricKind::bytes_in);
+        topic_statistics.bytes_out_rate = rate(MetricKind::bytes_out);
+
+        for (const MetricKind kind : DROPPED_KINDS)
+        {
+            topic_statistics.samples_dropped += delta(kind);
+        }
+
+        // Latency of the samples written in this period
+        const LatencyHistogramSnapshot& latency = topic.latency;
+        const std::uint64_t count = latency.count - last.latency.count;
+        if (count > 0)
+        {
+            topic_statistics.mean_latency_us =
+                    static_cast<double>(latency.sum_ns - last.latency.sum_ns) / static_cast<double>(count) / 1e3;
+
+            std::vector<std::uint64_t> counts = latency.counts;
+            for (std::size_t i = 0; i < counts.size() && i < last.latency.counts.size(); ++i)
+            {
+                counts[i] -= last.latency.counts[i];
+            }
+
+            topic_statistics.p99_latency_us = latency_percentile(latency.upper_bounds_us, counts, count, 0.99);
+        }
+
+        statistics.topics.push_back(std::move(topic_statistics));
+    }
+
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
@@ -0,0 +1,109 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsproxy_core/core/ThreadPoolAutoscaler.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+
+ThreadPoolAutoscaler::ThreadPoolAutoscaler(
+        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const ThreadAutoscalingConfiguration& configuration)
+    : thread_pool_(thread_pool)
+    , configuration_(configuration)
+    , last_busy_time_(thread_pool->busy_time())
+    , last_evaluation_(std::chrono::steady_clock::now())
+    , idle_periods_(0)
+{
+    logInfo(DDSPROXY,
+            "Autoscaling Thread Pool between " << configuration_.min_threads << " and " <<
+            configuration_.max_threads << " threads.");
+
+    // Start within the limits configured
+    const std::uint32_t n_threads = thread_pool_->number_of_threads();
+    thread_pool_->resize(std::min<std::uint32_t>(
+                std::max<std::uint32_t>(n_threads, configuration_.min_threads),
+                configuration_.max_threads));
+
+    periodic_handler_ = std::make_unique<utils::event::PeriodicEventHandler>(
+        [this]()
+        {
+            evaluate_();
+        },
+        configuration_.period);
+}
+
+ThreadPoolAutoscaler::~ThreadPoolAutoscaler()
+{
+    // Stop the evaluations before destroying the rest of the attributes
+    periodic_handler_.reset();
+}
+
+void ThreadPoolAutoscaler::evaluate_() noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+    const std::uint64_t busy_time = thread_pool_->busy_time();
+    const std::uint64_t pending_tasks = thread_pool_->pending_tasks();
+    const std::uint32_t n_threads = thread_pool_->number_of_threads();
+
+    const double elapsed = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_evaluation_).count());
+    const double utilization = elapsed > 0 ?
+            static_cast<double>(busy_time - last_busy_time_) / (elapsed * n_threads) : 0;
+
+    last_busy_time_ = busy_time;
+    last_evaluation_ = now;
+
+    logDebug(DDSPROXY,
+            "Thread Pool with " << n_threads << " threads: utilization " << utilization << ", " <<
+            pending_tasks << " tasks waiting.");
+
+    std::uint32_t new_n_threads = n_threads;
+
+    if (pending_tasks > n_threads || utilization >= configuration_.scale_up_utilization)
+    {
+        // Saturated: grow fast
+        idle_periods_ = 0;
+        new_n_threads = std::min<std::uint32_t>(
+            n_threads + std::max<std::uint32_t>(1, n_threads / 2),
+            configuration_.max_threads);
+    }
+    else if (pending_tasks == 0 && utilization <= configuration_.scale_down_utilization)
+    {
+        // Idle: shrink slowly
+        if (++idle_periods_ >= IDLE_PERIODS_TO_SCALE_DOWN)
+        {
+            idle_periods_ = 0;
+            new_n_threads = std::max<std::uint32_t>(n_threads - 1, configuration_.min_threads);
+        }
+    }
+    else
+    {
+        idle_periods_ = 0;
+    }
+
+    if (new_n_threads != n_threads)
+    {
+        thread_pool_->resize(new_n_threads);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
@@ -0,0 +1,142 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxyStatistics.cpp
+ *
+ */
+
+#include <cstring>
+
+#include <ddsproxy_core/types/ProxyStatistics.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace core {
+namespace types {
+
+namespace {
+
+/**
+ * Minimal CDR (XCDRv1, little endian) writer for final structures.
+ *
+ * Every primitive is aligned to its size, counted from the end of the encapsulation header.
+ */
+class CdrWriter
+{
+public:
+
+    CdrWriter()
+    {
+        // Encapsulation: CDR_LE and options
+        buffer_ = {0x00, 0x01, 0x00, 0x00};
+    }
+
+    template <typename T>
+    void write(
+            const T value)
+    {
+        align_(sizeof(T));
+        write_little_endian_(value);
+    }
+
+    void write(
+            const bool value)
+    {
+        buffer_.push_back(value ? 1 : 0);
+    }
+
+    void write(
+            const double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        write(bits);
+    }
+
+    void write(
+            const std::string& value)
+    {
+        // Length includes the null terminator
+        write(static_cast<std::uint32_t>(value.size() + 1));
+        buffer_.insert(buffer_.end(), value.begin(), value.end());
+        buffer_.push_back(0);
+    }
+
+    std::vector<std::uint8_t>& buffer() noexcept
+    {
+        return buffer_;
+    }
+
+protected:
+
+    void align_(
+            const std::size_t alignment)
+    {
+        const std::size_t offset = buffer_.size() - ENCAPSULATION_SIZE;
+        buffer_.resize(buffer_.size() + (alignment - offset % alignment) % alignment, 0);
+    }
+
+    template <typename T>
+    void write_little_endian_(
+            const T value)
+    {
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            buffer_.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    std::vector<std::uint8_t> buffer_;
+
+    static constexpr const std::size_t ENCAPSULATION_SIZE = 4;
+};
+
+} /* namespace */
+
+std::vector<std::uint8_t> ProxyStatistics::serialize() const
+{
+    CdrWriter writer;
+
+    writer.write(proxy_id);
+    writer.write(timestamp_ns);
+    writer.write(master);
+    writer.write(payloads_in_use);
+    writer.write(bytes_in_use);
+    writer.write(threads);
+    writer.write(busy_threads);
+    writer.write(pending_tasks);
+    writer.write(thread_utilization);
+
+    writer.write(static_cast<std::uint32_t>(topics.size()));
+    for (const TopicStatistics& topic : topics)
+    {
+        writer.write(topic.topic_name);
+        writer.write(topic.type_name);
+        writer.write(topic.samples_in_rate);
+        writer.write(topic.samples_out_rate);
+        writer.write(topic.bytes_in_rate);
+        writer.write(topic.bytes_out_rate);
+        writer.write(topic.samples_dropped);
+        writer.write(topic.mean_latency_us);
+        writer.write(topic.p99_latency_us);
+    }
+
+    return std::move(writer.buffer());
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
@@ -22,7 +22,8 @@
 #include <cpp_utils/event/SignalEventHandler.hpp>
 #include <cpp_utils/exception/ConfigurationException.hpp>
 #include <cpp_utils/exception/InitializationException.hpp>
-#include <cpp_utils/logging/CustomStdLogConsumer.hpp>
+#include <cpp_utils/logging/AsyncLogWriter.hpp>
+#include <cpp_utils/logging/AsyncStdLogConsumer.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/time/time_utils.hpp>
 #include <cpp_utils/utils.hpp>
@@ -34,6 +35,9 @@
 
 #include <ddsproxy_yaml/YamlReaderConfiguration.hpp>
 
+#include "metrics/LatencyReport.hpp"
+#include "metrics/MetricsHttpServer.hpp"
+#include "metrics/PrometheusSerializer.hpp"
 #include "user_interface/constants.hpp"
 #include "user_interface/arguments_configuration.hpp"
 #include "user_interface/ProcessReturnCode.hpp"
@@ -50,6 +54,12 @@
 #include <errno.h>
 #include <thread>
 #include <chrono>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
 #include "keep_alived/ProxyKeepAlivedPublisher.h"
 #include "keep_alived/ProxyKeepAlivedSubscriber.h"
 #include <fastdds/dds/domain/DomainParticipant.hpp>
@@ -74,6 +84,16 @@ using namespace eprosima::fastdds::dds;
 using namespace eprosima;
 using namespace eprosima::ddsproxy;
 
+//! Read the whole content of a file (empty if it cannot be read)
+static std::string read_file(
+        const std::string& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
 int main(
         int argc,
         char** argv)
@@ -118,9 +138,12 @@ int main(
     std::string log_filter = "";
     eprosima::fastdds::dds::Log::Kind log_verbosity = eprosima::fastdds::dds::Log::Kind::Info;
 
+    // Metrics port (0 <=> metrics not served)
+    std::uint16_t metrics_port = 0;
+
     // Parse arguments
     ui::ProcessReturnCode arg_parse_result =
-            ui::parse_arguments(argc, argv, file_path, reload_time, timeout, log_filter, log_verbosity);
+            ui::parse_arguments(argc, argv, file_path, reload_time, timeout, log_filter, log_verbosity, metrics_port);
 
     if (arg_parse_result == ui::ProcessReturnCode::help_argument)
     {
@@ -157,6 +180,9 @@ int main(
 
     logUser(DDSPROXY_EXECUTION, "Starting DDS proxy Tool execution.");
 
+    // Writer of every log from now on
+    std::shared_ptr<eprosima::utils::AsyncLogWriter> log_writer;
+
     // Debug
     {
         // Remove every consumer
@@ -165,8 +191,12 @@ int main(
         // Activate log with verbosity, as this will avoid running log thread with not desired kind
         eprosima::utils::Log::SetVerbosity(log_verbosity);
 
+        // Write the logs from a background thread, so log storms do not slow down the forwarding
+        log_writer = std::make_shared<eprosima::utils::AsyncLogWriter>();
+        eprosima::utils::AsyncLogWriter::set_user_writer(log_writer);
+
         eprosima::utils::Log::RegisterConsumer(
-            std::make_unique<eprosima::utils::CustomStdLogConsumer>(log_filter, log_verbosity));
+            std::make_unique<eprosima::utils::AsyncStdLogConsumer>(log_filter, log_verbosity, log_writer));
 
         // NOTE:
         // It will not filter any log, so Fast DDS logs will be visible unless Fast DDS is compiled
@@ -215,31 +245,59 @@ int main(
         core::DdsProxy proxy(proxy_configuration);
 
         /////
-        // File Watcher Handler
+        // Configuration reload
 
-        // Callback will reload configuration and pass it to DdsProxy
-        // WARNING: it is needed to pass file_path, as FileWatcher only retrieves file_name
-        std::function<void(std::string)> filewatcher_callback =
-                [&proxy, file_path]
-                    (std::string file_name)
+        // Hash of the last configuration file loaded, so an unchanged file is neither parsed nor reloaded again.
+        // The mutex serializes the reloads triggered by the FileWatcher and the periodic timer.
+        std::mutex reload_mutex;
+        std::size_t last_configuration_hash = std::hash<std::string>()(read_file(file_path));
+
+        std::function<void()> reload_configuration =
+                [&proxy, &reload_mutex, &last_configuration_hash, file_path]
+                    ()
                 {
-                    logUser(
-                        DDSPROXY_EXECUTION,
-                        "FileWatcher notified changes in file " << file_name << ". Reloading configuration");
+                    std::lock_guard<std::mutex> lock(reload_mutex);
 
                     try
                     {
+                        const std::size_t configuration_hash = std::hash<std::string>()(read_file(file_path));
+                        if (configuration_hash == last_configuration_hash)
+                        {
+                            logInfo(DDSPROXY_EXECUTION,
+                                    "Configuration file " << file_path << " has not changed. Skipping reload.");
+                            return;
+                        }
+
                         core::DdsProxyConfiguration proxy_configuration =
                                 yaml::YamlReaderConfiguration::load_ddsproxy_configuration_from_file(file_path);
                         proxy.reload_configuration(proxy_configuration);
+
+                        // Only remember the file once it has been reloaded, so a failed reload is retried
+                        last_configuration_hash = configuration_hash;
                     }
                     catch (const std::exception& e)
                     {
                         logWarning(DDSPROXY_EXECUTION,
-                                "Error reloading configuration file " << file_name << " with error: " << e.what());
+                                "Error reloading configuration file " << file_path << " with error: " << e.what());
                     }
                 };
 
+        /////
+        // File Watcher Handler
+
+        // Callback will reload configuration and pass it to DdsProxy
+        // WARNING: it is needed to pass file_path, as FileWatcher only retrieves file_name
+        std::function<void(std::string)> filewatcher_callback =
+                [&reload_configuration]
+                    (std::string file_name)
+                {
+                    logUser(
+                        DDSPROXY_EXECUTION,
+                        "FileWatcher notified changes in file " << file_name << ". Reloading configuration");
+
+                    reload_configuration();
+                };
+
         // Creating FileWatcher event handler
         std::unique_ptr<eprosima::utils::event::FileWatcherHandler> file_watcher_handler =
                 std::make_unique<eprosima::utils::event::FileWatcherHandler>(filewatcher_callback, file_path);
@@ -255,24 +313,14 @@ int main(
         {
             // Callback will reload configuration and pass it to DdsProxy
             std::function<void()> periodic_callback =
-                    [&proxy, file_path]
+                    [&reload_configuration, file_path]
                         ()
                     {
                         logUser(
                             DDSPROXY_EXECUTION,
                             "Periodic Timer raised. Reloading configuration from file " << file_path << ".");
 
-                        try
-                        {
-                            core::DdsProxyConfiguration proxy_configuration =
-                                    yaml::YamlReaderConfiguration::load_ddsproxy_configuration_from_file(file_path);
-                            proxy.reload_configuration(proxy_configuration);
-                        }
-                        catch (const std::exception& e)
-                        {
-                            logWarning(DDSPROXY_EXECUTION,
-                                    "Error reloading configuration file " << file_path << " with error: " << e.what());
-                        }
+                        reload_configuration();
                     };
 
             periodic_handler = std::make_unique<eprosima::utils::event::PeriodicEventHandler>(periodic_callback,
@@ -304,6 +352,32 @@ int main(
             return 0;
         });
 
+        /////
+        // Metrics endpoint
+
+        // It must be a ptr, so the server is only created when a metrics port is given
+        std::unique_ptr<metrics::MetricsHttpServer> metrics_server;
+
+        if (metrics_port > 0)
+        {
+            metrics_server = std::make_unique<metrics::MetricsHttpServer>(
+                metrics_port,
+                [&proxy]()
+                {
+                    return metrics::serialize_prometheus(proxy.metrics(), master_flag.load());
+                });
+        }
+
+        /////
+        // Latency dump
+
+        // Print the latency percentiles of every topic each time SIGUSR1 is received
+        eprosima::utils::event::SignalEventHandler<eprosima::utils::event::Signal::sigusr1> latency_dump_handler(
+            [&proxy](eprosima::utils::event::Signal)
+            {
+                logUser(DDSPROXY_EXECUTION, metrics::latency_report(proxy.metrics()));
+            });
+
         // Start proxy
         proxy.start();
 
@@ -325,6 +399,15 @@ int main(
             file_watcher_handler.reset();
         }
 
+        // Stop serving metrics before the proxy is destroyed
+        if (metrics_server)
+        {
+            metrics_server.reset();
+        }
+
+        // Stop dumping latencies before the proxy is destroyed
+        latency_dump_handler.unset_callback();
+
         // Stop keepalive thread.
 		force_exit = 1;
 		// alive_thread.join();
@@ -355,6 +438,7 @@ int main(
 
     // Force print every log before closing
     eprosima::utils::Log::Flush();
+    log_writer->flush();
 
     return static_cast<int>(ui::ProcessReturnCode::success);
 }
@@ -0,0 +1,82 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyReport.cpp
+ *
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "LatencyReport.hpp"
+
+namespace eprosima {
+namespace ddsproxy {
+namespace metrics {
+
+using namespace eprosima::ddspipe::core;
+
+namespace {
+
+//! Write a latency [ns] in microseconds
+void write_us(
+        std::ostream& os,
+        const std::uint64_t latency_ns)
+{
+    os << std::setw(12) << static_cast<double>(latency_ns) / 1e3;
+}
+
+//! Write a row with the count and percentiles of a stage
+void write_stage(
+        std::ostream& os,
+        const char* stage,
+        const LatencyDistributionSnapshot& latency)
+{
+    os << "  " << std::left << std::setw(12) << stage << std::right << std::setw(12) << latency.count;
+    write_us(os, latency.percentile_ns(0.5));
+    write_us(os, latency.percentile_ns(0.99));
+    write_us(os, latency.percentile_ns(0.999));
+    write_us(os, latency.max_ns);
+    os << "\n";
+}
+
+} /* namespace */
+
+std::string latency_report(
+        const MetricsSnapshot& snapshot)
+{
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(1);
+
+    os << "Forwarding latencies of " << snapshot.latencies.size() << " topics [us]:\n";
+
+    for (const TopicLatencySnapshot& topic : snapshot.latencies)
+    {
+        os << "Topic " << topic.name << " (" << topic.type_name << ")\n";
+        os << "  " << std::left << std::setw(12) << "stage" << std::right << std::setw(12) << "count" <<
+            std::setw(12) << "p50" << std::setw(12) << "p99" << std::setw(12) << "p99.9" << std::setw(12) << "max" <<
+            "\n";
+
+        write_stage(os, "queue_wait", topic.queue_wait);
+        write_stage(os, "forwarding", topic.forwarding);
+        write_stage(os, "end_to_end", topic.end_to_end);
+    }
+
+    return os.str();
+}
+
+} /* namespace metrics */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
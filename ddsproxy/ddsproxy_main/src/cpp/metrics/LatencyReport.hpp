@@ -0,0 +1,44 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyReport.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSPROXY_METRICS_LATENCYREPORT_HPP
+#define EPROSIMA_DDSPROXY_METRICS_LATENCYREPORT_HPP
+
+#include <string>
+
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace metrics {
+
+/**
+ * @brief Human readable report of the latencies of every topic in \c snapshot .
+ *
+ * For each topic, it shows the number of latencies recorded and the p50, p99, p99.9 and maximum [us] of the time
+ * waiting in the thread pool queue, the forwarding time and the end to end latency.
+ */
+std::string latency_report(
+        const ddspipe::core::MetricsSnapshot& snapshot);
+
+} /* namespace metrics */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSPROXY_METRICS_LATENCYREPORT_HPP */
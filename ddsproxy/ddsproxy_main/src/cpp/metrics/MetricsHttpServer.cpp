@@ -0,0 +1,209 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsHttpServer.cpp
+ *
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include "MetricsHttpServer.hpp"
+
+namespace eprosima {
+namespace ddsproxy {
+namespace metrics {
+
+MetricsHttpServer::MetricsHttpServer(
+        const std::uint16_t port,
+        std::function<std::string()> metrics_callback)
+    : metrics_callback_(std::move(metrics_callback))
+    , socket_(-1)
+    , stop_(false)
+{
+    socket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_ < 0)
+    {
+        throw utils::InitializationException(
+                  STR_ENTRY << "Error creating metrics socket: " << std::strerror(errno) << ".");
+    }
+
+    int reuse = 1;
+    ::setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+
+    if (::bind(socket_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+            ::listen(socket_, SOMAXCONN) < 0)
+    {
+        const std::string error = std::strerror(errno);
+        ::close(socket_);
+        throw utils::InitializationException(
+                  STR_ENTRY << "Error listening for metrics in 127.0.0.1:" << port << ": " << error << ".");
+    }
+
+    thread_ = std::thread(&MetricsHttpServer::run_, this);
+
+    logInfo(DDSPROXY_METRICS, "Serving metrics in http://127.0.0.1:" << port << "/metrics .");
+}
+
+MetricsHttpServer::~MetricsHttpServer()
+{
+    stop_.store(true);
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    ::close(socket_);
+}
+
+void MetricsHttpServer::run_() noexcept
+{
+    pollfd listening{};
+    listening.fd = socket_;
+    listening.events = POLLIN;
+
+    while (!stop_.load())
+    {
+        // Wake up periodically to check whether the server must stop
+        int ret = ::poll(&listening, 1, POLL_TIMEOUT_MS);
+        if (ret <= 0)
+        {
+            continue;
+        }
+
+        int client = ::accept(socket_, nullptr, nullptr);
+        if (client < 0)
+        {
+            logDebug(DDSPROXY_METRICS, "Error accepting metrics connection: " << std::strerror(errno) << ".");
+            continue;
+        }
+
+        serve_client_(client);
+        ::close(client);
+    }
+}
+
+void MetricsHttpServer::serve_client_(
+        const int client) noexcept
+{
+    // A client that does not send its request must not block the server forever
+    timeval timeout{};
+    timeout.tv_sec = CLIENT_TIMEOUT_S;
+    ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    // Read until the end of the headers (the body of the request, if any, is ignored)
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE)
+    {
+        ssize_t received = ::recv(client, buffer, sizeof(buffer), 0);
+        if (received <= 0)
+        {
+            break;
+        }
+        request.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    // Request line: <method> <target> <version>
+    std::istringstream request_line(request.substr(0, request.find("\r\n")));
+    std::string method;
+    std::string target;
+    request_line >> method >> target;
+
+    if (method.empty())
+    {
+        return;
+    }
+
+    // Query string is ignored
+    const std::string path = target.substr(0, target.find('?'));
+
+    if (method != "GET")
+    {
+        send_response_(client, "405 Method Not Allowed", "text/plain; charset=utf-8", "Method not allowed.\n");
+    }
+    else if (path != "/metrics")
+    {
+        send_response_(client, "404 Not Found", "text/plain; charset=utf-8", "Metrics are served in /metrics.\n");
+    }
+    else
+    {
+        std::string body;
+        try
+        {
+            body = metrics_callback_();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(DDSPROXY_METRICS, "Error collecting metrics: " << e.what() << ".");
+            send_response_(client, "500 Internal Server Error", "text/plain; charset=utf-8",
+                    "Error collecting metrics.\n");
+            return;
+        }
+
+        send_response_(client, "200 OK", "text/plain; version=0.0.4; charset=utf-8", body);
+    }
+}
+
+void MetricsHttpServer::send_response_(
+        const int client,
+        const std::string& status,
+        const std::string& content_type,
+        const std::string& body) noexcept
+{
+    std::ostringstream response;
+    response <<
+        "HTTP/1.0 " << status << "\r\n" <<
+        "Content-Type: " << content_type << "\r\n" <<
+        "Content-Length: " << body.size() << "\r\n" <<
+        "Connection: close\r\n" <<
+        "\r\n" <<
+        body;
+
+    const std::string data = response.str();
+    std::size_t sent = 0;
+    while (sent < data.size())
+    {
+        ssize_t ret = ::send(client, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (ret <= 0)
+        {
+            logDebug(DDSPROXY_METRICS, "Error sending metrics response: " << std::strerror(errno) << ".");
+            return;
+        }
+        sent += static_cast<std::size_t>(ret);
+    }
+}
+
+} /* namespace metrics */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
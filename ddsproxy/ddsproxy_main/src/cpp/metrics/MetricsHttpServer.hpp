@@ -0,0 +1,100 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsHttpServer.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSPROXY_METRICS_METRICSHTTPSERVER_HPP
+#define EPROSIMA_DDSPROXY_METRICS_METRICSHTTPSERVER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace metrics {
+
+/**
+ * Minimal HTTP/1.0 responder that serves the metrics of the process in \c /metrics .
+ *
+ * It only listens in the loopback interface and attends one request at a time in its own thread, so a slow
+ * scraper never affects the forwarding threads. Any other path returns 404 and any other method 405.
+ */
+class MetricsHttpServer
+{
+public:
+
+    /**
+     * @brief Open the listening socket and start serving.
+     *
+     * @param [in] port : local TCP port to listen in
+     * @param [in] metrics_callback : returns the body of every \c /metrics response
+     *
+     * @throw \c InitializationException if the port cannot be opened
+     */
+    MetricsHttpServer(
+            const std::uint16_t port,
+            std::function<std::string()> metrics_callback);
+
+    //! Stop serving and close the socket
+    ~MetricsHttpServer();
+
+protected:
+
+    //! Accept and attend connections until \c stop_ is set
+    void run_() noexcept;
+
+    //! Read the request of \c client and send the response
+    void serve_client_(
+            const int client) noexcept;
+
+    //! Send a full HTTP response through \c client
+    static void send_response_(
+            const int client,
+            const std::string& status,
+            const std::string& content_type,
+            const std::string& body) noexcept;
+
+    //! Returns the body of every \c /metrics response
+    std::function<std::string()> metrics_callback_;
+
+    //! Listening socket
+    int socket_;
+
+    //! Whether the server thread must finish
+    std::atomic<bool> stop_;
+
+    //! Thread that attends the connections
+    std::thread thread_;
+
+    //! Maximum time the server thread blocks before checking \c stop_ [ms]
+    static constexpr const int POLL_TIMEOUT_MS = 200;
+
+    //! Maximum time to wait for a client to send its request [s]
+    static constexpr const int CLIENT_TIMEOUT_S = 2;
+
+    //! Maximum size of the request read (the rest is ignored)
+    static constexpr const std::size_t MAX_REQUEST_SIZE = 8192;
+};
+
+} /* namespace metrics */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSPROXY_METRICS_METRICSHTTPSERVER_HPP */
@@ -0,0 +1,266 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PrometheusSerializer.cpp
+ *
+ */
+
+#include <sstream>
+#include <utility>
+
+#include "PrometheusSerializer.hpp"
+
+namespace eprosima {
+namespace ddsproxy {
+namespace metrics {
+
+using namespace eprosima::ddspipe::core;
+
+namespace {
+
+//! Prefix of every metric exported
+constexpr const char* METRICS_PREFIX = "ddsproxy_";
+
+//! Description of each counter, indexed by \c MetricKind
+const char* counter_help(
+        const MetricKind kind)
+{
+    switch (kind)
+    {
+        case MetricKind::samples_in:
+            return "Samples taken from the readers.";
+        case MetricKind::bytes_in:
+            return "Bytes of the samples taken from the readers.";
+        case MetricKind::samples_out:
+            return "Samples written by the writers.";
+        case MetricKind::bytes_out:
+            return "Bytes of the samples written by the writers.";
+        case MetricKind::dropped_rate_limit:
+            return "Samples discarded by the max reception or transmission rate.";
+        case MetricKind::dropped_downsampling:
+            return "Samples discarded by downsampling.";
+        case MetricKind::dropped_writer_error:
+            return "Samples that a writer failed to write.";
+        case MetricKind::dropped_rejected:
+            return "Samples rejected by the reader history.";
+        case MetricKind::dropped_stale:
+            return "Samples discarded for being older than the max age.";
+        case MetricKind::dropped_duplicate:
+            return "Samples discarded for being duplicated.";
+        case MetricKind::dropped_filtered:
+            return "Samples discarded by the content filter.";
+        case MetricKind::dropped_malformed:
+            return "Samples discarded for not being decodable.";
+        case MetricKind::compression_bytes_in:
+            return "Original size of the payloads compressed.";
+        case MetricKind::compression_bytes_out:
+            return "Compressed size of the payloads compressed.";
+        case MetricKind::compression_time_ns:
+            return "Time spent compressing payloads in nanoseconds.";
+        case MetricKind::decompression_time_ns:
+            return "Time spent decompressing payloads in nanoseconds.";
+        default:
+            return "";
+    }
+}
+
+//! Escape a label value (backslash, double quote and line feed)
+std::string escape_label(
+        const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += c;
+                break;
+        }
+    }
+
+    return escaped;
+}
+
+//! Labels of a topic or a participant (without braces)
+std::string entity_labels(
+        const EntityMetricsSnapshot& entity,
+        const bool is_topic)
+{
+    if (is_topic)
+    {
+        return "topic=\"" + escape_label(entity.name) + "\",type=\"" + escape_label(entity.type_name) + "\"";
+    }
+
+    return "participant=\"" + escape_label(entity.name) + "\"";
+}
+
+//! Write the HELP and TYPE lines of a metric
+void write_header(
+        std::ostream& os,
+        const std::string& name,
+        const std::string& type,
+        const std::string& help)
+{
+    os << "# HELP " << METRICS_PREFIX << name << " " << help << "\n";
+    os << "# TYPE " << METRICS_PREFIX << name << " " << type << "\n";
+}
+
+//! Write a single sample without labels
+template <typename T>
+void write_value(
+        std::ostream& os,
+        const std::string& name,
+        const std::string& type,
+        const std::string& help,
+        const T& value)
+{
+    write_header(os, name, type, help);
+    os << METRICS_PREFIX << name << " " << value << "\n";
+}
+
+//! Write every counter and the latency histogram of a list of topics or participants
+void write_entities(
+        std::ostream& os,
+        const std::vector<EntityMetricsSnapshot>& entities,
+        const bool is_topic)
+{
+    const std::string entity_kind = is_topic ? "topic_" : "participant_";
+
+    for (const MetricKind kind : all_values_MetricKind())
+    {
+        const std::string name = entity_kind + to_string(kind) + "_total";
+        write_header(os, name, "counter", counter_help(kind));
+
+        for (const EntityMetricsSnapshot& entity : entities)
+        {
+            os << METRICS_PREFIX << name << "{" << entity_labels(entity, is_topic) << "} " << entity.value(kind) <<
+                "\n";
+        }
+    }
+
+    const std::string name = entity_kind + "latency_seconds";
+    write_header(os, name, "histogram", "Time from the reception of a sample to its write in each writer.");
+
+    for (const EntityMetricsSnapshot& entity : entities)
+    {
+        const std::string labels = entity_labels(entity, is_topic);
+        const LatencyHistogramSnapshot& latency = entity.latency;
+
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < latency.upper_bounds_us.size() && i < latency.counts.size(); ++i)
+        {
+            cumulative += latency.counts[i];
+            os << METRICS_PREFIX << name << "_bucket{" << labels << ",le=\"" <<
+                static_cast<double>(latency.upper_bounds_us[i]) / 1e6 << "\"} " << cumulative << "\n";
+        }
+        os << METRICS_PREFIX << name << "_bucket{" << labels << ",le=\"+Inf\"} " << latency.count << "\n";
+        os << METRICS_PREFIX << name << "_sum{" << labels << "} " << static_cast<double>(latency.sum_ns) / 1e9 << "\n";
+        os << METRICS_PREFIX << name << "_count{" << labels << "} " << latency.count << "\n";
+    }
+}
+
+//! Write the quantiles of the latency of every stage of the forwarding of each topic
+void write_topic_latencies(
+        std::ostream& os,
+        const std::vector<TopicLatencySnapshot>& latencies)
+{
+    const std::pair<const char*, double> quantiles[] = {{"0.5", 0.5}, {"0.99", 0.99}, {"0.999", 0.999}};
+
+    const std::string name = "topic_stage_latency_seconds";
+    write_header(os, name, "summary",
+            "Time waiting in the thread pool queue (queue_wait), from the take to the write in each writer "
+            "(forwarding) and from the reception to the write in each writer (end_to_end).");
+
+    for (const TopicLatencySnapshot& topic : latencies)
+    {
+        const std::pair<const char*, const LatencyDistributionSnapshot*> stages[] = {
+            {"queue_wait", &topic.queue_wait},
+            {"forwarding", &topic.forwarding},
+            {"end_to_end", &topic.end_to_end}};
+
+        for (const auto& stage : stages)
+        {
+            const std::string labels = "topic=\"" + escape_label(topic.name) + "\",type=\"" +
+                    escape_label(topic.type_name) + "\",stage=\"" + stage.first + "\"";
+            const LatencyDistributionSnapshot& latency = *stage.second;
+
+            for (const auto& quantile : quantiles)
+            {
+                os << METRICS_PREFIX << name << "{" << labels << ",quantile=\"" << quantile.first << "\"} " <<
+                    static_cast<double>(latency.percentile_ns(quantile.second)) / 1e9 << "\n";
+            }
+            os << METRICS_PREFIX << name << "_sum{" << labels << "} " << static_cast<double>(latency.sum_ns) / 1e9 <<
+                "\n";
+            os << METRICS_PREFIX << name << "_count{" << labels << "} " << latency.count << "\n";
+        }
+    }
+}
+
+} /* namespace */
+
+std::string serialize_prometheus(
+        const MetricsSnapshot& snapshot,
+        const bool master)
+{
+    std::ostringstream os;
+
+    // Enough digits for the sums in seconds to keep nanosecond resolution for a long time
+    os.precision(15);
+
+    // Failover state
+    write_value(os, "master", "gauge", "Whether this proxy is forwarding data (1) or standing by (0).",
+            master ? 1 : 0);
+
+    // Forwarding
+    write_entities(os, snapshot.topics, true);
+    write_entities(os, snapshot.participants, false);
+    write_topic_latencies(os, snapshot.latencies);
+
+    // Payload pool memory
+    write_value(os, "payload_pool_payloads_in_use", "gauge", "Payloads reserved and not released yet.",
+            snapshot.payload_pool.payloads_in_use);
+    write_value(os, "payload_pool_bytes_in_use", "gauge", "Bytes reserved and not released yet.",
+            snapshot.payload_pool.bytes_in_use);
+    write_value(os, "payload_pool_payloads_reserved_total", "counter", "Payloads reserved since startup.",
+            snapshot.payload_pool.payloads_reserved);
+
+    // Thread pool queue
+    write_value(os, "thread_pool_threads", "gauge", "Threads of the forwarding thread pool.",
+            snapshot.thread_pool.threads);
+    write_value(os, "thread_pool_busy_threads", "gauge", "Threads executing a forwarding task.",
+            snapshot.thread_pool.busy_threads);
+    write_value(os, "thread_pool_pending_tasks", "gauge", "Forwarding tasks waiting for a free thread.",
+            snapshot.thread_pool.pending_tasks);
+    write_value(os, "thread_pool_busy_seconds_total", "counter", "Time spent by the threads executing tasks.",
+            static_cast<double>(snapshot.thread_pool.busy_time_ns) / 1e9);
+
+    return os.str();
+}
+
+} /* namespace metrics */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
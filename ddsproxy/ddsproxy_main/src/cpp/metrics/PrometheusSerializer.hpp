@@ -0,0 +1,49 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PrometheusSerializer.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSPROXY_METRICS_PROMETHEUSSERIALIZER_HPP
+#define EPROSIMA_DDSPROXY_METRICS_PROMETHEUSSERIALIZER_HPP
+
+#include <string>
+
+#include <ddspipe_core/metrics/MetricsSnapshot.hpp>
+
+namespace eprosima {
+namespace ddsproxy {
+namespace metrics {
+
+/**
+ * @brief Serialize \c snapshot in Prometheus text exposition format (version 0.0.4).
+ *
+ * Counters of topics and participants are exported as \c _total counters, so rates are calculated by the scraper.
+ * Latencies are exported as cumulative histograms in seconds, and the latencies of each stage of the forwarding of
+ * a topic as summaries with their p50, p99 and p99.9.
+ *
+ * @param [in] snapshot : metrics of the DDS Proxy
+ * @param [in] master : whether this proxy is currently forwarding data (failover state)
+ */
+std::string serialize_prometheus(
+        const ddspipe::core::MetricsSnapshot& snapshot,
+        const bool master);
+
+} /* namespace metrics */
+} /* namespace ddsproxy */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSPROXY_METRICS_PROMETHEUSSERIALIZER_HPP */
@@ -113,6 +113,17 @@ const option::Descriptor usage[] = {
         "Value 0 does not set maximum. [Default: 0]."
     },
 
+    {
+        optionIndex::METRICS_PORT,
+        0,
+        "m",
+        "metrics-port",
+        Arg::Numeric,
+        "  -m \t--metrics-port\t  \t" \
+        "Serve the metrics in Prometheus text format in http://127.0.0.1:<port>/metrics . " \
+        "Value 0 does not serve them. [Default: 0]."
+    },
+
     ////////////////////
     // Debug options
     {
@@ -175,7 +186,8 @@ ProcessReturnCode parse_arguments(
         utils::Duration_ms& reload_time,
         utils::Duration_ms& timeout,
         std::string& log_filter,
-        eprosima::fastdds::dds::Log::Kind& log_verbosity)
+        eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        std::uint16_t& metrics_port)
 {
     // Variable to pretty print usage help
     int columns;
@@ -261,6 +273,18 @@ ProcessReturnCode parse_arguments(
                     log_filter = opt.arg;
                     break;
 
+                case optionIndex::METRICS_PORT:
+                {
+                    long port = std::stol(opt.arg);
+                    if (port < 0 || port > 65535)
+                    {
+                        logError(DDSPROXY_ARGS, "ERROR: Metrics port " << port << " is not a valid TCP port.");
+                        return ProcessReturnCode::incorrect_argument;
+                    }
+                    metrics_port = static_cast<std::uint16_t>(port);
+                    break;
+                }
+
                 case optionIndex::LOG_VERBOSITY:
                     log_verbosity = eprosima::fastdds::dds::Log::Kind(static_cast<int>(from_string_LogKind(opt.arg)));
                     break;
@@ -20,6 +20,7 @@
 #ifndef EPROSIMA_DDSPROXY_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
 #define EPROSIMA_DDSPROXY_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
 
+#include <cstdint>
 #include <string>
 
 #include <optionparser.h>
@@ -99,6 +100,7 @@ enum optionIndex
     TIMEOUT,
     LOG_FILTER,
     LOG_VERBOSITY,
+    METRICS_PORT,
 };
 
 /**
@@ -119,6 +121,7 @@ extern const option::Descriptor usage[];
  * @param [out] reload_time time in milliseconds to reload the configuration file
  * @param [out] activate_debug activate log info
  * @param [out] timeout time in milliseconds to maximum proxy execution time
+ * @param [out] metrics_port local port to serve the Prometheus metrics (0 to not serve them)
  *
  * @return \c SUCCESS if everything OK
  * @return \c INCORRECT_ARGUMENT if arguments were incorrect (unknown or incorrect value)
@@ -132,7 +135,8 @@ ProcessReturnCode parse_arguments(
         utils::Duration_ms& reload_time,
         utils::Duration_ms& timeout,
         std::string& log_filter,
-        eprosima::fastdds::dds::Log::Kind& log_verbosity);
+        eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        std::uint16_t& metrics_port);
 
 //! \c Option to stream serializator
 std::ostream& operator <<(
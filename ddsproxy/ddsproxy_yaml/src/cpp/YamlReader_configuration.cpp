@@ -14,9 +14,11 @@
 
 #include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/EchoParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/GeneratorParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/InitialPeersParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/SinkParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/XmlParticipantConfiguration.hpp>
 
 #include <ddspipe_yaml/yaml_configuration_tags.hpp>
@@ -46,6 +48,110 @@ void YamlReader::fill(
         object.number_of_threads = YamlReader::get<unsigned int>(yml, NUMBER_THREADS_TAG, version);
     }
 
+    /////
+    // Get optional thread autoscaling
+    if (YamlReader::is_tag_present(yml, THREADS_AUTOSCALING_TAG))
+    {
+        const Yaml autoscaling_yml = YamlReader::get_value_in_tag(yml, THREADS_AUTOSCALING_TAG);
+        ddsproxy::core::ThreadAutoscalingConfiguration& autoscaling = object.thread_autoscaling;
+
+        autoscaling.enabled = true;
+
+        // By default, autoscale up to the number of threads configured
+        autoscaling.max_threads = object.number_of_threads;
+
+        if (YamlReader::is_tag_present(autoscaling_yml, THREADS_AUTOSCALING_MIN_TAG))
+        {
+            autoscaling.min_threads = YamlReader::get<unsigned int>(autoscaling_yml, THREADS_AUTOSCALING_MIN_TAG,
+                            version);
+        }
+
+        if (YamlReader::is_tag_present(autoscaling_yml, THREADS_AUTOSCALING_MAX_TAG))
+        {
+            autoscaling.max_threads = YamlReader::get<unsigned int>(autoscaling_yml, THREADS_AUTOSCALING_MAX_TAG,
+                            version);
+        }
+
+        if (YamlReader::is_tag_present(autoscaling_yml, THREADS_AUTOSCALING_PERIOD_TAG))
+        {
+            autoscaling.period = YamlReader::get<unsigned int>(autoscaling_yml, THREADS_AUTOSCALING_PERIOD_TAG,
+                            version);
+        }
+
+        if (YamlReader::is_tag_present(autoscaling_yml, THREADS_AUTOSCALING_SCALE_UP_TAG))
+        {
+            autoscaling.scale_up_utilization = YamlReader::get<double>(autoscaling_yml,
+                            THREADS_AUTOSCALING_SCALE_UP_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(autoscaling_yml, THREADS_AUTOSCALING_SCALE_DOWN_TAG))
+        {
+            autoscaling.scale_down_utilization = YamlReader::get<double>(autoscaling_yml,
+                            THREADS_AUTOSCALING_SCALE_DOWN_TAG, version);
+        }
+    }
+
+    /////
+    // Get optional monitor
+    if (YamlReader::is_tag_present(yml, MONITOR_TAG))
+    {
+        const Yaml monitor_yml = YamlReader::get_value_in_tag(yml, MONITOR_TAG);
+        ddsproxy::core::MonitorConfiguration& monitor = object.monitor;
+
+        monitor.enabled = true;
+
+        if (YamlReader::is_tag_present(monitor_yml, MONITOR_PERIOD_TAG))
+        {
+            monitor.period = YamlReader::get<unsigned int>(monitor_yml, MONITOR_PERIOD_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(monitor_yml, MONITOR_TOPIC_TAG))
+        {
+            monitor.topic_name = YamlReader::get<std::string>(monitor_yml, MONITOR_TOPIC_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(monitor_yml, MONITOR_ID_TAG))
+        {
+            monitor.proxy_id = YamlReader::get<std::string>(monitor_yml, MONITOR_ID_TAG, version);
+        }
+    }
+
+    /////
+    // Get optional number of threads to create the bridges
+    if (YamlReader::is_tag_present(yml, BRIDGE_CREATION_THREADS_TAG))
+    {
+        object.bridge_creation_threads = YamlReader::get<unsigned int>(yml, BRIDGE_CREATION_THREADS_TAG, version);
+    }
+
+    /////
+    // Get optional time to live of idle bridges
+    if (YamlReader::is_tag_present(yml, IDLE_BRIDGE_TTL_TAG))
+    {
+        object.idle_bridge_ttl = YamlReader::get<unsigned int>(yml, IDLE_BRIDGE_TTL_TAG, version);
+    }
+
+    /////
+    // Get optional discovery snapshot
+    if (YamlReader::is_tag_present(yml, DISCOVERY_SNAPSHOT_TAG))
+    {
+        const Yaml snapshot_yml = YamlReader::get_value_in_tag(yml, DISCOVERY_SNAPSHOT_TAG);
+
+        object.discovery_snapshot_file = YamlReader::get<std::string>(snapshot_yml, DISCOVERY_SNAPSHOT_FILE_TAG,
+                        version);
+
+        if (YamlReader::is_tag_present(snapshot_yml, DISCOVERY_SNAPSHOT_PERIOD_TAG))
+        {
+            object.discovery_snapshot_period = YamlReader::get<unsigned int>(snapshot_yml,
+                            DISCOVERY_SNAPSHOT_PERIOD_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(snapshot_yml, DISCOVERY_SNAPSHOT_RECONCILE_TIMEOUT_TAG))
+        {
+            object.discovery_snapshot_reconcile_timeout = YamlReader::get<unsigned int>(snapshot_yml,
+                            DISCOVERY_SNAPSHOT_RECONCILE_TIMEOUT_TAG, version);
+        }
+    }
+
     /////
     // Get optional remove unused entities tag
     if (YamlReader::is_tag_present(yml, REMOVE_UNUSED_ENTITIES_TAG))
@@ -64,7 +170,6 @@ void YamlReader::fill(
     if (is_tag_present(yml, SPECS_QOS_TAG))
     {
         fill<core::types::TopicQoS>(object.topic_qos, get_value_in_tag(yml, SPECS_QOS_TAG), version);
-        core::types::TopicQoS::default_topic_qos.set_value(object.topic_qos);
     }
 
     /////
@@ -115,6 +220,14 @@ YamlReader::get<std::shared_ptr<participants::ParticipantConfiguration>>(
             return std::make_shared<participants::EchoParticipantConfiguration>(
                 YamlReader::get<participants::EchoParticipantConfiguration>(yml, version));
 
+        case ddsproxy::core::types::ParticipantKind::generator:
+            return std::make_shared<participants::GeneratorParticipantConfiguration>(
+                YamlReader::get<participants::GeneratorParticipantConfiguration>(yml, version));
+
+        case ddsproxy::core::types::ParticipantKind::sink:
+            return std::make_shared<participants::SinkParticipantConfiguration>(
+                YamlReader::get<participants::SinkParticipantConfiguration>(yml, version));
+
         case ddsproxy::core::types::ParticipantKind::simple:
             return std::make_shared<participants::SimpleParticipantConfiguration>(
                 YamlReader::get<participants::SimpleParticipantConfiguration>(yml, version));
@@ -223,6 +336,10 @@ void YamlReader::fill(
         const Yaml& yml,
         const YamlReaderVersion version)
 {
+    // The default Topic QoS is not modified while parsing, so a TopicQoS constructed here never has the specs of
+    // the running configuration (i.e. in a reload). The DdsPipe installs them once the configuration is applied.
+    object.advanced_options.topic_qos = core::types::TopicQoS();
+
     /////
     // Get participants configurations. Required field, if get_value_in_tag fail propagate exception.
     auto participants_configurations_yml = YamlReader::get_value_in_tag(yml, COLLECTION_PARTICIPANTS_TAG);
@@ -264,13 +381,19 @@ void YamlReader::fill(
 
     /* NOTE
      *
-     * remove_unused_entities and discovery_trigger are attributes of SpecsConfiguration because they are
-     * under the tag specs, but since they are used in the DdsPipe, we have two choices: copying them to the
+     * remove_unused_entities, discovery_trigger and bridge_creation_threads are attributes of SpecsConfiguration
+     * because they are under the tag specs, but since they are used in the DdsPipe, we have two choices: copying them to the
      * DdsPipeConfiguration, as we are doing, or refilling the SpecsConfiguraton in the DdsPipeConfiguration fill
      * and taking both attributes from there.
      */
     object.ddspipe_configuration.remove_unused_entities = object.advanced_options.remove_unused_entities;
     object.ddspipe_configuration.discovery_trigger = object.advanced_options.discovery_trigger;
+    object.ddspipe_configuration.bridge_creation_threads = object.advanced_options.bridge_creation_threads;
+    object.ddspipe_configuration.discovery_snapshot_file = object.advanced_options.discovery_snapshot_file;
+    object.ddspipe_configuration.discovery_snapshot_period = object.advanced_options.discovery_snapshot_period;
+    object.ddspipe_configuration.discovery_snapshot_reconcile_timeout =
+            object.advanced_options.discovery_snapshot_reconcile_timeout;
+    object.ddspipe_configuration.idle_bridge_ttl = object.advanced_options.idle_bridge_ttl;
 
     /**
      * master_flag is attributes of ProxyConfiguration,
@@ -279,6 +402,21 @@ void YamlReader::fill(
     */
     object.ddspipe_configuration.master_flag = object.advanced_options.master_flag;
 
+    // The Topic QoS of specs are the default of every topic, and are imposed over the bridges being rebuilt when
+    // the configuration is reloaded
+    object.ddspipe_configuration.topic_qos = object.advanced_options.topic_qos;
+
+    // The builtin topics are already parsed, so the Topic QoS of specs are applied explicitly as their default
+    std::set<utils::Heritable<core::types::DistributedTopic>> builtin_topics;
+    for (const auto& topic : object.ddspipe_configuration.builtin_topics)
+    {
+        utils::Heritable<core::types::DistributedTopic> builtin_topic = topic->copy();
+        builtin_topic->topic_qos.set_qos(object.ddspipe_configuration.topic_qos,
+                utils::FuzzyLevelValues::fuzzy_level_set);
+        builtin_topics.insert(builtin_topic);
+    }
+    object.ddspipe_configuration.builtin_topics = builtin_topics;
+
     /////
     // Get optional xml configuration
     if (YamlReader::is_tag_present(yml, XML_TAG))
@@ -19,10 +19,12 @@
 #pragma once
 
 #include <iostream>
+#include <sstream>
 
 // Use FastDDS log
 #include <fastdds/dds/log/Log.hpp>
 
+#include <cpp_utils/logging/AsyncLogWriter.hpp>
 #include <cpp_utils/macros/macros.hpp>
 
 namespace eprosima {
@@ -51,11 +53,18 @@ using LogConsumer = eprosima::fastdds::dds::LogConsumer;
 /**
  * @brief Log level for messages that will be shown to the User (user interactions, start or finish process, etc.)
  *
+ * The message is written by the user \c AsyncLogWriter if there is one set, or directly in std::cout otherwise.
+ *
  * @note As this level is not implemented, it is used as Info level.
  *
  * @todo Decide if setting the log TAG as in fastrtps logging or not.
  */
-#define logUser(cat, msg) std::cout /* << STRINGIFY(cat) << " : " */ << msg << std::endl;
+#define logUser(cat, msg)                                                                   \
+    {                                                                                       \
+        std::ostringstream cpp_utils_log_user_ss_tmp__;                                     \
+        cpp_utils_log_user_ss_tmp__ /* << STRINGIFY(cat) << " : " */ << msg;                \
+        eprosima::utils::AsyncLogWriter::write_user(cpp_utils_log_user_ss_tmp__.str());     \
+    }
 
 
 // Allow multiconfig platforms like windows to disable info queueing on Release and other non-debug configs
@@ -0,0 +1,167 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncLogWriter.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * Writes log lines in \c std::cout and \c std::cerr from a background thread.
+ *
+ * The lines are pushed in a bounded lock-free multiple producer single consumer ring buffer, so pushing a line never
+ * blocks nor takes a lock. The background thread takes every pending line at once, writes them in a single call per
+ * stream and flushes each stream once per batch instead of once per line.
+ *
+ * If the ring buffer is full the line is dropped, and the number of lines dropped is reported in the next batch.
+ */
+class AsyncLogWriter
+{
+public:
+
+    /**
+     * @brief Create the writer and start its thread.
+     *
+     * @param capacity : maximum number of pending lines (rounded up to a power of 2)
+     */
+    CPP_UTILS_DllAPI AsyncLogWriter(
+            const std::size_t capacity = DEFAULT_CAPACITY);
+
+    //! Write every pending line and stop the thread
+    CPP_UTILS_DllAPI ~AsyncLogWriter();
+
+    /**
+     * @brief Push a line to be written (a line feed is added at the end).
+     *
+     * @param line : text to write
+     * @param error_stream : whether it is written in \c std::cerr instead of \c std::cout
+     *
+     * @return false if the ring buffer is full and the line has been dropped
+     *
+     * Thread safe and lock free.
+     */
+    CPP_UTILS_DllAPI bool push(
+            std::string&& line,
+            const bool error_stream = false) noexcept;
+
+    //! Wait until every line pushed before calling it has been written
+    CPP_UTILS_DllAPI void flush();
+
+    //! Number of lines dropped because the ring buffer was full
+    CPP_UTILS_DllAPI std::uint64_t lines_dropped() const noexcept;
+
+    /**
+     * @brief Set the writer used by \c logUser .
+     *
+     * While no writer is set (or after setting nullptr), \c logUser writes directly in \c std::cout .
+     */
+    CPP_UTILS_DllAPI static void set_user_writer(
+            const std::shared_ptr<AsyncLogWriter>& writer);
+
+    //! Write a \c logUser message with the user writer, or directly in \c std::cout if there is none
+    CPP_UTILS_DllAPI static void write_user(
+            std::string&& message);
+
+    //! Default number of pending lines
+    static constexpr const std::size_t DEFAULT_CAPACITY = 8192;
+
+    //! Time the thread waits for new lines before checking the ring buffer again
+    static constexpr const std::chrono::milliseconds IDLE_PERIOD = std::chrono::milliseconds(50);
+
+protected:
+
+    //! Slot of the ring buffer
+    struct Cell
+    {
+        //! Position that the slot is waiting for (to be pushed if equal, to be popped if one more)
+        std::atomic<std::size_t> sequence;
+
+        std::string line;
+
+        bool error_stream;
+    };
+
+    //! Routine of the background thread
+    void run_() noexcept;
+
+    /**
+     * @brief Pop every pending line and write them.
+     *
+     * @return number of lines written
+     */
+    std::size_t write_batch_() noexcept;
+
+    //! Whether there are no pending lines
+    bool empty_() const noexcept;
+
+    //! Process writer used by \c logUser
+    static std::shared_ptr<AsyncLogWriter>& user_writer_() noexcept;
+
+    //! Ring buffer
+    std::vector<Cell> buffer_;
+
+    //! Mask to get the slot of a position (capacity - 1)
+    const std::size_t mask_;
+
+    //! Next position to push
+    alignas(64) std::atomic<std::size_t> enqueue_position_;
+
+    //! Next position to pop (only accessed by the thread)
+    alignas(64) std::size_t dequeue_position_;
+
+    //! Position up to which every line has been written
+    std::atomic<std::size_t> written_position_;
+
+    //! Lines dropped since the last batch
+    std::atomic<std::uint64_t> pending_dropped_;
+
+    //! Lines dropped since the writer was created
+    std::atomic<std::uint64_t> lines_dropped_;
+
+    //! Whether the thread is waiting for new lines
+    std::atomic<bool> waiting_;
+
+    //! Whether the thread must stop
+    std::atomic<bool> stop_;
+
+    //! Protects the waits of the thread and of \c flush
+    std::mutex mutex_;
+
+    //! Awakes the thread when a line is pushed while it is waiting
+    std::condition_variable data_cv_;
+
+    //! Awakes \c flush callers when a batch has been written
+    std::condition_variable written_cv_;
+
+    std::thread thread_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
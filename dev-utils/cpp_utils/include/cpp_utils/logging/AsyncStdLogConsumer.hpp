@@ -0,0 +1,135 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncStdLogConsumer.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/logging/AsyncLogWriter.hpp>
+#include <cpp_utils/logging/CustomStdLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * Log Consumer with the same filtering than \c CustomStdLogConsumer that does not write the entries itself.
+ *
+ * The entries accepted are formatted and pushed to an \c AsyncLogWriter , so Fast DDS Log thread never waits for
+ * the console and the entries are written in batches.
+ * The category regex is evaluated only once per category, and its result is kept for the next entries.
+ *
+ * Each place of the code that logs (file and line, or category and message if unknown) is rate limited: after
+ * \c max_repetitions entries in a \c repetition_period , the next entries of the same place are suppressed until the
+ * period ends. The number of entries suppressed is written with the next entry of that place that is accepted,
+ * or when the consumer is destroyed.
+ *
+ * @note Fast DDS Log calls \c Consume from its single thread, so the consumer state is not protected.
+ */
+class AsyncStdLogConsumer : public CustomStdLogConsumer
+{
+public:
+
+    /**
+     * @brief Create a new AsyncStdLogConsumer.
+     *
+     * @param log_filter : regex that the category of the entries must match (Error entries excepted)
+     * @param log_verbosity : maximum Log Kind that will be printed
+     * @param writer : writer where the entries are pushed
+     * @param max_repetitions : maximum number of entries of the same place each period (0 <=> no limit)
+     * @param repetition_period : period of the rate limit
+     */
+    CPP_UTILS_DllAPI AsyncStdLogConsumer(
+            const std::string& log_filter,
+            const eprosima::fastdds::dds::Log::Kind& log_verbosity,
+            const std::shared_ptr<AsyncLogWriter>& writer,
+            const std::uint32_t max_repetitions = DEFAULT_MAX_REPETITIONS,
+            const std::chrono::milliseconds& repetition_period = DEFAULT_REPETITION_PERIOD);
+
+    //! Report the entries suppressed and not reported yet
+    CPP_UTILS_DllAPI ~AsyncStdLogConsumer() noexcept;
+
+    /**
+     * @brief Implements \c LogConsumer \c Consume method.
+     *
+     * The \c entry is formatted as in \c CustomStdLogConsumer and pushed to the writer if it is accepted and not
+     * suppressed by the rate limit.
+     *
+     * @param entry entry to consume
+     */
+    CPP_UTILS_DllAPI void Consume(
+            const Log::Entry& entry) override;
+
+    //! Default maximum number of entries of the same place each period
+    static constexpr const std::uint32_t DEFAULT_MAX_REPETITIONS = 10;
+
+    //! Default period of the rate limit
+    static constexpr const std::chrono::milliseconds DEFAULT_REPETITION_PERIOD = std::chrono::milliseconds(1000);
+
+protected:
+
+    //! Rate limit state of a place of the code
+    struct RepetitionState
+    {
+        //! Beginning of the current period
+        std::chrono::steady_clock::time_point period_start{};
+
+        //! Entries accepted in the current period
+        std::uint32_t entries{0};
+
+        //! Entries suppressed not reported yet
+        std::uint64_t suppressed{0};
+    };
+
+    //! Same as \c CustomStdLogConsumer but with the regex result cached by category
+    CPP_UTILS_DllAPI bool accept_entry_(
+            const Log::Entry& entry) override;
+
+    /**
+     * @brief Update the rate limit state of the place of \c entry .
+     *
+     * @param [out] suppressed : entries of the same place suppressed before this one and not reported yet
+     *
+     * @return false if \c entry must be suppressed
+     */
+    bool pass_rate_limit_(
+            const Log::Entry& entry,
+            std::uint64_t& suppressed);
+
+    //! Writer where the entries are pushed
+    std::shared_ptr<AsyncLogWriter> writer_;
+
+    //! Maximum number of entries of the same place each period
+    const std::uint32_t max_repetitions_;
+
+    //! Period of the rate limit
+    const std::chrono::steady_clock::duration repetition_period_;
+
+    //! Whether each category seen matches the filter regex
+    std::unordered_map<std::string, bool> category_filter_cache_;
+
+    //! Rate limit state of each place of the code
+    std::unordered_map<std::string, RepetitionState> repetitions_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,57 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file tracepoints.hpp
+ *
+ * This file contains the macro to add static tracepoints (USDT probes) to the code.
+ */
+
+#pragma once
+
+/**
+ * Static tracepoints are compiled as USDT probes (SystemTap \c sys/sdt.h ) whenever that header is available, unless
+ * \c CPP_UTILS_DISABLE_TRACEPOINTS is defined. Otherwise they are removed and their arguments are not evaluated.
+ *
+ * A probe is a single \c nop instruction plus a note in the ELF file, so it has no measurable cost while no tracer is
+ * attached. Tools as perf, bpftrace or LTTng (through its USDT support) can attach to them in a running process:
+ *
+ * @example
+ * bpftrace -e 'usdt:./ddsproxy:ddspipe:track_take { @[arg0] = count(); }' -p $(pidof ddsproxy)
+ *
+ * @note The arguments are evaluated when the probes are compiled even if no tracer is attached, so they must be
+ * cheap values (integers or pointers) already at hand.
+ */
+#if !defined(CPP_UTILS_DISABLE_TRACEPOINTS) && defined(__has_include)
+#  if __has_include(<sys/sdt.h>)
+#    include <sys/sdt.h>
+#    define CPP_UTILS_TRACEPOINTS_ENABLED 1
+#  endif // if __has_include(<sys/sdt.h>)
+#endif // if !defined(CPP_UTILS_DISABLE_TRACEPOINTS) && defined(__has_include)
+
+#ifdef CPP_UTILS_TRACEPOINTS_ENABLED
+
+/**
+ * @brief Static tracepoint \c name of \c provider with up to 12 integer or pointer arguments.
+ *
+ * @example
+ * CPP_UTILS_TRACEPOINT(cpp_utils, thread_pool_dequeue, this, task_id);
+ */
+#define CPP_UTILS_TRACEPOINT(provider, name, ...) STAP_PROBEV(provider, name, ## __VA_ARGS__)
+
+#else
+
+#define CPP_UTILS_TRACEPOINT(provider, name, ...) do {} while (false)
+
+#endif // ifdef CPP_UTILS_TRACEPOINTS_ENABLED
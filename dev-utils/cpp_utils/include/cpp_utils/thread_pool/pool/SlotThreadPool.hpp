@@ -20,7 +20,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -128,8 +132,52 @@ public:
     CPP_UTILS_DllAPI utils::event::AwakeReason wait_all_consumed(
             const utils::Duration_ms& timeout = 0);
 
+    /**
+     * @brief Change the number of threads in the pool.
+     *
+     * If the pool is enabled, the new threads start consuming tasks right away, and the threads removed finish their
+     * current task before exiting. It does not block waiting for them: they are joined in the next call to
+     * \c resize or when the pool is disabled.
+     *
+     * @param n_threads new number of threads in the pool
+     *
+     * @throw \c ValueNotAllowedException if \c n_threads is 0
+     */
+    CPP_UTILS_DllAPI void resize(
+            const uint32_t n_threads);
+
+    //! Number of threads in the pool (the ones being removed are not counted)
+    CPP_UTILS_DllAPI uint32_t number_of_threads() const noexcept;
+
+    //! Number of threads executing a task at this moment
+    CPP_UTILS_DllAPI uint32_t busy_threads() const noexcept;
+
+    //! Number of tasks emitted waiting for a free thread
+    CPP_UTILS_DllAPI uint64_t pending_tasks() const noexcept;
+
+    //! Time spent by all the threads executing tasks since the pool was created [ns]
+    CPP_UTILS_DllAPI uint64_t busy_time() const noexcept;
+
 protected:
 
+    //! A thread of the pool and the flags to remove it
+    struct Worker
+    {
+        //! Whether the thread must exit after its current task
+        std::shared_ptr<std::atomic<bool>> stop;
+
+        //! Whether the thread has exited, so it can be joined without blocking
+        std::shared_ptr<std::atomic<bool>> finished;
+
+        CustomThread thread;
+    };
+
+    //! Create a new thread in \c workers_ . Must be called with \c threads_mutex_ locked.
+    void add_worker_nts_();
+
+    //! Join the threads in \c retired_workers_ that have already exited. Must be called with \c threads_mutex_ locked.
+    void join_finished_workers_nts_();
+
     /**
      * @brief This is the function that every thread in the pool executes.
      *
@@ -137,11 +185,15 @@ protected:
      * wait for an element to be added to the queue in case it is empty, and it will take one if any available).
      * Once a task id is available, it will get the task refering this id and execute it
      * Afterwards it will return to consume another task id.
-     * This will be repeated until the queue is disabled, what is communicated by a \c DisabledException .
+     * This will be repeated until the queue is disabled, what is communicated by a \c DisabledException ,
+     * or until \c stop is set by \c resize .
      */
-    void thread_routine_();
+    void thread_routine_(
+            std::shared_ptr<std::atomic<bool>> stop,
+            std::shared_ptr<std::atomic<bool>> finished);
 
-    unsigned int number_of_threads_;
+    //! Number of threads in the pool (only modified with \c threads_mutex_ locked)
+    std::atomic<uint32_t> number_of_threads_;
 
     /**
      * @brief Double Queue Wait Handler to store task ids
@@ -164,7 +216,19 @@ protected:
      * @note \c CustomThread are used instead of \c std::thread so some extra logic could be added to threads
      * in future implementation (e.g. performance info).
      */
-    std::vector<CustomThread> threads_;
+    std::vector<Worker> workers_;
+
+    //! Threads removed by \c resize that have not been joined yet
+    std::vector<Worker> retired_workers_;
+
+    //! Protects access to \c workers_ , \c retired_workers_ and \c number_of_threads_ .
+    std::mutex threads_mutex_;
+
+    //! Number of threads executing a task
+    std::atomic<uint32_t> busy_threads_;
+
+    //! Time spent executing tasks [ns]
+    std::atomic<uint64_t> busy_time_;
 
     /**
      * @brief Map of tasks indexed by their task Id.
@@ -0,0 +1,267 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncLogWriter.cpp
+ *
+ */
+
+#include <iostream>
+
+#include <cpp_utils/logging/AsyncLogWriter.hpp>
+
+namespace eprosima {
+namespace utils {
+
+constexpr const std::size_t AsyncLogWriter::DEFAULT_CAPACITY;
+constexpr const std::chrono::milliseconds AsyncLogWriter::IDLE_PERIOD;
+
+namespace {
+
+//! Smallest power of 2 greater or equal than \c value (and at least 2)
+std::size_t next_power_of_2(
+        const std::size_t value) noexcept
+{
+    std::size_t power = 2;
+    while (power < value)
+    {
+        power <<= 1;
+    }
+    return power;
+}
+
+} /* namespace */
+
+AsyncLogWriter::AsyncLogWriter(
+        const std::size_t capacity /* = DEFAULT_CAPACITY */)
+    : buffer_(next_power_of_2(capacity))
+    , mask_(buffer_.size() - 1)
+    , enqueue_position_(0)
+    , dequeue_position_(0)
+    , written_position_(0)
+    , pending_dropped_(0)
+    , lines_dropped_(0)
+    , waiting_(false)
+    , stop_(false)
+{
+    for (std::size_t i = 0; i < buffer_.size(); ++i)
+    {
+        buffer_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    thread_ = std::thread(&AsyncLogWriter::run_, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_.store(true);
+    }
+    data_cv_.notify_one();
+
+    thread_.join();
+}
+
+bool AsyncLogWriter::push(
+        std::string&& line,
+        const bool error_stream /* = false */) noexcept
+{
+    Cell* cell;
+    std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell = &buffer_[position & mask_];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+        if (difference == 0)
+        {
+            // The slot is free, try to reserve it
+            if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // The slot still holds a line not written, so the buffer is full
+            pending_dropped_.fetch_add(1, std::memory_order_relaxed);
+            lines_dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            // Another producer has reserved this position
+            position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->line = std::move(line);
+    cell->error_stream = error_stream;
+    cell->sequence.store(position + 1, std::memory_order_release);
+
+    // Only wake the thread when it is idle, so a log storm does not pay for a notification per line
+    if (waiting_.load())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+        }
+        data_cv_.notify_one();
+    }
+
+    return true;
+}
+
+void AsyncLogWriter::flush()
+{
+    const std::size_t target = enqueue_position_.load();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    data_cv_.notify_one();
+    written_cv_.wait(lock, [this, target]()
+            {
+                // Once stopped, nothing else will be written
+                return written_position_.load() >= target || stop_.load();
+            });
+}
+
+std::uint64_t AsyncLogWriter::lines_dropped() const noexcept
+{
+    return lines_dropped_.load(std::memory_order_relaxed);
+}
+
+void AsyncLogWriter::set_user_writer(
+        const std::shared_ptr<AsyncLogWriter>& writer)
+{
+    std::atomic_store(&user_writer_(), writer);
+}
+
+void AsyncLogWriter::write_user(
+        std::string&& message)
+{
+    std::shared_ptr<AsyncLogWriter> writer = std::atomic_load(&user_writer_());
+
+    if (writer)
+    {
+        writer->push(std::move(message));
+    }
+    else
+    {
+        std::cout << message << std::endl;
+    }
+}
+
+void AsyncLogWriter::run_() noexcept
+{
+    while (true)
+    {
+        if (write_batch_() > 0)
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (stop_.load())
+        {
+            break;
+        }
+
+        waiting_.store(true);
+        data_cv_.wait_for(lock, IDLE_PERIOD, [this]()
+                {
+                    return stop_.load() || !empty_();
+                });
+        waiting_.store(false);
+    }
+
+    // Write the lines pushed while stopping
+    write_batch_();
+
+    // Awake any flush still waiting
+    std::lock_guard<std::mutex> lock(mutex_);
+    written_cv_.notify_all();
+}
+
+std::size_t AsyncLogWriter::write_batch_() noexcept
+{
+    std::string out_batch;
+    std::string err_batch;
+    std::size_t lines = 0;
+
+    // Pop every line pushed so far (lines pushed meanwhile are taken in the next batch)
+    const std::size_t last_position = enqueue_position_.load(std::memory_order_relaxed);
+    while (dequeue_position_ != last_position)
+    {
+        Cell& cell = buffer_[dequeue_position_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1)
+        {
+            // The producer has reserved the slot but it has not finished writing it yet
+            break;
+        }
+
+        std::string& batch = cell.error_stream ? err_batch : out_batch;
+        batch += cell.line;
+        batch += '\n';
+        cell.line.clear();
+
+        cell.sequence.store(dequeue_position_ + mask_ + 1, std::memory_order_release);
+        ++dequeue_position_;
+        ++lines;
+    }
+
+    const std::uint64_t dropped = pending_dropped_.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+    {
+        err_batch += std::to_string(dropped) + " log messages dropped because the log buffer was full.\n";
+    }
+
+    if (!out_batch.empty())
+    {
+        std::cout.write(out_batch.data(), static_cast<std::streamsize>(out_batch.size()));
+        std::cout.flush();
+    }
+
+    if (!err_batch.empty())
+    {
+        std::cerr.write(err_batch.data(), static_cast<std::streamsize>(err_batch.size()));
+        std::cerr.flush();
+    }
+
+    if (lines > 0)
+    {
+        written_position_.store(dequeue_position_);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        written_cv_.notify_all();
+    }
+
+    return lines;
+}
+
+bool AsyncLogWriter::empty_() const noexcept
+{
+    return buffer_[dequeue_position_ & mask_].sequence.load(std::memory_order_acquire) != dequeue_position_ + 1;
+}
+
+std::shared_ptr<AsyncLogWriter>& AsyncLogWriter::user_writer_() noexcept
+{
+    static std::shared_ptr<AsyncLogWriter> writer;
+    return writer;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,179 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncStdLogConsumer.cpp
+ *
+ */
+
+#include <sstream>
+
+#include <cpp_utils/logging/AsyncStdLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+
+constexpr const std::uint32_t AsyncStdLogConsumer::DEFAULT_MAX_REPETITIONS;
+constexpr const std::chrono::milliseconds AsyncStdLogConsumer::DEFAULT_REPETITION_PERIOD;
+
+namespace {
+
+//! Maximum number of places tracked by the rate limit, so it cannot grow without bounds
+constexpr const std::size_t MAX_TRACKED_PLACES = 4096;
+
+} /* namespace */
+
+AsyncStdLogConsumer::AsyncStdLogConsumer(
+        const std::string& log_filter,
+        const eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        const std::shared_ptr<AsyncLogWriter>& writer,
+        const std::uint32_t max_repetitions /* = DEFAULT_MAX_REPETITIONS */,
+        const std::chrono::milliseconds& repetition_period /* = DEFAULT_REPETITION_PERIOD */)
+    : CustomStdLogConsumer(log_filter, log_verbosity)
+    , writer_(writer)
+    , max_repetitions_(max_repetitions)
+    , repetition_period_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(repetition_period))
+{
+    // Do nothing
+}
+
+AsyncStdLogConsumer::~AsyncStdLogConsumer() noexcept
+{
+    for (const auto& it : repetitions_)
+    {
+        if (it.second.suppressed > 0)
+        {
+            writer_->push(
+                std::to_string(it.second.suppressed) + " repeated log messages suppressed from " + it.first + ".",
+                true);
+        }
+    }
+}
+
+void AsyncStdLogConsumer::Consume(
+        const utils::Log::Entry& entry)
+{
+    if (!accept_entry_(entry))
+    {
+        return;
+    }
+
+    std::uint64_t suppressed = 0;
+    if (!pass_rate_limit_(entry, suppressed))
+    {
+        return;
+    }
+
+    std::ostringstream stream;
+    print_timestamp(stream, entry, true);
+    print_header(stream, entry, true);
+    print_message(stream, entry, true);
+    if (suppressed > 0)
+    {
+        stream << " (" << suppressed << " repeated messages suppressed)";
+    }
+    print_context(stream, entry, true);
+
+    writer_->push(stream.str(), entry.kind >= eprosima::fastdds::dds::Log::Kind::Warning);
+}
+
+bool AsyncStdLogConsumer::accept_entry_(
+        const Log::Entry& entry)
+{
+    // Filter by kind
+    if (entry.kind > verbosity_)
+    {
+        return false;
+    }
+    else if (entry.kind == eprosima::fastdds::dds::Log::Kind::Error &&
+            entry.kind < verbosity_)
+    {
+        // In case it is an error message and verbosity is not error, filter does not care
+        return true;
+    }
+
+    // Filter by regex, only the first time each category is seen
+    auto it = category_filter_cache_.find(entry.context.category);
+    if (it == category_filter_cache_.end())
+    {
+        it = category_filter_cache_.emplace(
+            entry.context.category,
+            std::regex_search(entry.context.category, filter_)).first;
+    }
+
+    return it->second;
+}
+
+bool AsyncStdLogConsumer::pass_rate_limit_(
+        const Log::Entry& entry,
+        std::uint64_t& suppressed)
+{
+    if (max_repetitions_ == 0)
+    {
+        return true;
+    }
+
+    // Entries of the same place usually differ in some value (sequence numbers, guids, ...), so the place is used
+    // as key whenever it is known
+    const std::string place = entry.context.filename ?
+            std::string(entry.context.filename) + ":" + std::to_string(entry.context.line) :
+            std::string(entry.context.category ? entry.context.category : "") + ": " + entry.message;
+
+    const auto now = std::chrono::steady_clock::now();
+
+    auto it = repetitions_.find(place);
+    if (it == repetitions_.end())
+    {
+        if (repetitions_.size() >= MAX_TRACKED_PLACES)
+        {
+            // Forget the places whose period has finished without suppressed entries
+            for (auto old = repetitions_.begin(); old != repetitions_.end();)
+            {
+                if (old->second.suppressed == 0 && now - old->second.period_start >= repetition_period_)
+                {
+                    old = repetitions_.erase(old);
+                }
+                else
+                {
+                    ++old;
+                }
+            }
+        }
+
+        it = repetitions_.emplace(place, RepetitionState()).first;
+        it->second.period_start = now;
+    }
+
+    RepetitionState& state = it->second;
+
+    if (now - state.period_start >= repetition_period_)
+    {
+        state.period_start = now;
+        state.entries = 0;
+    }
+
+    if (state.entries >= max_repetitions_)
+    {
+        state.suppressed++;
+        return false;
+    }
+
+    state.entries++;
+    suppressed = state.suppressed;
+    state.suppressed = 0;
+    return true;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -18,7 +18,10 @@
  * This file contains class SlotThreadPool implementation.
  */
 
+#include <chrono>
+
 #include <cpp_utils/exception/ValueNotAllowedException.hpp>
+#include <cpp_utils/macros/tracepoints.hpp>
 #include <cpp_utils/utils.hpp>
 
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
@@ -31,6 +34,8 @@ SlotThreadPool::SlotThreadPool(
         const uint32_t n_threads)
     : number_of_threads_(n_threads)
     , enabled_(false)
+    , busy_threads_(0)
+    , busy_time_(0)
 {
     logDebug(UTILS_THREAD_POOL, "Creating Thread Pool with " << n_threads << " threads.");
 }
@@ -43,28 +48,37 @@ SlotThreadPool::~SlotThreadPool()
     task_queue_priority_0.disable();
     task_queue_priority_1.disable();
 
-    for (auto& thread : threads_)
+    std::lock_guard<std::mutex> lock(threads_mutex_);
+
+    for (auto& worker : workers_)
+    {
+        worker.thread.join();
+    }
+
+    for (auto& worker : retired_workers_)
     {
-        thread.join();
+        worker.thread.join();
     }
 }
 
 void SlotThreadPool::enable() noexcept
 {
+    std::lock_guard<std::mutex> lock(threads_mutex_);
+
     if (!enabled_.exchange(true))
     {
         // Execute threads
         for (uint32_t i = 0; i < number_of_threads_; ++i)
         {
-            threads_.emplace_back(
-                CustomThread(
-                    std::bind(&SlotThreadPool::thread_routine_, this)));
+            add_worker_nts_();
         }
     }
 }
 
 void SlotThreadPool::disable() noexcept
 {
+    std::lock_guard<std::mutex> lock(threads_mutex_);
+
     if (enabled_.exchange(false))
     {
         // Disable Task Queue, so threads will stop eventually when their current task is finished
@@ -72,12 +86,108 @@ void SlotThreadPool::disable() noexcept
         task_queue_priority_0.disable();
         task_queue_priority_1.disable();
 
-        for (auto& thread : threads_)
+        for (auto& worker : workers_)
+        {
+            worker.thread.join();
+        }
+
+        for (auto& worker : retired_workers_)
         {
-            thread.join();
+            worker.thread.join();
         }
 
-        threads_.clear();
+        workers_.clear();
+        retired_workers_.clear();
+    }
+}
+
+void SlotThreadPool::resize(
+        const uint32_t n_threads)
+{
+    if (n_threads == 0)
+    {
+        throw utils::ValueNotAllowedException(STR_ENTRY << "Thread Pool must have at least 1 thread.");
+    }
+
+    std::lock_guard<std::mutex> lock(threads_mutex_);
+
+    join_finished_workers_nts_();
+
+    if (n_threads == number_of_threads_)
+    {
+        return;
+    }
+
+    logInfo(UTILS_THREAD_POOL,
+            "Resizing Thread Pool from " << number_of_threads_ << " to " << n_threads << " threads.");
+
+    number_of_threads_ = n_threads;
+
+    if (!enabled_)
+    {
+        // The threads are created when the pool is enabled
+        return;
+    }
+
+    while (workers_.size() < n_threads)
+    {
+        add_worker_nts_();
+    }
+
+    while (workers_.size() > n_threads)
+    {
+        // Let the thread finish its current task and exit. It is joined afterwards so this does not block.
+        workers_.back().stop->store(true);
+        retired_workers_.push_back(std::move(workers_.back()));
+        workers_.pop_back();
+    }
+}
+
+uint32_t SlotThreadPool::number_of_threads() const noexcept
+{
+    return number_of_threads_.load();
+}
+
+uint32_t SlotThreadPool::busy_threads() const noexcept
+{
+    return busy_threads_.load();
+}
+
+uint64_t SlotThreadPool::pending_tasks() const noexcept
+{
+    return task_queue_priority_0.elements_ready_to_consume() + task_queue_priority_1.elements_ready_to_consume();
+}
+
+uint64_t SlotThreadPool::busy_time() const noexcept
+{
+    return busy_time_.load();
+}
+
+void SlotThreadPool::add_worker_nts_()
+{
+    Worker worker;
+    worker.stop = std::make_shared<std::atomic<bool>>(false);
+    worker.finished = std::make_shared<std::atomic<bool>>(false);
+    worker.thread = CustomThread(
+        std::bind(&SlotThreadPool::thread_routine_, this, worker.stop, worker.finished));
+
+    workers_.push_back(std::move(worker));
+}
+
+void SlotThreadPool::join_finished_workers_nts_()
+{
+    auto it = retired_workers_.begin();
+    while (it != retired_workers_.end())
+    {
+        if (it->finished->load())
+        {
+            it->thread.join();
+            it = retired_workers_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
     }
 }
 
@@ -152,13 +262,16 @@ utils::event::AwakeReason SlotThreadPool::wait_all_consumed(
     return task_queue_priority_0.wait_all_consumed(timeout);
 }
 
-void SlotThreadPool::thread_routine_()
+void SlotThreadPool::thread_routine_(
+        std::shared_ptr<std::atomic<bool>> stop,
+        std::shared_ptr<std::atomic<bool>> finished)
 {
     logDebug(UTILS_THREAD_POOL, "Starting thread routine: " << std::this_thread::get_id() << ".");
 
     try
     {
-        while (true)
+        // The thread wakes up at least every millisecond (priority 1 queue timeout), so it notices stop soon
+        while (!stop->load())
         {
             logDebug(UTILS_THREAD_POOL, "Thread: " << std::this_thread::get_id() << " free, getting new callback.");
 
@@ -191,14 +304,30 @@ void SlotThreadPool::thread_routine_()
 
             slots_mutex_.unlock();
 
+            CPP_UTILS_TRACEPOINT(cpp_utils, thread_pool_dequeue, this, task_id);
+
             logDebug(UTILS_THREAD_POOL, "Thread: " << std::this_thread::get_id() << " executing callback.");
+
+            busy_threads_++;
+            const auto start = std::chrono::steady_clock::now();
+
             task();
+
+            busy_time_ += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+            busy_threads_--;
+
+            CPP_UTILS_TRACEPOINT(cpp_utils, thread_pool_task_end, this, task_id);
         }
+
+        logDebug(UTILS_THREAD_POOL, "Removing thread: " << std::this_thread::get_id() << ".");
     }
     catch (const utils::DisabledException& e)
     {
         logDebug(UTILS_THREAD_POOL, "Stopping thread: " << std::this_thread::get_id() << ".");
     }
+
+    finished->store(true);
 }
 
 } /* namespace utils */
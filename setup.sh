@@ -35,6 +35,13 @@ cd build/ddspipe_yaml
 cmake ~/DDSProxy/ddspipe/ddspipe_yaml -DCMAKE_INSTALL_PREFIX=~/DDSProxy/install -DCMAKE_PREFIX_PATH=~/Fast-DDS/install
 cmake --build . --target install
 
+# ddspipe_benchmarks
+cd ~/DDSProxy
+mkdir build/ddspipe_benchmarks
+cd build/ddspipe_benchmarks
+cmake ~/DDSProxy/ddspipe/ddspipe_benchmarks -DCMAKE_INSTALL_PREFIX=~/DDSProxy/install -DCMAKE_PREFIX_PATH=~/Fast-DDS/install
+cmake --build . --target install
+
 # ddsproxy_core
 cd ~/DDSProxy
 mkdir build/ddsproxy_core